@@ -0,0 +1,79 @@
+#include "ArenaAllocator.hpp"
+#include "StatsAllocator.hpp"
+#include "Vector.hpp"
+#include "List.hpp"
+#include "Map.hpp"
+#include <iostream>
+#include <iomanip>
+#include <time.h>
+
+// 요청 하나마다 Vector, List, Map을 만들고 버리는 일을 REQUESTS번 한다
+// std::allocator와, 요청마다 reset()하는 InlineArena + ArenaAllocator 비교
+// StatsAllocator로 같은 일을 한 번 더 돌려 기록 비용과 요청 하나의 할당 분포를 본다
+
+static const int	REQUESTS = 20000;
+static const int	ITEMS = 64;
+
+static double	now()
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec * 1e-9);
+}
+
+template <class VecAlloc, class ListAlloc, class MapAlloc>
+static long		request(const VecAlloc &va, const ListAlloc &la, const MapAlloc &ma, int seed)
+{
+	ft::Vector<int, VecAlloc>						vec(va);
+	ft::List<int, ListAlloc>						lst(la);
+	ft::Map<int, int, ft::less<int>, MapAlloc>		m(ft::less<int>(), ma);
+	long											sum = 0;
+
+	for (int i = 0; i < ITEMS; ++i)
+	{
+		vec.push_back(i + seed);
+		lst.push_back(i ^ seed);
+		m[(i * 37 + seed) % 101] = i;
+	}
+	for (int i = 0; i < ITEMS; ++i)
+		sum += vec[i];
+	for (typename ft::List<int, ListAlloc>::iterator it = lst.begin(); it != lst.end(); ++it)
+		sum += *it;
+	for (typename ft::Map<int, int, ft::less<int>, MapAlloc>::iterator it = m.begin(); it != m.end(); ++it)
+		sum += it->second;
+	return (sum);
+}
+
+int		main()
+{
+	typedef ft::Pair<int, int>	pair_type;
+	double					start;
+	long					sink = 0;
+	ft::InlineArena<32768>	arena;
+	ft::AllocStats			stats;
+
+	start = now();
+	for (int r = 0; r < REQUESTS; ++r)
+		sink += request(std::allocator<int>(), std::allocator<int>(), std::allocator<pair_type>(), r);
+	std::cout << std::setw(20) << std::left << "std::allocator" << std::right << std::fixed << std::setprecision(3)
+		<< std::setw(10) << (now() - start) * 1e3 << " ms" << std::endl;
+	start = now();
+	for (int r = 0; r < REQUESTS; ++r)
+	{
+		sink += request(ft::ArenaAllocator<int>(arena), ft::ArenaAllocator<int>(arena),
+			ft::ArenaAllocator<pair_type>(arena), r);
+		arena.reset();
+	}
+	std::cout << std::setw(20) << std::left << "ArenaAllocator" << std::right << std::fixed << std::setprecision(3)
+		<< std::setw(10) << (now() - start) * 1e3 << " ms" << std::endl;
+	start = now();
+	for (int r = 0; r < REQUESTS; ++r)
+		sink += request(ft::StatsAllocator<int>(stats), ft::StatsAllocator<int>(stats),
+			ft::StatsAllocator<pair_type>(stats), r);
+	std::cout << std::setw(20) << std::left << "StatsAllocator" << std::right << std::fixed << std::setprecision(3)
+		<< std::setw(10) << (now() - start) * 1e3 << " ms" << std::endl;
+	ft::print_alloc_stats(std::cout, stats, "StatsAllocator");
+	std::cout << "arena heap blocks: " << arena.heap_blocks() << " (" << sink << ")" << std::endl;
+	return (0);
+}
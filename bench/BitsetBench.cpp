@@ -0,0 +1,111 @@
+#include "Vector.hpp"
+#include "Bitset.hpp"
+#include <iostream>
+#include <iomanip>
+#include <time.h>
+
+// COUNT개 플래그로 방문 집합을 흉내 낸다: 무작위로 표시하고, 센 다음, 켜진 곳을 훑고, 두 집합을 AND
+// ft::Vector<char>: 예전 Vector<bool>처럼 플래그 하나에 한 바이트
+// ft::Vector<bool>: 플래그 하나에 한 비트, 세기와 찾기와 AND는 워드 단위
+
+static const size_t	COUNT = 1UL << 27;
+static const size_t	MARKS = 1UL << 22;
+
+static double	now()
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec * 1e-9);
+}
+
+static size_t	next_index(unsigned long &seed)
+{
+	seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+	return ((seed >> 17) % COUNT);
+}
+
+static void		report(const char *name, const char *what, double elapsed, size_t result)
+{
+	std::cout << std::setw(16) << std::left << name << std::setw(10) << what << std::right << std::fixed
+		<< std::setprecision(3) << std::setw(10) << elapsed * 1e3 << " ms (" << result << ")" << std::endl;
+}
+
+static void		run_bytes()
+{
+	ft::Vector<char>	a;
+	ft::Vector<char>	b;
+	unsigned long		seed = 1;
+	size_t				n = 0;
+	double				start;
+
+	a.reserve(COUNT);
+	b.reserve(COUNT);
+	for (size_t i = 0; i < COUNT; ++i)
+	{
+		a.push_back(0);
+		b.push_back(0);
+	}
+	start = now();
+	for (size_t i = 0; i < MARKS; ++i)
+	{
+		a[next_index(seed)] = 1;
+		b[next_index(seed)] = 1;
+	}
+	report("Vector<char>", "mark", now() - start, COUNT);
+	start = now();
+	for (size_t i = 0; i < COUNT; ++i)
+		n += a[i];
+	report("Vector<char>", "count", now() - start, n);
+	start = now();
+	n = 0;
+	for (size_t i = 0; i < COUNT; ++i)
+		if (a[i])
+			n += i;
+	report("Vector<char>", "scan", now() - start, n);
+	start = now();
+	for (size_t i = 0; i < COUNT; ++i)
+		a[i] &= b[i];
+	n = 0;
+	for (size_t i = 0; i < COUNT; ++i)
+		n += a[i];
+	report("Vector<char>", "and", now() - start, n);
+	std::cout << "Vector<char>    memory " << (a.capacity() + b.capacity()) / (1 << 20) << " MB" << std::endl;
+}
+
+static void		run_bits()
+{
+	ft::Vector<bool>	a(COUNT);
+	ft::Vector<bool>	b(COUNT);
+	unsigned long		seed = 1;
+	size_t				n = 0;
+	double				start;
+
+	start = now();
+	for (size_t i = 0; i < MARKS; ++i)
+	{
+		a[next_index(seed)] = true;
+		b[next_index(seed)] = true;
+	}
+	report("Vector<bool>", "mark", now() - start, COUNT);
+	start = now();
+	n = a.count();
+	report("Vector<bool>", "count", now() - start, n);
+	start = now();
+	n = 0;
+	for (size_t i = a.find_first(); i != ft::Vector<bool>::npos; i = a.find_next(i))
+		n += i;
+	report("Vector<bool>", "scan", now() - start, n);
+	start = now();
+	a &= b;
+	n = a.count();
+	report("Vector<bool>", "and", now() - start, n);
+	std::cout << "Vector<bool>    memory " << (a.capacity() + b.capacity()) / 8 / (1 << 20) << " MB" << std::endl;
+}
+
+int		main()
+{
+	run_bytes();
+	run_bits();
+	return (0);
+}
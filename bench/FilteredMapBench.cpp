@@ -0,0 +1,72 @@
+#include "FilteredMap.hpp"
+#include "Map.hpp"
+#include <iostream>
+#include <iomanip>
+#include <time.h>
+
+// KEYS개를 넣은 맵에 LOOKUPS번 count를 부른다. 그중 MISS_PERCENT%는 없는 키
+// ft::Map: 없는 키도 트리 끝까지 내려간다
+// ft::FilteredMap: 없는 키는 대부분 필터의 캐시 라인 하나에서 끝난다
+
+static const int	KEYS = 1 << 20;
+static const int	LOOKUPS = 1 << 23;
+static const int	MISS_PERCENT = 90;
+
+static double	now()
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec * 1e-9);
+}
+
+static unsigned long	seed = 11;
+
+// 있는 키는 짝수, 없는 키는 홀수
+static int		next_key()
+{
+	unsigned long	r;
+
+	seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+	r = seed >> 33;
+	return (static_cast<int>((r % KEYS) * 2 + ((r >> 24) % 100 < MISS_PERCENT)));
+}
+
+template <class M>
+static long		run(const char *name, M &m)
+{
+	long	hits = 0;
+	double	start;
+
+	for (int i = 0; i < KEYS; ++i)
+		m.insert(ft::Pair<int, int>(i * 2, i));
+	seed = 11;
+	start = now();
+	for (int i = 0; i < LOOKUPS; ++i)
+		hits += m.count(next_key());
+	std::cout << std::setw(16) << std::left << name << std::right << std::fixed << std::setprecision(3)
+		<< std::setw(10) << (now() - start) * 1e3 << " ms" << std::endl;
+	return (hits);
+}
+
+int		main()
+{
+	long	hits = 0;
+
+	{
+		ft::Map<int, int>	m;
+
+		hits += run("ft::Map", m);
+	}
+	{
+		ft::FilteredMap<int, int>	m(KEYS);
+		ft::FilterStats				stats;
+
+		hits += run("FilteredMap", m);
+		stats = m.filter_stats();
+		std::cout << "filter: " << stats.memory_bytes / 1024 << " KiB, false positive rate "
+			<< std::setprecision(4) << stats.false_positive_rate() * 100 << "%" << std::endl;
+	}
+	std::cout << "(" << hits << ")" << std::endl;
+	return (0);
+}
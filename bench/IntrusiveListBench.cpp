@@ -0,0 +1,109 @@
+#include "IntrusiveList.hpp"
+#include "List.hpp"
+#include <iostream>
+#include <iomanip>
+#include <time.h>
+
+// 풀에 있는 연결 COUNT개를 idle과 active 리스트 사이에서 OPS번 옮긴다
+// ft::List<Conn *>: 옮길 때마다 노드를 할당/해제하고, 원소 위치를 찾으려면 리스트 이터레이터를 따로 들고 있어야 한다
+// ft::IntrusiveList: 연결 안의 고리로 바로 빼고 넣는다
+
+static const int	COUNT = 1 << 16;
+static const int	OPS = 1 << 23;
+
+struct Conn
+{
+	int								id;
+	ft::ListHook					idle;
+	ft::ListHook					active;
+	bool							is_active;
+	ft::List<Conn *>::iterator		where;
+};
+
+static double	now()
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec * 1e-9);
+}
+
+static unsigned long	seed = 5;
+
+static int		next_index()
+{
+	seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+	return (static_cast<int>((seed >> 33) % COUNT));
+}
+
+int		main()
+{
+	Conn			*pool = new Conn[COUNT];
+	double			start;
+	long			sink = 0;
+
+	for (int i = 0; i < COUNT; ++i)
+		pool[i].id = i;
+	{
+		ft::List<Conn *>	idle;
+		ft::List<Conn *>	active;
+
+		for (int i = 0; i < COUNT; ++i)
+		{
+			idle.push_back(pool + i);
+			pool[i].where = --idle.end();
+			pool[i].is_active = false;
+		}
+		seed = 5;
+		start = now();
+		for (int op = 0; op < OPS; ++op)
+		{
+			Conn	*c = pool + next_index();
+
+			if (c->is_active)
+			{
+				active.erase(c->where);
+				idle.push_back(c);
+				c->where = --idle.end();
+			}
+			else
+			{
+				idle.erase(c->where);
+				active.push_back(c);
+				c->where = --active.end();
+			}
+			c->is_active = !c->is_active;
+			sink += active.front()->id;
+		}
+		std::cout << std::setw(16) << std::left << "ft::List" << std::right << std::fixed << std::setprecision(3)
+			<< std::setw(10) << (now() - start) * 1e3 << " ms" << std::endl;
+	}
+	{
+		ft::IntrusiveList<Conn, &Conn::idle>	idle(pool, pool + COUNT);
+		ft::IntrusiveList<Conn, &Conn::active>	active;
+
+		seed = 5;
+		start = now();
+		for (int op = 0; op < OPS; ++op)
+		{
+			Conn	*c = pool + next_index();
+
+			if (c->active.is_linked())
+			{
+				active.erase(active.iterator_to(*c));
+				idle.push_back(*c);
+			}
+			else
+			{
+				idle.erase(idle.iterator_to(*c));
+				active.push_back(*c);
+			}
+			sink += active.front().id;
+		}
+		std::cout << std::setw(16) << std::left << "IntrusiveList" << std::right << std::fixed << std::setprecision(3)
+			<< std::setw(10) << (now() - start) * 1e3 << " ms" << std::endl;
+	}
+	delete[] pool;
+	std::cout << "(" << sink << ")" << std::endl;
+	return (0);
+}
@@ -0,0 +1,175 @@
+#include "LruCache.hpp"
+#include "List.hpp"
+#include "Map.hpp"
+#include <iostream>
+#include <iomanip>
+#include <pthread.h>
+#include <unistd.h>
+#include <time.h>
+
+// 치우친 키 분포로 OPS번 get하고, 없으면 put한다. 용량은 키 공간의 1/8
+// List + Map: 흔히 쓰는 조합. 원소마다 List 노드와 Map 노드 두 번 할당하고 찾기가 O(log n), 찾을 때마다 노드를 새로 만든다
+// LruCache: 원소마다 한 번 할당, 해시로 O(1), 찾으면 splice로 맨 앞에
+// ClockCache: 찾으면 참조 비트만 세운다
+// 마지막 줄은 ShardedCache를 코어 수만큼의 스레드로 돌린다
+
+static const int	KEYS = 1 << 20;
+static const int	CAPACITY = KEYS / 8;
+static const int	OPS = 1 << 23;
+
+static double	now()
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec * 1e-9);
+}
+
+// 작은 키가 훨씬 자주 나온다
+static int		next_key(unsigned long &seed)
+{
+	unsigned long	a;
+	unsigned long	b;
+
+	seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+	a = (seed >> 33) % KEYS;
+	b = (seed >> 13) % KEYS;
+	return (static_cast<int>(a * b / KEYS));
+}
+
+class ListMapCache
+{
+private:
+	typedef ft::List<ft::Pair<int, long> >	list_type;
+
+	list_type								_order;
+	ft::Map<int, list_type::iterator>		_index;
+	size_t									_size;
+
+public:
+	ListMapCache() : _size(0) {}
+
+	long	*get(int k)
+	{
+		ft::Map<int, list_type::iterator>::iterator	it = _index.find(k);
+
+		if (it == _index.end())
+			return (0);
+		// List::splice는 empty()에서 size()를 세느라 O(n)이라 지우고 다시 넣는다
+		_order.push_front(*it->second);
+		_order.erase(it->second);
+		it->second = _order.begin();
+		return (&it->second->second);
+	}
+
+	void	put(int k, long v)
+	{
+		_order.push_front(ft::Pair<int, long>(k, v));
+		_index[k] = _order.begin();
+		// List::size()가 O(n)이라 따로 센다
+		if (++_size > static_cast<size_t>(CAPACITY))
+		{
+			_index.erase(_order.back().first);
+			_order.pop_back();
+			--_size;
+		}
+	}
+};
+
+template <class C>
+static void		run(const char *name, C &cache)
+{
+	unsigned long	seed = 3;
+	long			hits = 0;
+	double			start;
+
+	start = now();
+	for (int i = 0; i < OPS; ++i)
+	{
+		int		k = next_key(seed);
+
+		if (cache.get(k))
+			++hits;
+		else
+			cache.put(k, k);
+	}
+	std::cout << std::setw(16) << std::left << name << std::right << std::fixed << std::setprecision(3)
+		<< std::setw(10) << (now() - start) * 1e3 << " ms, hit rate "
+		<< std::setprecision(1) << hits * 100.0 / OPS << "%" << std::endl;
+}
+
+template <class C>
+struct Worker
+{
+	C			*cache;
+	long		ops;
+	unsigned long	seed;
+};
+
+template <class C>
+static void		*work(void *arg)
+{
+	Worker<C>	*w = static_cast<Worker<C> *>(arg);
+	long		v;
+
+	for (long i = 0; i < w->ops; ++i)
+	{
+		int		k = next_key(w->seed);
+
+		if (!w->cache->get(k, v))
+			w->cache->put(k, k);
+	}
+	return (0);
+}
+
+template <class C>
+static void		run_sharded(const char *name, long threads)
+{
+	C				cache(64, CAPACITY);
+	pthread_t		*tid = new pthread_t[threads];
+	Worker<C>		*workers = new Worker<C>[threads];
+	double			start;
+
+	start = now();
+	for (long i = 0; i < threads; ++i)
+	{
+		workers[i].cache = &cache;
+		workers[i].ops = OPS / threads;
+		workers[i].seed = i * 2654435761UL + 3;
+		pthread_create(&tid[i], 0, work<C>, &workers[i]);
+	}
+	for (long i = 0; i < threads; ++i)
+		pthread_join(tid[i], 0);
+	std::cout << std::setw(16) << std::left << name << std::right << std::fixed << std::setprecision(3)
+		<< std::setw(10) << (now() - start) * 1e3 << " ms, hit rate "
+		<< std::setprecision(1) << cache.stats().hit_rate() * 100 << "% (" << threads << " threads)" << std::endl;
+	delete[] tid;
+	delete[] workers;
+}
+
+int		main()
+{
+	long	cores;
+
+	cores = sysconf(_SC_NPROCESSORS_ONLN);
+	if (cores < 1)
+		cores = 1;
+	{
+		ListMapCache	cache;
+
+		run("List + Map", cache);
+	}
+	{
+		ft::LruCache<int, long>		cache(CAPACITY);
+
+		run("LruCache", cache);
+	}
+	{
+		ft::ClockCache<int, long>	cache(CAPACITY);
+
+		run("ClockCache", cache);
+	}
+	run_sharded<ft::ShardedCache<ft::LruCache<int, long> > >("sharded LRU", cores);
+	run_sharded<ft::ShardedCache<ft::ClockCache<int, long> > >("sharded CLOCK", cores);
+	return (0);
+}
@@ -0,0 +1,126 @@
+#include "MappedMap.hpp"
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <cstdlib>
+#include <unistd.h>
+#include <time.h>
+
+// 참조용 Map을 다시 올리는 비용과 찾기 비교
+// text: 텍스트 덤프를 읽어 ft::Map에 넣는다 (지금 방식)
+// image: write_map_image로 쓴 이미지를 MappedMap으로 연다
+// find: 무작위 키 LOOKUPS개를 ft::Map, MappedMap(색인), 키 배열 이분 탐색으로 찾는다
+
+static const int	COUNT = 1 << 21;
+static const int	LOOKUPS = 1 << 21;
+
+static double	now()
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec * 1e-9);
+}
+
+static void		report(const char *name, double sec)
+{
+	std::cout << std::setw(24) << std::left << name << std::right << std::fixed << std::setprecision(3)
+		<< std::setw(10) << sec * 1e3 << " ms" << std::endl;
+}
+
+static unsigned long	seed = 99;
+
+static int		next_key()
+{
+	seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+	return (static_cast<int>((seed >> 33) % (COUNT * 4)));
+}
+
+int		main()
+{
+	char					text_name[] = "/tmp/ft_map_text_XXXXXX";
+	char					image_name[] = "/tmp/ft_map_image_XXXXXX";
+	int						text_fd = mkstemp(text_name);
+	int						image_fd = mkstemp(image_name);
+	ft::Map<int, long>		m;
+	ft::Vector<int>			probes;
+	double					start;
+	long					sink = 0;
+
+	if (text_fd < 0 || image_fd < 0)
+		return (1);
+	close(text_fd);
+	close(image_fd);
+	{
+		std::ofstream	out(text_name);
+
+		for (int i = 0; i < COUNT; ++i)
+		{
+			out << i * 4 << ' ' << static_cast<long>(i) * 3 << '\n';
+			m[i * 4] = static_cast<long>(i) * 3;
+		}
+	}
+	start = now();
+	ft::write_map_image(m, image_name);
+	report("image write", now() - start);
+	for (int i = 0; i < LOOKUPS; ++i)
+		probes.push_back(next_key());
+	{
+		std::ifstream		in(text_name);
+		ft::Map<int, long>	loaded;
+		int					k;
+		long				v;
+
+		start = now();
+		while (in >> k >> v)
+			loaded[k] = v;
+		report("text load", now() - start);
+		start = now();
+		for (int i = 0; i < LOOKUPS; ++i)
+		{
+			ft::Map<int, long>::iterator	it = loaded.find(probes[i]);
+
+			if (it != loaded.end())
+				sink += it->second;
+		}
+		report("Map find", now() - start);
+	}
+	{
+		start = now();
+		ft::MappedMap<int, long>	image(image_name);
+		report("image open", now() - start);
+		start = now();
+		for (int i = 0; i < LOOKUPS; ++i)
+		{
+			ft::MappedMap<int, long>::iterator	it = image.find(probes[i]);
+
+			if (it != image.end())
+				sink += it.value();
+		}
+		report("MappedMap find", now() - start);
+		start = now();
+		for (int i = 0; i < LOOKUPS; ++i)
+		{
+			const int	*keys = image.keys();
+			size_t		lo = 0;
+			size_t		hi = image.size();
+
+			while (lo < hi)
+			{
+				size_t	mid = lo + (hi - lo) / 2;
+
+				if (keys[mid] < probes[i])
+					lo = mid + 1;
+				else
+					hi = mid;
+			}
+			if (lo < image.size() && keys[lo] == probes[i])
+				sink += image.values()[lo];
+		}
+		report("plain binary search", now() - start);
+	}
+	unlink(text_name);
+	unlink(image_name);
+	std::cout << "(" << sink << ")" << std::endl;
+	return (0);
+}
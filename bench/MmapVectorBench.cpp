@@ -0,0 +1,106 @@
+#include "MmapVector.hpp"
+#include "Vector.hpp"
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+
+// 고정 크기 레코드 파일을 여는 비용 비교
+// vector: 파일을 read로 읽어 ft::Vector를 다시 만든다 (지금 방식)
+// mmap: MmapVector로 열기만 한다. 처음 훑을 때 페이지 캐시에서 페이지를 가져온다
+
+static const size_t	COUNT = 1 << 22;
+
+struct Record
+{
+	long	id;
+	double	value;
+};
+
+static double	now()
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec * 1e-9);
+}
+
+static void		report(const char *name, double sec)
+{
+	std::cout << std::setw(24) << std::left << name << std::right << std::fixed << std::setprecision(3)
+		<< std::setw(10) << sec * 1e3 << " ms" << std::endl;
+}
+
+template <class Vec>
+static double	scan(const Vec &v)
+{
+	double	sum = 0;
+
+	for (size_t i = 0; i < v.size(); ++i)
+		sum += v[i].value;
+	return (sum);
+}
+
+int		main()
+{
+	char		mm_name[] = "/tmp/ft_mmap_bench_XXXXXX";
+	char		raw_name[] = "/tmp/ft_raw_bench_XXXXXX";
+	int			mm_fd = mkstemp(mm_name);
+	int			raw_fd = mkstemp(raw_name);
+	double		start;
+	double		sink = 0;
+
+	if (mm_fd < 0 || raw_fd < 0)
+		return (1);
+	close(mm_fd);
+	{
+		ft::MmapVector<Record>	out(mm_name, ft::MmapVector<Record>::TRUNCATE);
+
+		out.reserve(COUNT);
+		for (size_t i = 0; i < COUNT; ++i)
+		{
+			Record	r = { static_cast<long>(i), i * 0.5 };
+
+			out.push_back(r);
+		}
+		if (write(raw_fd, out.data(), COUNT * sizeof(Record)) < 0)
+			return (1);
+	}
+	{
+		ft::Vector<Record>	v;
+		Record				buf[4096];
+		ssize_t				n;
+
+		start = now();
+		lseek(raw_fd, 0, SEEK_SET);
+		v.reserve(COUNT);
+		while ((n = read(raw_fd, buf, sizeof(buf))) > 0)
+		{
+			for (size_t i = 0; i < n / sizeof(Record); ++i)
+				v.push_back(buf[i]);
+		}
+		report("vector rebuild", now() - start);
+		start = now();
+		sink += scan(v);
+		report("vector scan", now() - start);
+	}
+	{
+		start = now();
+		ft::MmapVector<Record>	v(mm_name, ft::MmapVector<Record>::READ_ONLY);
+		report("mmap open", now() - start);
+		v.advise(ft::MmapVector<Record>::SEQUENTIAL);
+		start = now();
+		sink += scan(v);
+		report("mmap first scan", now() - start);
+		start = now();
+		sink += scan(v);
+		report("mmap second scan", now() - start);
+	}
+	close(raw_fd);
+	unlink(mm_name);
+	unlink(raw_name);
+	std::cout << "(" << sink << ")" << std::endl;
+	return (0);
+}
@@ -0,0 +1,105 @@
+#include "MpmcQueue.hpp"
+#include <iostream>
+#include <iomanip>
+#include <pthread.h>
+#include <unistd.h>
+#include <time.h>
+
+// 생산자/소비자 수를 1부터 코어 수까지 늘려가며 MpmcQueue의 처리량을 잰다
+// park: 비었거나 가득 차면 condition variable에서 잠든다, spin: sched_yield로 양보하며 돈다
+
+static const long	TOTAL = 2000000;
+
+static double	now()
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec * 1e-9);
+}
+
+struct Worker
+{
+	ft::MpmcQueue<long>	*queue;
+	long				count;
+	long				sum;
+};
+
+static void		*producer(void *arg)
+{
+	Worker	*w = static_cast<Worker *>(arg);
+
+	for (long i = 0; i < w->count; ++i)
+		w->queue->push(i);
+	return (0);
+}
+
+static void		*consumer(void *arg)
+{
+	Worker	*w = static_cast<Worker *>(arg);
+	long	val;
+
+	for (long i = 0; i < w->count; ++i)
+	{
+		w->queue->pop(val);
+		w->sum += val;
+	}
+	return (0);
+}
+
+// TOTAL개를 생산자/소비자에게 나눈다 (나머지는 마지막 스레드가 맡는다)
+static double	run(int producers, int consumers, bool parking)
+{
+	ft::MpmcQueue<long>	queue(1024, parking);
+	pthread_t			*threads = new pthread_t[producers + consumers];
+	Worker				*workers = new Worker[producers + consumers];
+	double				start;
+
+	start = now();
+	for (int i = 0; i < producers + consumers; ++i)
+	{
+		bool	is_producer = i < producers;
+		int		n = is_producer ? producers : consumers;
+		int		idx = is_producer ? i : i - producers;
+
+		workers[i].queue = &queue;
+		workers[i].sum = 0;
+		workers[i].count = TOTAL / n + (idx == n - 1 ? TOTAL % n : 0);
+		pthread_create(&threads[i], 0, is_producer ? producer : consumer, &workers[i]);
+	}
+	for (int i = 0; i < producers + consumers; ++i)
+		pthread_join(threads[i], 0);
+	start = now() - start;
+	delete[] threads;
+	delete[] workers;
+	return (TOTAL / start / 1e6);
+}
+
+// 1, 2, 4, ... 이고 마지막은 코어 수
+static long		next_count(long n, long cores)
+{
+	if (n < cores && n * 2 > cores)
+		return (cores);
+	return (n * 2);
+}
+
+int		main()
+{
+	long	cores;
+
+	cores = sysconf(_SC_NPROCESSORS_ONLN);
+	if (cores < 1)
+		cores = 1;
+	std::cout << "cores: " << cores << ", items: " << TOTAL << '\n';
+	std::cout << std::setw(6) << "prod" << std::setw(6) << "cons"
+		<< std::setw(14) << "park Mops/s" << std::setw(14) << "spin Mops/s" << '\n';
+	for (long p = 1; p <= cores; p = next_count(p, cores))
+	{
+		for (long c = 1; c <= cores; c = next_count(c, cores))
+		{
+			std::cout << std::setw(6) << p << std::setw(6) << c << std::fixed << std::setprecision(2)
+				<< std::setw(14) << run(p, c, true) << std::setw(14) << run(p, c, false) << '\n';
+		}
+	}
+	return (0);
+}
@@ -0,0 +1,108 @@
+#include "Parallel.hpp"
+#include "Vector.hpp"
+#include <iostream>
+#include <iomanip>
+#include <time.h>
+
+// ft::par 알고리즘을 순차 실행(threshold를 구간보다 크게)과 스레드 수별로 돌려 GB/s를 잰다
+// 읽고 쓴 바이트를 모두 센다 (copy는 읽기 + 쓰기, fill은 쓰기만)
+
+static const size_t	SIZE = 1 << 24;
+static const int	ROUNDS = 5;
+
+static double	now()
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec * 1e-9);
+}
+
+struct Scale
+{
+	double	operator() (double x) const { return (x * 1.5 + 1.0); }
+};
+
+// ROUNDS번 중 가장 빠른 시간으로 GB/s를 구한다
+static void		measure(const char *name, const ft::par::Policy &policy, size_t bytes,
+						ft::Vector<double> &in, ft::Vector<double> &out, double &sink)
+{
+	double	best;
+	double	start;
+	double	sec;
+
+	best = 0;
+	for (int r = 0; r < ROUNDS; ++r)
+	{
+		start = now();
+		if (name[0] == 'f')
+			ft::par::fill(out.begin(), out.end(), static_cast<double>(r), policy);
+		else if (name[0] == 'c')
+			ft::par::copy(in.begin(), in.end(), out.begin(), policy);
+		else if (name[0] == 't')
+			ft::par::transform(in.begin(), in.end(), out.begin(), Scale(), policy);
+		else if (name[0] == 'r')
+			sink += ft::par::reduce(in.begin(), in.end(), 0.0, policy);
+		else
+			ft::par::inclusive_scan(in.begin(), in.end(), out.begin(), policy);
+		sec = now() - start;
+		if (r == 0 || sec < best)
+			best = sec;
+	}
+	sink += out[SIZE / 2];
+	std::cout << std::setw(12) << bytes / best / 1e9;
+}
+
+int		main()
+{
+	static const char	*names[] = { "fill", "copy", "transform", "reduce", "scan" };
+	// 원소 하나당 읽고 쓰는 double 개수 (scan은 두 번 읽고 한 번 쓴다)
+	static const size_t	words[] = { 1, 2, 2, 1, 3 };
+	ft::Vector<double>	in(SIZE, 1.0);
+	ft::Vector<double>	out(SIZE, 0.0);
+	double				sink;
+	double				start;
+	double				best;
+	size_t				cores;
+
+	for (size_t i = 0; i < SIZE; ++i)
+		in[i] = static_cast<double>(i % 1024);
+	sink = 0;
+	cores = ft::ThreadPool::hardware_concurrency();
+	std::cout << "elements: " << SIZE << " doubles, cores: " << cores << ", GB/s (best of " << ROUNDS << ")\n";
+	std::cout << std::fixed << std::setprecision(2) << std::setw(8) << "threads";
+	for (int k = 0; k < 5; ++k)
+		std::cout << std::setw(12) << names[k];
+	std::cout << '\n';
+	// 비교 기준: Vector 복사 생성자
+	best = 0;
+	for (int r = 0; r < ROUNDS; ++r)
+	{
+		start = now();
+		{
+			ft::Vector<double>	copy(in);
+
+			sink += copy[SIZE / 3];
+		}
+		if (r == 0 || now() - start < best)
+			best = now() - start;
+	}
+	std::cout << std::setw(8) << "Vector" << std::setw(24) << 2 * SIZE * sizeof(double) / best / 1e9
+		<< "   (copy constructor)\n";
+	std::cout << std::setw(8) << "seq";
+	for (int k = 0; k < 5; ++k)
+		measure(names[k], ft::par::Policy(1 << 16, SIZE + 1), words[k] * SIZE * sizeof(double), in, out, sink);
+	std::cout << '\n';
+	for (size_t t = 1; t <= cores * 2; t = (t < cores && t * 2 > cores) ? cores : t * 2)
+	{
+		// 부른 스레드도 일을 나눠 맡으므로 일꾼은 t - 1개
+		ft::ThreadPool	pool(t > 1 ? t - 1 : 1);
+
+		std::cout << std::setw(8) << t;
+		for (int k = 0; k < 5; ++k)
+			measure(names[k], ft::par::Policy(1 << 16, 1 << 15, pool), words[k] * SIZE * sizeof(double), in, out, sink);
+		std::cout << '\n';
+	}
+	std::cout << "(checksum " << sink << ")\n";
+	return (0);
+}
@@ -0,0 +1,114 @@
+#include "PriorityQueue.hpp"
+#include <queue>
+#include <vector>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include <time.h>
+
+// ft::PriorityQueue(자식 2, 4, 8개)와 std::priority_queue 비교
+// fill/drain: SIZE개를 넣고 모두 꺼낸다
+// hold: 크기를 SIZE로 유지하며 가장 이른 것을 꺼내고 그보다 늦은 마감을 넣는다 (스케줄러)
+// bulk: push_range로 한 번에 넣는다 (std는 범위 생성자)
+
+static const size_t	SIZE = 1 << 20;
+static const size_t	HOLD_OPS = 1 << 22;
+
+static double	now()
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec * 1e-9);
+}
+
+static unsigned long	seed = 777;
+
+static unsigned int		next_random()
+{
+	seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+	return (static_cast<unsigned int>(seed >> 33));
+}
+
+// 최솟값이 먼저 나오도록 greater를 쓴다
+template <class Queue>
+static void		measure(const char *name, const std::vector<unsigned int> &keys, unsigned long &sink)
+{
+	double	start;
+	double	fill;
+	double	drain;
+	double	hold;
+	double	bulk;
+
+	{
+		Queue	q;
+
+		start = now();
+		for (size_t i = 0; i < SIZE; ++i)
+			q.push(keys[i]);
+		fill = now() - start;
+		start = now();
+		while (!q.empty())
+		{
+			sink += q.top();
+			q.pop();
+		}
+		drain = now() - start;
+	}
+	{
+		Queue			q(keys.begin(), keys.end());
+		unsigned int	t;
+
+		start = now();
+		for (size_t i = 0; i < HOLD_OPS; ++i)
+		{
+			t = q.top();
+			q.pop();
+			q.push(t + (next_random() & 0xffff));
+		}
+		hold = now() - start;
+		sink += q.top();
+	}
+	{
+		start = now();
+		Queue	q(keys.begin(), keys.end());
+
+		bulk = now() - start;
+		sink += q.top();
+	}
+	std::cout << std::setw(10) << name << std::setw(10) << fill << std::setw(10) << drain
+		<< std::setw(10) << hold << std::setw(10) << bulk << '\n';
+}
+
+// 범위 생성자 대신 빈 큐에 push_range
+template <size_t Arity>
+struct RangeQueue : public ft::PriorityQueue<unsigned int, ft::Vector<unsigned int>, ft::greater<unsigned int>, Arity>
+{
+	RangeQueue() {}
+
+	template <class InputIterator>
+	RangeQueue(InputIterator first, InputIterator last)
+	{
+		this->push_range(first, last);
+	}
+};
+
+int		main()
+{
+	std::vector<unsigned int>	keys(SIZE);
+	unsigned long				sink;
+
+	for (size_t i = 0; i < SIZE; ++i)
+		keys[i] = next_random();
+	sink = 0;
+	std::cout << "elements: " << SIZE << ", hold ops: " << HOLD_OPS << ", seconds\n";
+	std::cout << std::fixed << std::setprecision(4) << std::setw(10) << "queue" << std::setw(10) << "fill"
+		<< std::setw(10) << "drain" << std::setw(10) << "hold" << std::setw(10) << "bulk" << '\n';
+	measure<std::priority_queue<unsigned int, std::vector<unsigned int>, std::greater<unsigned int> > >(
+		"std", keys, sink);
+	measure<RangeQueue<2> >("ft d=2", keys, sink);
+	measure<RangeQueue<4> >("ft d=4", keys, sink);
+	measure<RangeQueue<8> >("ft d=8", keys, sink);
+	std::cout << "(checksum " << sink << ")\n";
+	return (0);
+}
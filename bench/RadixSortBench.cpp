@@ -0,0 +1,157 @@
+#include "RadixSort.hpp"
+#include "Algorithm.hpp"
+#include "Vector.hpp"
+#include <algorithm>
+#include <vector>
+#include <utility>
+#include <iostream>
+#include <iomanip>
+#include <stdint.h>
+#include <time.h>
+
+// ft::radix_sort를 비교 정렬(ft::sort, std::sort)과 비교한다
+// 64비트 키, 32비트 키 + 값 레코드(radix_sort_by_key), 그리고 스레드 수별 병렬 radix_sort
+
+static const size_t	SIZE = 1 << 23;
+
+static double	now()
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec * 1e-9);
+}
+
+static uint64_t	seed = 2024;
+
+static uint64_t	next_random()
+{
+	seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+	return (seed ^ (seed >> 29));
+}
+
+typedef ft::Pair<uint32_t, uint32_t>	record;
+
+struct RecordLess
+{
+	bool	operator() (const record &a, const record &b) const { return (a.first < b.first); }
+};
+
+struct StdRecordLess
+{
+	bool	operator() (const std::pair<uint32_t, uint32_t> &a, const std::pair<uint32_t, uint32_t> &b) const
+	{ return (a.first < b.first); }
+};
+
+template <class Vec>
+static bool		sorted(const Vec &v)
+{
+	for (size_t i = 1; i < v.size(); ++i)
+	{
+		if (v[i].first < v[i - 1].first)
+			return (false);
+	}
+	return (true);
+}
+
+static bool		sorted(const ft::Vector<uint64_t> &v)
+{
+	for (size_t i = 1; i < v.size(); ++i)
+	{
+		if (v[i] < v[i - 1])
+			return (false);
+	}
+	return (true);
+}
+
+static void		report(const char *name, double sec, bool ok)
+{
+	std::cout << std::setw(24) << name << std::setw(10) << sec << std::setw(12) << SIZE / sec / 1e6
+		<< (ok ? "" : "   NOT SORTED") << '\n';
+}
+
+int		main()
+{
+	ft::Vector<uint64_t>	keys(SIZE, 0);
+	ft::Vector<record>		records(SIZE, record());
+	double					start;
+	size_t					cores;
+
+	for (size_t i = 0; i < SIZE; ++i)
+	{
+		keys[i] = next_random();
+		records[i] = record(static_cast<uint32_t>(next_random()), static_cast<uint32_t>(i));
+	}
+	cores = ft::ThreadPool::hardware_concurrency();
+	std::cout << "elements: " << SIZE << ", cores: " << cores << '\n';
+	std::cout << std::fixed << std::setprecision(3) << std::setw(24) << "uint64 keys"
+		<< std::setw(10) << "seconds" << std::setw(12) << "Mkeys/s" << '\n';
+	{
+		ft::Vector<uint64_t>	v(keys);
+
+		start = now();
+		std::sort(&v[0], &v[0] + SIZE);
+		report("std::sort", now() - start, sorted(v));
+	}
+	{
+		ft::Vector<uint64_t>	v(keys);
+
+		start = now();
+		ft::sort(v.begin(), v.end());
+		report("ft::sort", now() - start, sorted(v));
+	}
+	{
+		ft::Vector<uint64_t>	v(keys);
+
+		start = now();
+		ft::radix_sort(v.begin(), v.end());
+		report("ft::radix_sort", now() - start, sorted(v));
+	}
+	{
+		// 위 5바이트가 모두 0이라 세 자리만 돈다
+		ft::Vector<uint64_t>	v(keys);
+
+		for (size_t i = 0; i < SIZE; ++i)
+			v[i] &= 0xffffff;
+		start = now();
+		ft::radix_sort(v.begin(), v.end());
+		report("radix_sort (24-bit keys)", now() - start, sorted(v));
+	}
+	for (size_t t = 2; t <= cores * 2; t *= 2)
+	{
+		ft::Vector<uint64_t>	v(keys);
+		ft::ThreadPool			pool(t - 1);
+
+		start = now();
+		ft::radix_sort(v.begin(), v.end(), ft::par::Policy(1 << 16, 1 << 15, pool));
+		std::cout << std::setw(20) << "parallel t=" << std::setw(4) << std::left << t << std::right;
+		std::cout << std::setw(10) << now() - start << std::setw(12) << SIZE / (now() - start) / 1e6
+			<< (sorted(v) ? "" : "   NOT SORTED") << '\n';
+	}
+	std::cout << std::setw(24) << "uint32 + value records" << '\n';
+	{
+		// ft::Pair에는 std 알고리즘이 부르는 swap이 모호하므로 std::pair로 옮겨서 잰다
+		std::vector<std::pair<uint32_t, uint32_t> >	v(SIZE);
+
+		for (size_t i = 0; i < SIZE; ++i)
+			v[i] = std::make_pair(records[i].first, records[i].second);
+		start = now();
+		std::stable_sort(v.begin(), v.end(), StdRecordLess());
+		report("std::stable_sort", now() - start, sorted(v));
+	}
+	{
+		ft::Vector<record>	v(records);
+
+		start = now();
+		ft::stable_sort(v.begin(), v.end(), RecordLess());
+		report("ft::stable_sort", now() - start, sorted(v));
+	}
+	{
+		ft::Vector<record>	v(records);
+
+		start = now();
+		ft::radix_sort_by_key(v.begin(), v.end(), ft::Select1st<record>());
+		report("ft::radix_sort_by_key", now() - start, sorted(v));
+	}
+	return (0);
+}
@@ -0,0 +1,110 @@
+#include "Serialize.hpp"
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <cstdio>
+#include <unistd.h>
+#include <time.h>
+
+// ft::serialize/deserialize와 원소 하나씩 쓰고 읽는 방식 비교 (임시 파일 fd)
+// vector: 한 번에 큰 덩어리로 쓰고 읽는다
+// map: 정렬된 순서로 읽어 O(n)으로 트리를 세운다, 비교 대상은 insert로 하나씩 넣기
+
+static const size_t	VECTOR_SIZE = 1 << 24;
+static const size_t	MAP_SIZE = 1 << 20;
+
+static double	now()
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec * 1e-9);
+}
+
+static void		report(const char *name, double sec, size_t bytes)
+{
+	std::cout << std::setw(24) << std::left << name << std::right << std::fixed << std::setprecision(3)
+		<< std::setw(8) << sec * 1e3 << " ms " << std::setw(8) << bytes / sec / 1e9 << " GB/s" << std::endl;
+}
+
+static void		bench_vector(int fd)
+{
+	ft::Vector<int>	v;
+	ft::Vector<int>	back;
+	size_t			bytes = VECTOR_SIZE * sizeof(int);
+	double			start;
+	int				x;
+
+	for (size_t i = 0; i < VECTOR_SIZE; ++i)
+		v.push_back(static_cast<int>(i * 2654435761U));
+	lseek(fd, 0, SEEK_SET);
+	start = now();
+	ft::serialize(v, fd);
+	report("vector serialize", now() - start, bytes);
+	lseek(fd, 0, SEEK_SET);
+	start = now();
+	ft::deserialize(back, fd);
+	report("vector deserialize", now() - start, bytes);
+
+	std::stringstream	ss;
+
+	start = now();
+	for (size_t i = 0; i < VECTOR_SIZE; ++i)
+		ss.write(reinterpret_cast<const char *>(&v[i]), sizeof(int));
+	report("vector per element out", now() - start, bytes);
+	back.clear();
+	start = now();
+	while (ss.read(reinterpret_cast<char *>(&x), sizeof(int)))
+		back.push_back(x);
+	report("vector per element in", now() - start, bytes);
+	if (!(back == v))
+		std::cout << "mismatch" << std::endl;
+}
+
+static void		bench_map(int fd)
+{
+	ft::Map<int, int>	m;
+	ft::Map<int, int>	back;
+	ft::Map<int, int>	inserted;
+	size_t				bytes = MAP_SIZE * 2 * sizeof(int);
+	double				start;
+	int					kv[2];
+
+	for (size_t i = 0; i < MAP_SIZE; ++i)
+		m[static_cast<int>(i * 3)] = static_cast<int>(i);
+	lseek(fd, 0, SEEK_SET);
+	start = now();
+	ft::serialize(m, fd);
+	report("map serialize", now() - start, bytes);
+	lseek(fd, 0, SEEK_SET);
+	start = now();
+	ft::deserialize(back, fd);
+	report("map deserialize", now() - start, bytes);
+
+	std::stringstream	ss;
+
+	for (ft::Map<int, int>::iterator it = m.begin(); it != m.end(); ++it)
+	{
+		kv[0] = it->first;
+		kv[1] = it->second;
+		ss.write(reinterpret_cast<const char *>(kv), sizeof(kv));
+	}
+	start = now();
+	while (ss.read(reinterpret_cast<char *>(kv), sizeof(kv)))
+		inserted.insert(ft::Pair<int, int>(kv[0], kv[1]));
+	report("map insert one by one", now() - start, bytes);
+	if (back.size() != inserted.size())
+		std::cout << "mismatch" << std::endl;
+}
+
+int		main()
+{
+	FILE	*file = std::tmpfile();
+
+	if (!file)
+		return (1);
+	bench_vector(fileno(file));
+	bench_map(fileno(file));
+	std::fclose(file);
+	return (0);
+}
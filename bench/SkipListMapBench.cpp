@@ -0,0 +1,159 @@
+#include "SkipListMap.hpp"
+#include "Map.hpp"
+#include <iostream>
+#include <iomanip>
+#include <pthread.h>
+#include <unistd.h>
+#include <time.h>
+
+// KEYS개 키 공간에서 스레드마다 OPS번 섞어서 찾고(READ_PERCENT%), 넣고, 지운다
+// locked: ft::Map 하나를 mutex 하나로 감싼다. 찾기도 잠금을 잡으므로 쓰는 스레드와 줄을 선다
+// skiplist: ft::SkipListMap, 찾기는 잠금 없이, 넣기/지우기는 CAS로
+
+static const int	KEYS = 1 << 16;
+static const long	OPS = 1000000;
+static const int	READ_PERCENT = 90;
+
+static double	now()
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec * 1e-9);
+}
+
+struct LockedMap
+{
+	ft::Map<int, int>	map;
+	pthread_mutex_t		lock;
+
+	LockedMap() { pthread_mutex_init(&lock, 0); }
+	~LockedMap() { pthread_mutex_destroy(&lock); }
+
+	bool	find(int k)
+	{
+		bool	ret;
+
+		pthread_mutex_lock(&lock);
+		ret = map.find(k) != map.end();
+		pthread_mutex_unlock(&lock);
+		return (ret);
+	}
+
+	void	insert(int k)
+	{
+		pthread_mutex_lock(&lock);
+		map.insert(ft::Pair<int, int>(k, k));
+		pthread_mutex_unlock(&lock);
+	}
+
+	void	erase(int k)
+	{
+		pthread_mutex_lock(&lock);
+		map.erase(k);
+		pthread_mutex_unlock(&lock);
+	}
+};
+
+struct SkipMap
+{
+	ft::SkipListMap<int, int>	map;
+
+	bool	find(int k)
+	{ return (map.count(k) != 0); }
+
+	void	insert(int k)
+	{ map.insert(ft::Pair<int, int>(k, k)); }
+
+	void	erase(int k)
+	{ map.erase(k); }
+};
+
+template <class M>
+struct Worker
+{
+	M				*map;
+	unsigned long	seed;
+	long			ops;
+	long			hits;
+};
+
+template <class M>
+static void		*work(void *arg)
+{
+	Worker<M>		*w = static_cast<Worker<M> *>(arg);
+	unsigned long	r;
+	int				k;
+
+	for (long i = 0; i < w->ops; ++i)
+	{
+		w->seed = w->seed * 6364136223846793005UL + 1442695040888963407UL;
+		r = w->seed >> 33;
+		k = static_cast<int>(r % KEYS);
+		if ((r >> 16) % 100 < READ_PERCENT)
+			w->hits += w->map->find(k);
+		else if ((r >> 16) & 1)
+			w->map->insert(k);
+		else
+			w->map->erase(k);
+	}
+	return (0);
+}
+
+// 키 절반을 미리 넣고 OPS를 스레드에게 나눈다. 초당 백만 연산을 반환
+template <class M>
+static double	run(int threads, long &hits)
+{
+	M				map;
+	pthread_t		*tid = new pthread_t[threads];
+	Worker<M>		*workers = new Worker<M>[threads];
+	double			start;
+
+	for (int k = 0; k < KEYS; k += 2)
+		map.insert(k);
+	start = now();
+	for (int i = 0; i < threads; ++i)
+	{
+		workers[i].map = &map;
+		workers[i].seed = i * 2654435761UL + 1;
+		workers[i].ops = OPS / threads;
+		workers[i].hits = 0;
+		pthread_create(&tid[i], 0, work<M>, &workers[i]);
+	}
+	for (int i = 0; i < threads; ++i)
+	{
+		pthread_join(tid[i], 0);
+		hits += workers[i].hits;
+	}
+	start = now() - start;
+	delete[] tid;
+	delete[] workers;
+	return (OPS / start / 1e6);
+}
+
+// 1, 2, 4, ... 이고 마지막은 코어 수
+static long		next_count(long n, long cores)
+{
+	if (n < cores && n * 2 > cores)
+		return (cores);
+	return (n * 2);
+}
+
+int		main()
+{
+	long	cores;
+	long	hits = 0;
+
+	cores = sysconf(_SC_NPROCESSORS_ONLN);
+	if (cores < 1)
+		cores = 1;
+	std::cout << "cores: " << cores << ", keys: " << KEYS << ", reads: " << READ_PERCENT << "%\n";
+	std::cout << std::setw(8) << "threads" << std::setw(16) << "locked Mops/s" << std::setw(18) << "skiplist Mops/s" << '\n';
+	for (long t = 1; t <= cores; t = next_count(t, cores))
+	{
+		std::cout << std::setw(8) << t << std::fixed << std::setprecision(2)
+			<< std::setw(16) << run<LockedMap>(t, hits) << std::setw(18) << run<SkipMap>(t, hits) << '\n';
+	}
+	std::cout << "(" << hits << ")" << std::endl;
+	return (0);
+}
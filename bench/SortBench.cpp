@@ -0,0 +1,107 @@
+#include "Algorithm.hpp"
+#include "Vector.hpp"
+#include <algorithm>
+#include <vector>
+#include <iostream>
+#include <iomanip>
+#include <time.h>
+
+// ft::sort / ft::stable_sort를 std::sort / std::stable_sort와 같은 데이터로 비교한다
+// 분포: 무작위, 정렬됨, 거꾸로, 같은 키가 많음(16종류)
+
+static const size_t	SIZE = 1 << 22;
+
+static double	now()
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec * 1e-9);
+}
+
+static unsigned long	seed = 12345;
+
+static int		next_random()
+{
+	seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+	return (static_cast<int>(seed >> 33));
+}
+
+static void		generate(int kind, std::vector<int> &out)
+{
+	out.resize(SIZE);
+	for (size_t i = 0; i < SIZE; ++i)
+	{
+		if (kind == 0)
+			out[i] = next_random();
+		else if (kind == 1)
+			out[i] = static_cast<int>(i);
+		else if (kind == 2)
+			out[i] = static_cast<int>(SIZE - i);
+		else
+			out[i] = next_random() % 16;
+	}
+}
+
+// 정렬 결과가 std와 같은지 확인하고 걸린 초를 반환
+template <class Sort>
+static double	run(const std::vector<int> &data, const std::vector<int> &expected, Sort sort, bool &same)
+{
+	ft::Vector<int>	v(data.begin(), data.end());
+	double			start;
+	double			sec;
+
+	start = now();
+	sort(v);
+	sec = now() - start;
+	for (size_t i = 0; i < SIZE; ++i)
+		same = same && v[i] == expected[i];
+	return (sec);
+}
+
+struct FtSort
+{
+	void	operator() (ft::Vector<int> &v) const { ft::sort(v.begin(), v.end()); }
+};
+
+struct FtStableSort
+{
+	void	operator() (ft::Vector<int> &v) const { ft::stable_sort(v.begin(), v.end()); }
+};
+
+struct StdSort
+{
+	void	operator() (ft::Vector<int> &v) const { std::sort(&v[0], &v[0] + v.size()); }
+};
+
+struct StdStableSort
+{
+	void	operator() (ft::Vector<int> &v) const { std::stable_sort(&v[0], &v[0] + v.size()); }
+};
+
+int		main()
+{
+	static const char	*names[] = { "random", "sorted", "reversed", "16 keys" };
+	std::vector<int>	data;
+	std::vector<int>	expected;
+	bool				same;
+
+	std::cout << "elements: " << SIZE << " ints, seconds\n";
+	std::cout << std::fixed << std::setprecision(4) << std::setw(10) << "data"
+		<< std::setw(12) << "ft::sort" << std::setw(12) << "std::sort"
+		<< std::setw(14) << "ft::stable" << std::setw(14) << "std::stable" << '\n';
+	for (int kind = 0; kind < 4; ++kind)
+	{
+		generate(kind, data);
+		expected = data;
+		std::sort(expected.begin(), expected.end());
+		same = true;
+		std::cout << std::setw(10) << names[kind];
+		std::cout << std::setw(12) << run(data, expected, FtSort(), same);
+		std::cout << std::setw(12) << run(data, expected, StdSort(), same);
+		std::cout << std::setw(14) << run(data, expected, FtStableSort(), same);
+		std::cout << std::setw(14) << run(data, expected, StdStableSort(), same);
+		std::cout << (same ? "" : "   MISMATCH") << '\n';
+	}
+	return (0);
+}
@@ -0,0 +1,220 @@
+#include "SpscQueue.hpp"
+#include "Queue.hpp"
+#include "List.hpp"
+#include <iostream>
+#include <iomanip>
+#include <pthread.h>
+#include <time.h>
+
+// 두 스레드 사이에서 SpscQueue와 mutex로 감싼 Queue의 처리량, 왕복 지연 시간을 비교한다
+
+static const long	COUNT = 10000000;
+static const long	PING_COUNT = 200000;
+
+static double	now()
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec * 1e-9);
+}
+
+static void		report(const char *name, long count, double sec)
+{
+	std::cout << std::left << std::setw(28) << name << std::right
+		<< std::setw(10) << std::fixed << std::setprecision(2) << count / sec / 1e6 << " Mops/s"
+		<< std::setw(10) << std::setprecision(1) << sec * 1e9 / count << " ns/op\n";
+}
+
+// SpscQueue 처리량
+static void		*spsc_producer(void *arg)
+{
+	ft::SpscQueue<long>	*q = static_cast<ft::SpscQueue<long> *>(arg);
+
+	for (long i = 0; i < COUNT; ++i)
+		q->push(i);
+	return (0);
+}
+
+static void		spsc_throughput()
+{
+	ft::SpscQueue<long>	q(4096);
+	pthread_t			thread;
+	long				val;
+	long				sum;
+	double				start;
+
+	sum = 0;
+	start = now();
+	pthread_create(&thread, 0, spsc_producer, &q);
+	for (long i = 0; i < COUNT; ++i)
+	{
+		while (!q.try_pop(val))
+			sched_yield();
+		sum += val;
+	}
+	pthread_join(thread, 0);
+	report("SpscQueue push/try_pop", COUNT, now() - start);
+	if (sum != COUNT * (COUNT - 1) / 2)
+		std::cout << "bad sum\n";
+}
+
+// 64개씩 묶어서
+enum { BATCH = 64 };
+
+static void		*spsc_batch_producer(void *arg)
+{
+	ft::SpscQueue<long>	*q = static_cast<ft::SpscQueue<long> *>(arg);
+	long				buf[BATCH];
+	long				sent;
+
+	for (long i = 0; i < COUNT; i += BATCH)
+	{
+		for (int j = 0; j < BATCH; ++j)
+			buf[j] = i + j;
+		sent = 0;
+		while (sent < BATCH)
+		{
+			sent += q->push_n(buf + sent, BATCH - sent);
+			if (sent < BATCH)
+				sched_yield();
+		}
+	}
+	return (0);
+}
+
+static void		spsc_batch_throughput()
+{
+	ft::SpscQueue<long>	q(4096);
+	pthread_t			thread;
+	long				buf[BATCH];
+	long				got;
+	size_t				n;
+	double				start;
+
+	start = now();
+	pthread_create(&thread, 0, spsc_batch_producer, &q);
+	got = 0;
+	while (got < COUNT)
+	{
+		n = q.pop_n(buf, BATCH);
+		if (n == 0)
+			sched_yield();
+		got += n;
+	}
+	pthread_join(thread, 0);
+	report("SpscQueue push_n/pop_n x64", COUNT, now() - start);
+}
+
+// 비교 대상: mutex + Queue
+template <class Q>
+struct Locked
+{
+	Q				q;
+	pthread_mutex_t	lock;
+	long			count;
+};
+
+template <class Q>
+static void		*locked_producer(void *arg)
+{
+	Locked<Q>	*l = static_cast<Locked<Q> *>(arg);
+
+	for (long i = 0; i < l->count; ++i)
+	{
+		pthread_mutex_lock(&l->lock);
+		l->q.push(i);
+		pthread_mutex_unlock(&l->lock);
+	}
+	return (0);
+}
+
+template <class Q>
+static void		locked_throughput(const char *name, long count)
+{
+	Locked<Q>	l;
+	pthread_t	thread;
+	long		got;
+	double		start;
+
+	pthread_mutex_init(&l.lock, 0);
+	l.count = count;
+	start = now();
+	pthread_create(&thread, 0, locked_producer<Q>, &l);
+	got = 0;
+	while (got < count)
+	{
+		pthread_mutex_lock(&l.lock);
+		if (!l.q.empty())
+		{
+			l.q.pop();
+			++got;
+			pthread_mutex_unlock(&l.lock);
+		}
+		else
+		{
+			pthread_mutex_unlock(&l.lock);
+			sched_yield();
+		}
+	}
+	pthread_join(thread, 0);
+	pthread_mutex_destroy(&l.lock);
+	report(name, count, now() - start);
+}
+
+// 왕복 지연: 한 스레드가 보내면 다른 스레드가 받아서 그대로 돌려준다
+struct PingPong
+{
+	ft::SpscQueue<long>	to;
+	ft::SpscQueue<long>	from;
+
+	PingPong() : to(64), from(64) {}
+};
+
+static void		*ponger(void *arg)
+{
+	PingPong	*p = static_cast<PingPong *>(arg);
+	long		val;
+
+	for (long i = 0; i < PING_COUNT; ++i)
+	{
+		while (!p->to.try_pop(val))
+			sched_yield();
+		while (!p->from.try_push(val))
+			sched_yield();
+	}
+	return (0);
+}
+
+static void		spsc_latency()
+{
+	PingPong	p;
+	pthread_t	thread;
+	long		val;
+	double		start;
+
+	pthread_create(&thread, 0, ponger, &p);
+	start = now();
+	for (long i = 0; i < PING_COUNT; ++i)
+	{
+		while (!p.to.try_push(i))
+			sched_yield();
+		while (!p.from.try_pop(val))
+			sched_yield();
+	}
+	std::cout << std::left << std::setw(28) << "SpscQueue round trip" << std::right
+		<< std::setw(10) << std::fixed << std::setprecision(1)
+		<< (now() - start) * 1e9 / PING_COUNT << " ns\n";
+	pthread_join(thread, 0);
+}
+
+int		main()
+{
+	spsc_throughput();
+	spsc_batch_throughput();
+	// List::empty()는 O(n), Vector 컨테이너는 pop마다 전체를 당기므로 개수를 줄여서 잰다
+	locked_throughput<ft::Queue<long, ft::List<long> > >("mutex + Queue<List>", COUNT / 100);
+	locked_throughput<ft::Queue<long> >("mutex + Queue<Vector>", COUNT / 100);
+	spsc_latency();
+	return (0);
+}
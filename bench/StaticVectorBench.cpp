@@ -0,0 +1,78 @@
+#include "StaticVector.hpp"
+#include "Vector.hpp"
+#include "Stack.hpp"
+#include <iostream>
+#include <iomanip>
+#include <time.h>
+
+// 반복마다 BATCH개짜리 작은 버퍼를 새로 만들어 채우고 훑는다 (패킷 필드, 코어별 묶음 같은 경우)
+// ft::Vector: 버퍼마다 힙 할당, 자랄 때마다 재할당
+// ft::StaticVector: 스택에 있으므로 할당이 없다
+// 아래 두 줄은 같은 일을 Stack의 Container로 한다
+
+static const int	ROUNDS = 1 << 20;
+static const int	BATCH = 16;
+
+static double	now()
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec * 1e-9);
+}
+
+static void		report(const char *name, double elapsed, long sink)
+{
+	std::cout << std::setw(24) << std::left << name << std::right << std::fixed << std::setprecision(3)
+		<< std::setw(10) << elapsed * 1e3 << " ms (" << sink << ")" << std::endl;
+}
+
+template <class V>
+static void		run(const char *name)
+{
+	long	sink = 0;
+	double	start;
+
+	start = now();
+	for (int r = 0; r < ROUNDS; ++r)
+	{
+		V	buf;
+
+		for (int i = 0; i < BATCH; ++i)
+			buf.push_back(r + i);
+		for (typename V::iterator it = buf.begin(); it != buf.end(); ++it)
+			sink += *it;
+	}
+	report(name, now() - start, sink);
+}
+
+template <class S>
+static void		run_stack(const char *name)
+{
+	long	sink = 0;
+	double	start;
+
+	start = now();
+	for (int r = 0; r < ROUNDS; ++r)
+	{
+		S	s;
+
+		for (int i = 0; i < BATCH; ++i)
+			s.push(r ^ i);
+		while (!s.empty())
+		{
+			sink += s.top();
+			s.pop();
+		}
+	}
+	report(name, now() - start, sink);
+}
+
+int		main()
+{
+	run<ft::Vector<int> >("Vector");
+	run<ft::StaticVector<int, BATCH> >("StaticVector");
+	run_stack<ft::Stack<int> >("Stack<Vector>");
+	run_stack<ft::Stack<int, ft::StaticVector<int, BATCH> > >("Stack<StaticVector>");
+	return (0);
+}
@@ -0,0 +1,87 @@
+#include "ThreadPool.hpp"
+#include "Vector.hpp"
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <time.h>
+
+// ft::Vector 위의 CPU 위주 반복문을 순차 실행과 스레드 수별 parallel_for로 돌려 속도 향상을 잰다
+
+static const size_t	SIZE = 1 << 20;
+static const size_t	GRAIN = 4096;
+static const int	ITERATIONS = 40;
+
+static double	now()
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec * 1e-9);
+}
+
+// 원소마다 뉴턴 방법으로 제곱근을 ITERATIONS번 다듬는다
+struct Kernel
+{
+	const ft::Vector<double>	*in;
+	ft::Vector<double>			*out;
+
+	Kernel(const ft::Vector<double> *i, ft::Vector<double> *o) : in(i), out(o) {}
+
+	void	operator() (size_t lo, size_t hi) const
+	{
+		for (size_t i = lo; i < hi; ++i)
+		{
+			double	x = (*in)[i];
+			double	r = x;
+
+			for (int k = 0; k < ITERATIONS; ++k)
+				r = 0.5 * (r + x / r);
+			(*out)[i] = r;
+		}
+	}
+};
+
+// 결과가 버려지지 않도록 합을 출력한다
+static double	checksum(const ft::Vector<double> &v)
+{
+	double	sum;
+
+	sum = 0;
+	for (size_t i = 0; i < v.size(); ++i)
+		sum += v[i];
+	return (sum);
+}
+
+int		main()
+{
+	ft::Vector<double>	in(SIZE, 0);
+	ft::Vector<double>	out(SIZE, 0);
+	double				start;
+	double				base;
+	double				sec;
+	size_t				cores;
+
+	for (size_t i = 0; i < SIZE; ++i)
+		in[i] = static_cast<double>(i + 1);
+	start = now();
+	Kernel(&in, &out)(0, SIZE);
+	base = now() - start;
+	cores = ft::ThreadPool::hardware_concurrency();
+	std::cout << "elements: " << SIZE << ", grain: " << GRAIN << ", cores: " << cores << '\n';
+	std::cout << std::fixed << std::setprecision(3)
+		<< std::setw(8) << "threads" << std::setw(12) << "seconds" << std::setw(10) << "speedup" << '\n';
+	std::cout << std::setw(8) << "seq" << std::setw(12) << base << std::setw(10) << 1.0
+		<< "   (checksum " << checksum(out) << ")\n";
+	for (size_t t = 1; t <= cores * 2; t = (t < cores && t * 2 > cores) ? cores : t * 2)
+	{
+		// 부른 스레드도 일을 나눠 맡으므로 일꾼은 t - 1개
+		ft::ThreadPool	pool(t > 1 ? t - 1 : 1);
+
+		start = now();
+		pool.parallel_for(0, SIZE, GRAIN, Kernel(&in, &out));
+		sec = now() - start;
+		std::cout << std::setw(8) << t << std::setw(12) << sec << std::setw(10) << base / sec
+			<< "   (checksum " << checksum(out) << ")\n";
+	}
+	return (0);
+}
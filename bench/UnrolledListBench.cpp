@@ -0,0 +1,78 @@
+#include "UnrolledList.hpp"
+#include "List.hpp"
+#include <iostream>
+#include <iomanip>
+#include <time.h>
+
+// COUNT개짜리 리스트를 PASSES번 훑고, 가운데 커서에서 INSERTS번 넣는다
+// ft::List: 원소마다 노드 하나, 훑을 때 원소마다 포인터를 따라간다
+// ft::UnrolledList: 노드 하나에 원소 여러 개, 노드 안에서는 배열처럼 훑는다
+// 두 리스트를 번갈아 키워서 ft::List의 노드가 메모리에 띄엄띄엄 놓이게 한다
+
+static const int	COUNT = 1 << 20;
+static const int	PASSES = 20;
+static const int	INSERTS = 1 << 20;
+
+static double	now()
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec * 1e-9);
+}
+
+static void		report(const char *name, const char *what, double elapsed)
+{
+	std::cout << std::setw(16) << std::left << name << std::setw(10) << what << std::right << std::fixed
+		<< std::setprecision(3) << std::setw(10) << elapsed * 1e3 << " ms" << std::endl;
+}
+
+template <class L>
+static long		run(const char *name)
+{
+	L					a;
+	L					b;
+	long				sink = 0;
+	double				start;
+	typename L::iterator	it;
+
+	for (int i = 0; i < COUNT; ++i)
+	{
+		a.push_back(i);
+		b.push_front(i);
+	}
+	start = now();
+	for (int pass = 0; pass < PASSES; ++pass)
+		for (typename L::iterator cur = a.begin(); cur != a.end(); ++cur)
+			sink += *cur;
+	report(name, "traverse", now() - start);
+	it = a.begin();
+	for (int i = 0; i < COUNT / 2; ++i)
+		++it;
+	start = now();
+	// 넣은 원소 다음으로 커서를 옮겨 가며 가운데에 계속 넣는다
+	for (int i = 0; i < INSERTS; ++i)
+	{
+		it = a.insert(it, i);
+		++it;
+		if ((i & 7) == 7)
+			++it;
+	}
+	report(name, "insert", now() - start);
+	start = now();
+	for (int pass = 0; pass < PASSES; ++pass)
+		for (typename L::iterator cur = a.begin(); cur != a.end(); ++cur)
+			sink += *cur;
+	report(name, "traverse", now() - start);
+	return (sink + b.front());
+}
+
+int		main()
+{
+	long	sink = 0;
+
+	sink += run<ft::List<int> >("ft::List");
+	sink += run<ft::UnrolledList<int> >("UnrolledList");
+	std::cout << "(" << sink << ")" << std::endl;
+	return (0);
+}
@@ -0,0 +1,384 @@
+#ifndef ALGORITHM_HPP
+# define ALGORITHM_HPP
+
+# include <cstddef>
+# include "utils.hpp"
+# include "Vector.hpp"
+# include "VectorIterator.hpp"
+
+namespace ft
+{
+	// 임의 접근 구간(VectorIterator, 포인터)에 대한 정렬 알고리즘
+	// 이터레이터를 포인터로 바꿔서 포인터 위에서만 돈다.
+	namespace detail
+	{
+		template <typename T>
+		T					*raw(T *p)
+		{ return (p); }
+
+		template <typename T>
+		T					*raw(const VectorIterator<T> &it)
+		{ return (it._element); }
+
+		template <typename T>
+		T					*advance(T *p, size_t n)
+		{ return (p + n); }
+
+		template <typename T>
+		VectorIterator<T>	advance(const VectorIterator<T> &it, size_t n)
+		{ return (VectorIterator<T>(it._element + n)); }
+
+		// 이터레이터가 가리키는 원소 타입
+		template <typename Iterator>
+		struct RawType;
+
+		template <typename T>
+		struct RawType<T *>
+		{ typedef T		type; };
+
+		template <typename T>
+		struct RawType<VectorIterator<T> >
+		{ typedef T		type; };
+
+		enum
+		{
+			// 이보다 짧은 구간은 삽입 정렬
+			INSERTION_THRESHOLD = 16,
+			// 이보다 긴 구간은 아홉 개 중 중앙값(ninther)으로 피벗을 고른다
+			NINTHER_THRESHOLD = 128,
+			// stable_sort가 처음에 삽입 정렬로 만드는 조각의 길이
+			MERGE_RUN = 32
+		};
+
+		template <class T, class Compare>
+		void	insertion_sort(T *first, T *last, Compare comp)
+		{
+			if (first == last)
+				return ;
+			for (T *i = first + 1; i < last; ++i)
+			{
+				T	value = *i;
+				T	*hole = i;
+
+				// 같은 값은 넘지 않으므로 안정 정렬
+				while (hole > first && comp(value, *(hole - 1)))
+				{
+					*hole = *(hole - 1);
+					--hole;
+				}
+				*hole = value;
+			}
+		}
+
+		// 이진 힙 (맨 앞이 가장 큰 원소)
+
+		// hole에서 시작해 자식 쪽으로 내려가며 value 자리를 찾는다
+		template <class T, class Compare>
+		void	sift_down(T *first, ptrdiff_t hole, ptrdiff_t len, T value, Compare comp)
+		{
+			ptrdiff_t	child;
+
+			while ((child = 2 * hole + 1) < len)
+			{
+				if (child + 1 < len && comp(first[child], first[child + 1]))
+					++child;
+				if (!comp(value, first[child]))
+					break ;
+				first[hole] = first[child];
+				hole = child;
+			}
+			first[hole] = value;
+		}
+
+		template <class T, class Compare>
+		void	make_heap(T *first, T *last, Compare comp)
+		{
+			ptrdiff_t	len = last - first;
+
+			for (ptrdiff_t i = len / 2 - 1; i >= 0; --i)
+				sift_down(first, i, len, T(first[i]), comp);
+		}
+
+		// 힙에서 가장 큰 원소를 하나씩 뒤로 보낸다
+		template <class T, class Compare>
+		void	sort_heap(T *first, T *last, Compare comp)
+		{
+			while (last - first > 1)
+			{
+				--last;
+				T	value = *last;
+
+				*last = *first;
+				sift_down(first, 0, last - first, value, comp);
+			}
+		}
+
+		// [first, middle)에 가장 작은 원소들을 정렬해서 모은다
+		template <class T, class Compare>
+		void	partial_sort(T *first, T *middle, T *last, Compare comp)
+		{
+			make_heap(first, middle, comp);
+			for (T *i = middle; i < last; ++i)
+			{
+				if (comp(*i, *first))
+				{
+					T	value = *i;
+
+					*i = *first;
+					sift_down(first, 0, middle - first, value, comp);
+				}
+			}
+			sort_heap(first, middle, comp);
+		}
+
+		template <class T, class Compare>
+		T		*median_of_3(T *a, T *b, T *c, Compare comp)
+		{
+			if (comp(*a, *b))
+			{
+				if (comp(*b, *c))
+					return (b);
+				return (comp(*a, *c) ? c : a);
+			}
+			if (comp(*a, *c))
+				return (a);
+			return (comp(*b, *c) ? c : b);
+		}
+
+		// 피벗을 골라 *first로 옮긴다. 나머지 후보 중 피벗 이하와 이상인 원소가 [first + 1, last)에
+		// 남으므로 partition이 경계 검사 없이 멈춘다
+		template <class T, class Compare>
+		void	move_pivot_to_first(T *first, T *last, Compare comp)
+		{
+			ptrdiff_t	len = last - first;
+			T			*mid = first + len / 2;
+			T			*pivot;
+
+			if (len > NINTHER_THRESHOLD)
+			{
+				ptrdiff_t	s = len / 8;
+
+				pivot = median_of_3(
+					median_of_3(first + 1, first + 1 + s, first + 1 + 2 * s, comp),
+					median_of_3(mid - s, mid, mid + s, comp),
+					median_of_3(last - 1 - 2 * s, last - 1 - s, last - 1, comp), comp);
+			}
+			else
+				pivot = median_of_3(first + 1, mid, last - 1, comp);
+			ft::swap(*first, *pivot);
+		}
+
+		// *first를 피벗으로 Hoare 분할, 오른쪽 부분의 시작을 반환
+		// 피벗과 같은 원소에서 양쪽이 다 멈추므로 같은 값이 많아도 반씩 나뉜다
+		template <class T, class Compare>
+		T		*partition(T *first, T *last, Compare comp)
+		{
+			T	*lo = first + 1;
+			T	*hi = last;
+
+			while (true)
+			{
+				while (comp(*lo, *first))
+					++lo;
+				--hi;
+				while (comp(*first, *hi))
+					--hi;
+				if (!(lo < hi))
+					return (lo);
+				ft::swap(*lo, *hi);
+				++lo;
+			}
+		}
+
+		// 재귀 깊이가 depth를 넘으면 힙 정렬로 바꿔 최악에도 O(n log n)
+		template <class T, class Compare>
+		void	introsort(T *first, T *last, int depth, Compare comp)
+		{
+			T	*cut;
+
+			while (last - first > INSERTION_THRESHOLD)
+			{
+				if (depth == 0)
+				{
+					partial_sort(first, last, last, comp);
+					return ;
+				}
+				--depth;
+				move_pivot_to_first(first, last, comp);
+				cut = partition(first, last, comp);
+				// 짧은 쪽으로 재귀해서 스택 깊이를 log n으로 묶는다
+				if (cut - first < last - cut)
+				{
+					introsort(first, cut, depth, comp);
+					first = cut;
+				}
+				else
+				{
+					introsort(cut, last, depth, comp);
+					last = cut;
+				}
+			}
+			insertion_sort(first, last, comp);
+		}
+
+		inline int	depth_limit(ptrdiff_t n)
+		{
+			int		lg = 0;
+
+			while (n > 1)
+			{
+				n >>= 1;
+				++lg;
+			}
+			return (2 * lg);
+		}
+
+		template <class T, class Compare>
+		void	nth_element(T *first, T *nth, T *last, Compare comp)
+		{
+			int		depth = depth_limit(last - first);
+			T		*cut;
+
+			while (last - first > 3)
+			{
+				if (depth == 0)
+				{
+					// [first, nth]에 가장 작은 원소들을 모으면 *nth가 제자리
+					partial_sort(first, nth + 1, last, comp);
+					return ;
+				}
+				--depth;
+				move_pivot_to_first(first, last, comp);
+				cut = partition(first, last, comp);
+				if (cut <= nth)
+					first = cut;
+				else
+					last = cut;
+			}
+			insertion_sort(first, last, comp);
+		}
+
+		// 정렬된 [a, a_end)와 [b, b_end)를 out에 합친다. 같으면 앞쪽 것이 먼저
+		template <class T, class Compare>
+		T		*merge(T *a, T *a_end, T *b, T *b_end, T *out, Compare comp)
+		{
+			while (a < a_end && b < b_end)
+			{
+				if (comp(*b, *a))
+					*out++ = *b++;
+				else
+					*out++ = *a++;
+			}
+			while (a < a_end)
+				*out++ = *a++;
+			while (b < b_end)
+				*out++ = *b++;
+			return (out);
+		}
+
+		// 아래에서 위로 합병 정렬, 원래 구간과 버퍼를 번갈아 쓴다
+		template <class T, class Compare>
+		void	stable_sort(T *first, T *last, Compare comp)
+		{
+			ptrdiff_t		n = last - first;
+			ft::Vector<T>	buffer;
+			T				*src;
+			T				*dst;
+			T				*tmp;
+
+			for (T *run = first; run < last; run += MERGE_RUN)
+				insertion_sort(run, last - run > MERGE_RUN ? run + MERGE_RUN : last, comp);
+			if (n <= MERGE_RUN)
+				return ;
+			buffer.assign(first, last);
+			src = first;
+			dst = &buffer[0];
+			for (ptrdiff_t width = MERGE_RUN; width < n; width *= 2)
+			{
+				for (ptrdiff_t lo = 0; lo < n; lo += 2 * width)
+				{
+					ptrdiff_t	mid = lo + width < n ? lo + width : n;
+					ptrdiff_t	hi = lo + 2 * width < n ? lo + 2 * width : n;
+
+					merge(src + lo, src + mid, src + mid, src + hi, dst + lo, comp);
+				}
+				tmp = src;
+				src = dst;
+				dst = tmp;
+			}
+			if (src != first)
+			{
+				for (ptrdiff_t i = 0; i < n; ++i)
+					first[i] = src[i];
+			}
+		}
+	}
+
+	// introsort, 같은 원소의 순서는 지키지 않는다
+	template <class RandomIterator, class Compare>
+	void	sort(RandomIterator first, RandomIterator last, Compare comp)
+	{
+		typedef typename detail::RawType<RandomIterator>::type	T;
+		T	*f = detail::raw(first);
+		T	*l = detail::raw(last);
+
+		detail::introsort(f, l, detail::depth_limit(l - f), comp);
+	}
+
+	template <class RandomIterator>
+	void	sort(RandomIterator first, RandomIterator last)
+	{
+		typedef typename detail::RawType<RandomIterator>::type	T;
+
+		ft::sort(first, last, ft::less<T>());
+	}
+
+	// 합병 정렬, 같은 원소는 원래 순서를 지킨다. 구간 크기만큼 버퍼를 쓴다
+	template <class RandomIterator, class Compare>
+	void	stable_sort(RandomIterator first, RandomIterator last, Compare comp)
+	{
+		detail::stable_sort(detail::raw(first), detail::raw(last), comp);
+	}
+
+	template <class RandomIterator>
+	void	stable_sort(RandomIterator first, RandomIterator last)
+	{
+		typedef typename detail::RawType<RandomIterator>::type	T;
+
+		ft::stable_sort(first, last, ft::less<T>());
+	}
+
+	// [first, middle)에 가장 작은 middle - first개를 정렬해서 둔다. 나머지 순서는 정해지지 않는다
+	template <class RandomIterator, class Compare>
+	void	partial_sort(RandomIterator first, RandomIterator middle, RandomIterator last, Compare comp)
+	{
+		detail::partial_sort(detail::raw(first), detail::raw(middle), detail::raw(last), comp);
+	}
+
+	template <class RandomIterator>
+	void	partial_sort(RandomIterator first, RandomIterator middle, RandomIterator last)
+	{
+		typedef typename detail::RawType<RandomIterator>::type	T;
+
+		ft::partial_sort(first, middle, last, ft::less<T>());
+	}
+
+	// *nth에 정렬했을 때 올 원소를 두고, 앞은 그 이하, 뒤는 그 이상으로 나눈다. 평균 O(n)
+	template <class RandomIterator, class Compare>
+	void	nth_element(RandomIterator first, RandomIterator nth, RandomIterator last, Compare comp)
+	{
+		if (detail::raw(nth) == detail::raw(last))
+			return ;
+		detail::nth_element(detail::raw(first), detail::raw(nth), detail::raw(last), comp);
+	}
+
+	template <class RandomIterator>
+	void	nth_element(RandomIterator first, RandomIterator nth, RandomIterator last)
+	{
+		typedef typename detail::RawType<RandomIterator>::type	T;
+
+		ft::nth_element(first, nth, last, ft::less<T>());
+	}
+}
+
+#endif
@@ -0,0 +1,337 @@
+#ifndef ARENA_ALLOCATOR_HPP
+# define ARENA_ALLOCATOR_HPP
+
+# include <new>
+# include <cstddef>
+# include <limits>
+
+namespace ft
+{
+	// 한 방향으로만 늘어나는 메모리 구역
+	// 현재 블록의 커서를 밀어서 할당하고, 블록이 모자라면 더 큰 블록을 힙에서 받아 사슬로 잇는다.
+	// 하나씩 돌려주지 않고 reset()으로 한 번에 되돌린다. 받아 둔 블록은 reset() 뒤에도 다시 쓰고
+	// release()나 소멸자에서 힙에 돌려준다.
+	// 처음 쓸 버퍼를 넘겨주면(InlineArena) 그 안에서 끝나는 동안은 힙을 전혀 쓰지 않는다.
+	// 스레드 하나에서만 쓴다.
+	class Arena
+	{
+	public:
+		enum { DEFAULT_BLOCK = 4096, MAX_BLOCK = 1 << 20 };
+
+	private:
+		// 힙 블록 머리, 바로 뒤부터 데이터
+		struct Block
+		{
+			Block	*next;
+			size_t	size;
+			// 데이터가 가장 엄격한 정렬에 맞게 시작하도록
+			union
+			{
+				long double	ld;
+				void		*p;
+				long long	ll;
+			}		align;
+		};
+
+		char		*_inline;
+		size_t		_inline_size;
+		// 처음 받은 힙 블록과 지금 쓰는 힙 블록 (인라인 버퍼를 쓰는 중이면 0)
+		Block		*_first;
+		Block		*_current;
+		char		*_cur;
+		char		*_end;
+		size_t		_next_size;
+		size_t		_used;
+		size_t		_heap_bytes;
+		size_t		_heap_blocks;
+
+	public:
+		explicit Arena(size_t block_size = DEFAULT_BLOCK)
+			: _inline(0), _inline_size(0), _first(0), _current(0), _cur(0), _end(0),
+			_next_size(block_size), _used(0), _heap_bytes(0), _heap_blocks(0)
+		{
+		}
+
+		// buffer를 먼저 쓰고, 다 차면 힙 블록으로 넘어간다. buffer는 Arena보다 오래 살아야 한다
+		Arena(void *buffer, size_t size, size_t block_size = DEFAULT_BLOCK)
+			: _inline(static_cast<char *>(buffer)), _inline_size(size), _first(0), _current(0),
+			_cur(_inline), _end(_inline + size), _next_size(block_size), _used(0), _heap_bytes(0), _heap_blocks(0)
+		{
+		}
+
+		~Arena()
+		{
+			release();
+		}
+
+		// align은 2의 거듭제곱
+		void	*allocate(size_t bytes, size_t align)
+		{
+			char	*p = align_up(_cur, align);
+
+			if (p + bytes > _end || p < _cur)
+				p = next_block(bytes, align);
+			_cur = p + bytes;
+			_used += bytes;
+			return (p);
+		}
+
+		// 가장 최근 할당이면 커서를 되돌린다. 아니면 reset()까지 그대로 둔다
+		void	deallocate(void *p, size_t bytes)
+		{
+			if (static_cast<char *>(p) + bytes == _cur)
+			{
+				_cur = static_cast<char *>(p);
+				_used -= bytes;
+			}
+		}
+
+		// 모든 할당을 한 번에 무효로 한다. 블록은 남겨 두고 처음부터 다시 쓴다
+		void	reset()
+		{
+			_used = 0;
+			if (_inline)
+			{
+				_current = 0;
+				_cur = _inline;
+				_end = _inline + _inline_size;
+			}
+			else
+				enter(_first);
+		}
+
+		// reset()에 더해 힙 블록을 모두 돌려준다
+		void	release()
+		{
+			Block	*b = _first;
+			Block	*next;
+
+			while (b)
+			{
+				next = b->next;
+				::operator delete(b);
+				b = next;
+			}
+			_first = 0;
+			_heap_bytes = 0;
+			_heap_blocks = 0;
+			reset();
+		}
+
+		// 지금 살아 있는 할당의 바이트 수 (정렬 때문에 생긴 빈틈은 빼고)
+		size_t	used() const
+		{ return (_used); }
+
+		// 힙에서 받아 둔 블록 수와 바이트 수
+		size_t	heap_blocks() const
+		{ return (_heap_blocks); }
+
+		size_t	heap_bytes() const
+		{ return (_heap_bytes); }
+
+	private:
+		Arena(const Arena &);
+		Arena	&operator=(const Arena &);
+
+		static char	*align_up(char *p, size_t align)
+		{
+			size_t	addr = reinterpret_cast<size_t>(p);
+
+			return (p + ((align - (addr & (align - 1))) & (align - 1)));
+		}
+
+		static char	*data(Block *b)
+		{ return (reinterpret_cast<char *>(&b->align)); }
+
+		void	enter(Block *b)
+		{
+			_current = b;
+			_cur = b ? data(b) : 0;
+			_end = b ? data(b) + b->size : 0;
+		}
+
+		// 다음 블록으로 넘어간다. reset() 전에 받아 둔 블록이 충분히 크면 그것을 다시 쓴다
+		char	*next_block(size_t bytes, size_t align)
+		{
+			Block	*next = _current ? _current->next : _first;
+			Block	*b;
+			size_t	size;
+
+			if (next && next->size >= bytes + align)
+			{
+				enter(next);
+				return (align_up(_cur, align));
+			}
+			size = _next_size;
+			while (size < bytes + align)
+				size *= 2;
+			if (_next_size < MAX_BLOCK)
+				_next_size *= 2;
+			b = static_cast<Block *>(::operator new(sizeof(Block) + size));
+			b->size = size;
+			// 지금 블록 바로 뒤에 끼워서, 크기가 모자라 건너뛴 블록은 다음 reset() 뒤에 다시 쓴다
+			b->next = next;
+			if (_current)
+				_current->next = b;
+			else
+				_first = b;
+			_heap_bytes += size;
+			++_heap_blocks;
+			enter(b);
+			return (align_up(_cur, align));
+		}
+	};
+
+	// Size 바이트 버퍼를 안에 품은 Arena. 지역 변수로 두면 그 크기까지는 스택에서 할당한다
+	template <size_t Size>
+	class InlineArena : public Arena
+	{
+	private:
+		union Storage
+		{
+			char		bytes[Size];
+			long double	ld;
+			void		*p;
+			long long	ll;
+		};
+
+		Storage		_storage;
+
+	public:
+		explicit InlineArena(size_t block_size = DEFAULT_BLOCK) : Arena(_storage.bytes, Size, block_size)
+		{
+		}
+	};
+
+	// Arena에서 할당하는 할당자. deallocate는 (가장 최근 할당이 아니면) 아무것도 하지 않는다
+	// 컨테이너가 rebind해도 같은 Arena를 가리키므로 Vector, List, Map의 Alloc 인자로 쓸 수 있다.
+	// Arena::reset() 전에 그 Arena를 쓰는 컨테이너를 먼저 없애야 한다. 기본 생성자로 만들면
+	// Arena 없이 operator new/delete를 쓴다.
+	template <typename T>
+	class ArenaAllocator
+	{
+	public:
+		typedef T				value_type;
+		typedef T*				pointer;
+		typedef const T*		const_pointer;
+		typedef T&				reference;
+		typedef const T&		const_reference;
+		typedef size_t			size_type;
+		typedef ptrdiff_t		difference_type;
+
+		template <typename U>
+		struct rebind
+		{
+			typedef ArenaAllocator<U>	other;
+		};
+
+	private:
+		Arena		*_arena;
+
+	public:
+		ArenaAllocator() : _arena(0)
+		{
+		}
+
+		ArenaAllocator(Arena &arena) : _arena(&arena)
+		{
+		}
+
+		ArenaAllocator(const ArenaAllocator &copy) : _arena(copy._arena)
+		{
+		}
+
+		template <typename U>
+		ArenaAllocator(const ArenaAllocator<U> &copy) : _arena(copy.arena())
+		{
+		}
+
+		ArenaAllocator	&operator=(const ArenaAllocator &ref)
+		{
+			_arena = ref._arena;
+			return (*this);
+		}
+
+		~ArenaAllocator()
+		{
+		}
+
+		pointer			address(reference x) const
+		{
+			return (&x);
+		}
+
+		const_pointer	address(const_reference x) const
+		{
+			return (&x);
+		}
+
+		// 0개 할당(Vector 기본 생성자)은 Arena를 건드리지 않는다
+		pointer			allocate(size_type n, const void *hint = 0)
+		{
+			(void)hint;
+			if (n == 0)
+				return (0);
+			if (n > max_size())
+				throw (std::bad_alloc());
+			if (!_arena)
+				return (static_cast<pointer>(::operator new(n * sizeof(T))));
+			return (static_cast<pointer>(_arena->allocate(n * sizeof(T), alignment())));
+		}
+
+		void			deallocate(pointer p, size_type n)
+		{
+			if (!p)
+				return ;
+			if (!_arena)
+				::operator delete(p);
+			else
+				_arena->deallocate(p, n * sizeof(T));
+		}
+
+		size_type		max_size() const
+		{
+			return (std::numeric_limits<size_type>::max() / sizeof(T));
+		}
+
+		void			construct(pointer p, const value_type &val)
+		{
+			new (static_cast<void *>(p)) T(val);
+		}
+
+		void			destroy(pointer p)
+		{
+			p->~T();
+		}
+
+		Arena			*arena() const
+		{
+			return (_arena);
+		}
+
+		friend bool operator==(const ArenaAllocator &lhs, const ArenaAllocator &rhs)
+		{
+			return (lhs._arena == rhs._arena);
+		}
+
+		friend bool operator!=(const ArenaAllocator &lhs, const ArenaAllocator &rhs)
+		{
+			return (!(lhs == rhs));
+		}
+
+	private:
+		// T의 정렬: char 하나 뒤에 T를 두면 T 앞에 정렬만큼 빈틈이 생긴다
+		struct AlignProbe
+		{
+			char	c;
+			T		t;
+		};
+
+		static size_t	alignment()
+		{
+			return (sizeof(AlignProbe) - sizeof(T));
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,145 @@
+#ifndef BITS_HPP
+# define BITS_HPP
+
+# include <cstddef>
+# include <climits>
+
+namespace ft
+{
+	namespace detail
+	{
+		// Vector<bool>과 Bitset이 같이 쓰는 비트 배열 도우미
+		// 비트 i는 워드 i / WORD_BITS의 (i % WORD_BITS)번째 비트에 있다. 크기를 넘는 마지막 워드의
+		// 나머지 비트는 언제나 0으로 둔다. 그래야 count, find, 비교가 워드 단위로 끝난다.
+		// 워드 루프는 -O2 이상에서 컴파일러가 SIMD로 묶고, popcount는 -mpopcnt면 명령 하나가 된다.
+		typedef unsigned long	bit_word;
+
+		enum { WORD_BITS = sizeof(bit_word) * CHAR_BIT };
+
+		inline size_t		words_for(size_t bits)
+		{ return ((bits + WORD_BITS - 1) / WORD_BITS); }
+
+		inline bit_word		bit_mask(size_t pos)
+		{ return (bit_word(1) << (pos % WORD_BITS)); }
+
+		// 크기가 bits일 때 마지막 워드에서 쓰는 비트들
+		inline bit_word		tail_mask(size_t bits)
+		{ return (bits % WORD_BITS ? ~bit_word(0) >> (WORD_BITS - bits % WORD_BITS) : ~bit_word(0)); }
+
+		inline size_t		popcount(bit_word w)
+		{ return (__builtin_popcountl(w)); }
+
+		inline size_t		count_bits(const bit_word *w, size_t words)
+		{
+			size_t	ret = 0;
+
+			for (size_t i = 0; i < words; ++i)
+				ret += popcount(w[i]);
+			return (ret);
+		}
+
+		// [pos, bits)에서 처음 1인 비트, 없으면 bits
+		inline size_t		find_bit(const bit_word *w, size_t pos, size_t bits)
+		{
+			size_t		i;
+			size_t		words;
+			bit_word	cur;
+
+			if (pos >= bits)
+				return (bits);
+			i = pos / WORD_BITS;
+			words = words_for(bits);
+			cur = w[i] & (~bit_word(0) << (pos % WORD_BITS));
+			while (!cur)
+			{
+				if (++i == words)
+					return (bits);
+				cur = w[i];
+			}
+			return (i * WORD_BITS + __builtin_ctzl(cur));
+		}
+
+		// [first, last)를 val로 채운다. 가운데 워드는 통째로 쓴다
+		inline void			fill_bits(bit_word *w, size_t first, size_t last, bool val)
+		{
+			size_t		lo;
+			size_t		hi;
+			bit_word	lo_mask;
+			bit_word	hi_mask;
+
+			if (first >= last)
+				return ;
+			lo = first / WORD_BITS;
+			hi = (last - 1) / WORD_BITS;
+			lo_mask = ~bit_word(0) << (first % WORD_BITS);
+			hi_mask = tail_mask(last);
+			if (lo == hi)
+				lo_mask &= hi_mask;
+			w[lo] = val ? w[lo] | lo_mask : w[lo] & ~lo_mask;
+			if (lo == hi)
+				return ;
+			for (size_t i = lo + 1; i < hi; ++i)
+				w[i] = val ? ~bit_word(0) : 0;
+			w[hi] = val ? w[hi] | hi_mask : w[hi] & ~hi_mask;
+		}
+
+		// 앞 비트부터 사전식으로 비교한다 (0 < 1). 음수, 0, 양수
+		inline int			compare_bits(const bit_word *a, size_t a_bits, const bit_word *b, size_t b_bits)
+		{
+			size_t		n = a_bits < b_bits ? a_bits : b_bits;
+			size_t		words = words_for(n);
+			bit_word	diff;
+
+			for (size_t i = 0; i < words; ++i)
+			{
+				diff = a[i] ^ b[i];
+				if (i + 1 == words)
+					diff &= tail_mask(n);
+				if (diff)
+					return ((b[i] >> __builtin_ctzl(diff)) & 1 ? -1 : 1);
+			}
+			if (a_bits == b_bits)
+				return (0);
+			return (a_bits < b_bits ? -1 : 1);
+		}
+
+		// 비트 하나를 가리키는 참조. 읽으면 bool, 대입하면 그 비트만 바꾼다
+		class bit_reference
+		{
+		private:
+			bit_word	*_word;
+			bit_word	_mask;
+
+		public:
+			bit_reference(bit_word *word, bit_word mask) : _word(word), _mask(mask)
+			{
+			}
+
+			operator bool() const
+			{ return ((*_word & _mask) != 0); }
+
+			bool			operator~ () const
+			{ return ((*_word & _mask) == 0); }
+
+			bit_reference	&operator= (bool x)
+			{
+				if (x)
+					*_word |= _mask;
+				else
+					*_word &= ~_mask;
+				return (*this);
+			}
+
+			bit_reference	&operator= (const bit_reference &x)
+			{ return (*this = static_cast<bool>(x)); }
+
+			bit_reference	&flip()
+			{
+				*_word ^= _mask;
+				return (*this);
+			}
+		};
+	}
+}
+
+#endif
@@ -0,0 +1,284 @@
+#ifndef BITSET_HPP
+# define BITSET_HPP
+
+# include <cstddef>
+# include <string>
+# include <stdexcept>
+# include "Bits.hpp"
+
+namespace ft
+{
+	// 크기가 N비트로 정해진 비트 집합. std::bitset과 같은 API에 Vector<bool>의
+	// find_first/find_next, set_range/reset_range를 더했다. 워드 배열을 객체 안에 품으므로 할당이 없다
+	template <size_t N>
+	class Bitset
+	{
+	public:
+		typedef detail::bit_reference	reference;
+		typedef detail::bit_word		word_type;
+		typedef size_t					size_type;
+
+		static const size_type	npos = static_cast<size_type>(-1);
+
+	private:
+		enum { WORDS = N ? (N + detail::WORD_BITS - 1) / detail::WORD_BITS : 1 };
+
+		word_type	_words[WORDS];
+
+	public:
+		Bitset()
+		{
+			reset();
+		}
+
+		// 낮은 비트부터 val의 비트로 채운다
+		Bitset(unsigned long val)
+		{
+			reset();
+			_words[0] = val;
+			trim();
+		}
+
+		// 맨 오른쪽 글자가 비트 0이다. '0', '1' 말고 다른 글자가 있으면 std::invalid_argument
+		explicit Bitset(const std::string &str)
+		{
+			size_type	len = str.size() < N ? str.size() : N;
+
+			reset();
+			for (size_type i = 0; i < len; ++i)
+			{
+				char	c = str[len - 1 - i];
+
+				if (c != '0' && c != '1')
+					throw (std::invalid_argument("bitset::_M_copy_from_ptr"));
+				if (c == '1')
+					_words[i / detail::WORD_BITS] |= detail::bit_mask(i);
+			}
+		}
+
+		bool				operator[](size_type pos) const
+		{ return ((_words[pos / detail::WORD_BITS] & detail::bit_mask(pos)) != 0); }
+
+		reference			operator[](size_type pos)
+		{ return (reference(_words + pos / detail::WORD_BITS, detail::bit_mask(pos))); }
+
+		bool				test(size_type pos) const
+		{
+			check(pos);
+			return ((*this)[pos]);
+		}
+
+		size_type			size() const
+		{ return (N); }
+
+		size_type			count() const
+		{ return (detail::count_bits(_words, WORDS)); }
+
+		bool				any() const
+		{ return (find_first() != npos); }
+
+		bool				none() const
+		{ return (!any()); }
+
+		bool				all() const
+		{ return (count() == N); }
+
+		// 처음 1인 위치, 없으면 npos
+		size_type			find_first() const
+		{ return (found(detail::find_bit(_words, 0, N))); }
+
+		// pos 뒤로 처음 1인 위치, 없으면 npos
+		size_type			find_next(size_type pos) const
+		{ return (pos >= N ? npos : found(detail::find_bit(_words, pos + 1, N))); }
+
+		Bitset				&set()
+		{
+			detail::fill_bits(_words, 0, N, true);
+			return (*this);
+		}
+
+		Bitset				&set(size_type pos, bool val = true)
+		{
+			check(pos);
+			(*this)[pos] = val;
+			return (*this);
+		}
+
+		// [first, last)를 val로
+		Bitset				&set_range(size_type first, size_type last, bool val = true)
+		{
+			if (first > last || last > N)
+				throw (std::out_of_range("ft::Bitset::set_range"));
+			detail::fill_bits(_words, first, last, val);
+			return (*this);
+		}
+
+		Bitset				&reset()
+		{
+			for (size_type i = 0; i < WORDS; ++i)
+				_words[i] = 0;
+			return (*this);
+		}
+
+		Bitset				&reset(size_type pos)
+		{ return (set(pos, false)); }
+
+		Bitset				&reset_range(size_type first, size_type last)
+		{ return (set_range(first, last, false)); }
+
+		Bitset				&flip()
+		{
+			for (size_type i = 0; i < WORDS; ++i)
+				_words[i] = ~_words[i];
+			trim();
+			return (*this);
+		}
+
+		Bitset				&flip(size_type pos)
+		{
+			check(pos);
+			(*this)[pos].flip();
+			return (*this);
+		}
+
+		// 비트 0이 가장 낮은 자리. 넘치면 std::overflow_error
+		unsigned long		to_ulong() const
+		{
+			for (size_type i = 1; i < WORDS; ++i)
+				if (_words[i])
+					throw (std::overflow_error("bitset::to_ulong"));
+			return (_words[0]);
+		}
+
+		// 맨 앞 글자가 비트 N - 1이다
+		std::string			to_string() const
+		{
+			std::string	ret(N, '0');
+
+			for (size_type i = find_first(); i != npos; i = find_next(i))
+				ret[N - 1 - i] = '1';
+			return (ret);
+		}
+
+		Bitset				&operator&=(const Bitset &x)
+		{
+			for (size_type i = 0; i < WORDS; ++i)
+				_words[i] &= x._words[i];
+			return (*this);
+		}
+
+		Bitset				&operator|=(const Bitset &x)
+		{
+			for (size_type i = 0; i < WORDS; ++i)
+				_words[i] |= x._words[i];
+			return (*this);
+		}
+
+		Bitset				&operator^=(const Bitset &x)
+		{
+			for (size_type i = 0; i < WORDS; ++i)
+				_words[i] ^= x._words[i];
+			return (*this);
+		}
+
+		// 비트 i가 i + n으로 간다
+		Bitset				&operator<<=(size_type n)
+		{
+			size_type	shift = n / detail::WORD_BITS;
+			size_type	bits = n % detail::WORD_BITS;
+
+			if (n >= N)
+				return (reset());
+			for (size_type i = WORDS; i-- > 0; )
+			{
+				word_type	w = 0;
+
+				if (i >= shift)
+				{
+					w = _words[i - shift] << bits;
+					if (bits && i > shift)
+						w |= _words[i - shift - 1] >> (detail::WORD_BITS - bits);
+				}
+				_words[i] = w;
+			}
+			trim();
+			return (*this);
+		}
+
+		// 비트 i가 i - n으로 간다
+		Bitset				&operator>>=(size_type n)
+		{
+			size_type	shift = n / detail::WORD_BITS;
+			size_type	bits = n % detail::WORD_BITS;
+
+			if (n >= N)
+				return (reset());
+			for (size_type i = 0; i < WORDS; ++i)
+			{
+				word_type	w = 0;
+
+				if (i + shift < WORDS)
+				{
+					w = _words[i + shift] >> bits;
+					if (bits && i + shift + 1 < WORDS)
+						w |= _words[i + shift + 1] << (detail::WORD_BITS - bits);
+				}
+				_words[i] = w;
+			}
+			return (*this);
+		}
+
+		Bitset				operator<<(size_type n) const
+		{ return (Bitset(*this) <<= n); }
+
+		Bitset				operator>>(size_type n) const
+		{ return (Bitset(*this) >>= n); }
+
+		Bitset				operator~() const
+		{ return (Bitset(*this).flip()); }
+
+		friend Bitset		operator&(const Bitset &lhs, const Bitset &rhs)
+		{ return (Bitset(lhs) &= rhs); }
+
+		friend Bitset		operator|(const Bitset &lhs, const Bitset &rhs)
+		{ return (Bitset(lhs) |= rhs); }
+
+		friend Bitset		operator^(const Bitset &lhs, const Bitset &rhs)
+		{ return (Bitset(lhs) ^= rhs); }
+
+		friend bool			operator==(const Bitset &lhs, const Bitset &rhs)
+		{
+			for (size_type i = 0; i < WORDS; ++i)
+				if (lhs._words[i] != rhs._words[i])
+					return (false);
+			return (true);
+		}
+
+		friend bool			operator!=(const Bitset &lhs, const Bitset &rhs)
+		{ return (!(lhs == rhs)); }
+
+	private:
+		// N을 넘는 비트를 0으로
+		void				trim()
+		{
+			if (N % detail::WORD_BITS)
+				_words[WORDS - 1] &= detail::tail_mask(N);
+			else if (N == 0)
+				_words[0] = 0;
+		}
+
+		void				check(size_type pos) const
+		{
+			if (pos >= N)
+				throw (std::out_of_range("bitset::test"));
+		}
+
+		size_type			found(size_type pos) const
+		{ return (pos < N ? pos : npos); }
+	};
+
+	template <size_t N>
+	const typename Bitset<N>::size_type	Bitset<N>::npos;
+}
+
+#endif
@@ -0,0 +1,488 @@
+#ifndef CONCURRENT_MAP_HPP
+# define CONCURRENT_MAP_HPP
+
+# include <memory>
+# include <cstddef>
+# include <pthread.h>
+# include "Map.hpp"
+# include "Vector.hpp"
+# include "Hash.hpp"
+# include "utils.hpp"
+
+namespace ft
+{
+	// 키를 해시해서 샤드를 고른다. 샤드 사이에 순서가 없으므로 순서대로 도는 연산은 모든 샤드를 합쳐야 한다.
+	template <class Key, class Hash = ft::hash<Key> >
+	class HashRouter
+	{
+	private:
+		size_t		_shards;
+		Hash		_hash;
+
+	public:
+		explicit HashRouter(size_t shards = 16, const Hash &hash = Hash())
+			: _shards(shards ? shards : 1), _hash(hash)
+		{
+		}
+
+		size_t		shard_count() const
+		{ return (_shards); }
+
+		bool		ordered() const
+		{ return (false); }
+
+		size_t		operator() (const Key &k) const
+		{ return (_hash(k) % _shards); }
+	};
+
+	// 경계 키 n개로 키 공간을 n + 1개 구간으로 나눈다. i번째 샤드는 [splits[i - 1], splits[i]) 구간
+	// 샤드 번호 순서가 키 순서와 같으므로 순서대로 돌 때 샤드를 하나씩만 잠근다.
+	template <class Key, class Compare = ft::less<Key> >
+	class RangeRouter
+	{
+	private:
+		ft::Vector<Key>		_splits;
+		Compare				_comp;
+
+	public:
+		RangeRouter() : _splits(), _comp()
+		{
+		}
+
+		// [first, last)는 정렬되어 있어야 한다
+		template <class InputIterator>
+		RangeRouter(InputIterator first, InputIterator last, const Compare &comp = Compare())
+			: _splits(), _comp(comp)
+		{
+			while (first != last)
+			{
+				_splits.push_back(*first);
+				++first;
+			}
+		}
+
+		size_t		shard_count() const
+		{ return (_splits.size() + 1); }
+
+		bool		ordered() const
+		{ return (true); }
+
+		// k 이하인 경계 키의 수
+		size_t		operator() (const Key &k) const
+		{
+			size_t	lo;
+			size_t	hi;
+			size_t	mid;
+
+			lo = 0;
+			hi = _splits.size();
+			while (lo < hi)
+			{
+				mid = lo + (hi - lo) / 2;
+				if (_comp(k, _splits[mid]))
+					hi = mid;
+				else
+					lo = mid + 1;
+			}
+			return (lo);
+		}
+	};
+
+	// 키 공간을 Router로 나눠 샤드마다 따로 잠그는 Map
+	// 샤드는 pthread_rwlock으로 보호하므로 읽기끼리는 동시에 진행되고, 다른 샤드에 대한 쓰기와도 겹치지 않는다.
+	// 원소를 가리키는 이터레이터는 잠금 밖으로 내보내지 않고 값을 복사해서 돌려준다.
+	// 여러 샤드를 잠글 때는 항상 샤드 번호 순서로 잠근다.
+	template < class Key, class T, class Compare = ft::less<Key>, class Router = ft::HashRouter<Key>,
+				class Alloc = std::allocator<ft::Pair<Key, T> > >
+	class ConcurrentMap
+	{
+	public:
+		typedef Key												key_type;
+		typedef T												mapped_type;
+		typedef ft::Pair<key_type, mapped_type>					value_type;
+		typedef Compare											key_compare;
+		typedef Router											router_type;
+		typedef Alloc											allocator_type;
+		typedef ft::Map<key_type, mapped_type, key_compare, allocator_type>	map_type;
+		typedef size_t											size_type;
+
+		enum { CACHE_LINE = 64 };
+
+	private:
+		typedef typename map_type::iterator						map_iterator;
+
+		// 이웃한 샤드의 잠금이 같은 캐시 라인에 놓이지 않도록 뒤를 채운다
+		struct Shard
+		{
+			pthread_rwlock_t	lock;
+			map_type			map;
+			char				pad[CACHE_LINE];
+
+			Shard(const map_type &m) : map(m)
+			{
+				pthread_rwlock_init(&lock, 0);
+			}
+
+			Shard(const Shard &copy) : map(copy.map)
+			{
+				pthread_rwlock_init(&lock, 0);
+			}
+
+			~Shard()
+			{
+				pthread_rwlock_destroy(&lock);
+			}
+
+		private:
+			Shard	&operator=(const Shard &);
+		};
+
+		typedef typename allocator_type::template
+				rebind<Shard>::other							shard_allocator;
+
+		// 잠금을 잡고 범위를 벗어나면 푼다
+		class ReadGuard
+		{
+		private:
+			pthread_rwlock_t	*_lock;
+
+		public:
+			explicit ReadGuard(Shard &s) : _lock(&s.lock)
+			{ pthread_rwlock_rdlock(_lock); }
+
+			~ReadGuard()
+			{ pthread_rwlock_unlock(_lock); }
+		};
+
+		class WriteGuard
+		{
+		private:
+			pthread_rwlock_t	*_lock;
+
+		public:
+			explicit WriteGuard(Shard &s) : _lock(&s.lock)
+			{ pthread_rwlock_wrlock(_lock); }
+
+			~WriteGuard()
+			{ pthread_rwlock_unlock(_lock); }
+		};
+
+		router_type		_router;
+		key_compare		_key_comp;
+		allocator_type	_allocator;
+		shard_allocator	_shard_allocator;
+		Shard*			_shards;
+		size_type		_shard_count;
+
+	public:
+		explicit ConcurrentMap(const router_type &router = router_type(), const key_compare &comp = key_compare(),
+							const allocator_type &alloc = allocator_type())
+			: _router(router), _key_comp(comp), _allocator(alloc), _shard_allocator(alloc)
+		{
+			map_type	empty(comp, alloc);
+
+			_shard_count = _router.shard_count();
+			_shards = _shard_allocator.allocate(_shard_count);
+			for (size_type i = 0; i < _shard_count; ++i)
+				_shard_allocator.construct(_shards + i, Shard(empty));
+		}
+
+		~ConcurrentMap()
+		{
+			for (size_type i = 0; i < _shard_count; ++i)
+				_shard_allocator.destroy(_shards + i);
+			_shard_allocator.deallocate(_shards, _shard_count);
+		}
+
+		size_type		shard_count() const
+		{
+			return (_shard_count);
+		}
+
+		// 샤드를 하나씩 잠그며 더하므로 동시에 수정 중이면 근삿값
+		size_type		size() const
+		{
+			size_type	ret;
+
+			ret = 0;
+			for (size_type i = 0; i < _shard_count; ++i)
+			{
+				ReadGuard	guard(_shards[i]);
+
+				ret += _shards[i].map.size();
+			}
+			return (ret);
+		}
+
+		bool			empty() const
+		{
+			for (size_type i = 0; i < _shard_count; ++i)
+			{
+				ReadGuard	guard(_shards[i]);
+
+				if (!_shards[i].map.empty())
+					return (false);
+			}
+			return (true);
+		}
+
+		// 같은 키가 있으면 바꾸지 않고 false
+		bool			insert(const value_type &val)
+		{
+			Shard		&shard = _shards[_router(val.first)];
+			WriteGuard	guard(shard);
+
+			return (shard.map.insert(val).second);
+		}
+
+		// 있으면 값을 바꾸고 false, 없으면 넣고 true
+		bool			assign(const key_type &k, const mapped_type &val)
+		{
+			Shard					&shard = _shards[_router(k)];
+			WriteGuard				guard(shard);
+			ft::Pair<map_iterator, bool>	ret;
+
+			ret = shard.map.insert(value_type(k, val));
+			if (!ret.second)
+				ret.first->second = val;
+			return (ret.second);
+		}
+
+		size_type		erase(const key_type &k)
+		{
+			Shard		&shard = _shards[_router(k)];
+			WriteGuard	guard(shard);
+
+			return (shard.map.erase(k));
+		}
+
+		void			clear()
+		{
+			for (size_type i = 0; i < _shard_count; ++i)
+			{
+				WriteGuard	guard(_shards[i]);
+
+				_shards[i].map.clear();
+			}
+		}
+
+		// 찾으면 값을 out에 복사하고 true
+		bool			find(const key_type &k, mapped_type &out) const
+		{
+			Shard			&shard = _shards[_router(k)];
+			ReadGuard		guard(shard);
+			map_iterator	it;
+
+			it = shard.map.find(k);
+			if (it == shard.map.end())
+				return (false);
+			out = it->second;
+			return (true);
+		}
+
+		size_type		count(const key_type &k) const
+		{
+			Shard		&shard = _shards[_router(k)];
+			ReadGuard	guard(shard);
+
+			return (shard.map.count(k));
+		}
+
+		// k 이상인 첫 원소를 out에 복사, 없으면 false
+		bool			lower_bound(const key_type &k, value_type &out) const
+		{
+			return (bound(k, out, false));
+		}
+
+		// k보다 큰 첫 원소를 out에 복사, 없으면 false
+		bool			upper_bound(const key_type &k, value_type &out) const
+		{
+			return (bound(k, out, true));
+		}
+
+		// 키 순서대로 f(const value_type &)를 부른다
+		// 범위 라우팅이면 샤드를 하나씩 읽기 잠금하고, 해시 라우팅이면 모든 샤드를 읽기 잠금한 채로 합친다.
+		// f 안에서 이 맵을 수정하면 안 된다.
+		template <class Function>
+		Function		for_each(Function f) const
+		{
+			if (_router.ordered())
+			{
+				for (size_type i = 0; i < _shard_count; ++i)
+				{
+					ReadGuard		guard(_shards[i]);
+
+					for (map_iterator it = _shards[i].map.begin(); it != _shards[i].map.end(); ++it)
+						f(*it);
+				}
+				return (f);
+			}
+			return (merge_each(f));
+		}
+
+		// 샤드별로 모아서 샤드마다 쓰기 잠금을 한 번만 잡는다. 새로 들어간 개수를 반환
+		size_type		insert_many(const value_type *vals, size_type n)
+		{
+			ft::Vector<size_type>	order;
+			ft::Vector<size_type>	start;
+			size_type				ret;
+
+			group(vals, n, order, start);
+			ret = 0;
+			for (size_type s = 0; s < _shard_count; ++s)
+			{
+				if (start[s] == start[s + 1])
+					continue ;
+				WriteGuard		guard(_shards[s]);
+
+				for (size_type i = start[s]; i < start[s + 1]; ++i)
+				{
+					if (_shards[s].map.insert(vals[order[i]]).second)
+						++ret;
+				}
+			}
+			return (ret);
+		}
+
+		// keys[i]를 찾아서 found[i], values[i]에 채운다. 샤드마다 읽기 잠금을 한 번만 잡는다. 찾은 개수를 반환
+		size_type		find_many(const key_type *keys, size_type n, mapped_type *values, bool *found) const
+		{
+			ft::Vector<size_type>	order;
+			ft::Vector<size_type>	start;
+			map_iterator			it;
+			size_type				ret;
+
+			group(keys, n, order, start);
+			ret = 0;
+			for (size_type s = 0; s < _shard_count; ++s)
+			{
+				if (start[s] == start[s + 1])
+					continue ;
+				ReadGuard		guard(_shards[s]);
+
+				for (size_type i = start[s]; i < start[s + 1]; ++i)
+				{
+					it = _shards[s].map.find(keys[order[i]]);
+					found[order[i]] = (it != _shards[s].map.end());
+					if (found[order[i]])
+					{
+						values[order[i]] = it->second;
+						++ret;
+					}
+				}
+			}
+			return (ret);
+		}
+
+		key_compare		key_comp() const
+		{ return (_key_comp); }
+
+		router_type		router() const
+		{ return (_router); }
+
+		allocator_type	get_allocator() const
+		{ return (_allocator); }
+
+	private:
+		static const key_type	&key_of(const key_type &k)
+		{ return (k); }
+
+		static const key_type	&key_of(const value_type &v)
+		{ return (v.first); }
+
+		// items를 샤드 번호로 계수 정렬한다. s번 샤드의 항목은 order[start[s] .. start[s + 1])
+		template <class Item>
+		void			group(const Item *items, size_type n, ft::Vector<size_type> &order,
+							ft::Vector<size_type> &start) const
+		{
+			ft::Vector<size_type>	shard_of(n, 0);
+			ft::Vector<size_type>	pos;
+
+			start.assign(_shard_count + 1, 0);
+			for (size_type i = 0; i < n; ++i)
+			{
+				shard_of[i] = _router(key_of(items[i]));
+				++start[shard_of[i] + 1];
+			}
+			for (size_type s = 0; s < _shard_count; ++s)
+				start[s + 1] += start[s];
+			pos = start;
+			order.assign(n, 0);
+			for (size_type i = 0; i < n; ++i)
+				order[pos[shard_of[i]]++] = i;
+		}
+
+		bool			bound(const key_type &k, value_type &out, bool upper) const
+		{
+			map_iterator	it;
+			bool			found;
+
+			if (_router.ordered())
+			{
+				// k가 속한 샤드부터 뒤로, 다음 샤드들의 키는 모두 k보다 크다
+				for (size_type i = _router(k); i < _shard_count; ++i)
+				{
+					ReadGuard		guard(_shards[i]);
+
+					it = upper ? _shards[i].map.upper_bound(k) : _shards[i].map.lower_bound(k);
+					if (it != _shards[i].map.end())
+					{
+						out = *it;
+						return (true);
+					}
+				}
+				return (false);
+			}
+			found = false;
+			for (size_type i = 0; i < _shard_count; ++i)
+			{
+				ReadGuard		guard(_shards[i]);
+
+				it = upper ? _shards[i].map.upper_bound(k) : _shards[i].map.lower_bound(k);
+				if (it != _shards[i].map.end() && (!found || _key_comp(it->first, out.first)))
+				{
+					out = *it;
+					found = true;
+				}
+			}
+			return (found);
+		}
+
+		// 모든 샤드를 번호 순서로 읽기 잠금하고 샤드마다의 이터레이터 중 가장 작은 것을 고른다
+		template <class Function>
+		Function		merge_each(Function f) const
+		{
+			ft::Vector<map_iterator>	its;
+			size_type					best;
+
+			for (size_type i = 0; i < _shard_count; ++i)
+			{
+				pthread_rwlock_rdlock(&_shards[i].lock);
+				its.push_back(_shards[i].map.begin());
+			}
+			while (true)
+			{
+				best = _shard_count;
+				for (size_type i = 0; i < _shard_count; ++i)
+				{
+					if (its[i] == _shards[i].map.end())
+						continue ;
+					if (best == _shard_count || _key_comp(its[i]->first, its[best]->first))
+						best = i;
+				}
+				if (best == _shard_count)
+					break ;
+				f(*its[best]);
+				++its[best];
+			}
+			for (size_type i = _shard_count; i > 0; --i)
+				pthread_rwlock_unlock(&_shards[i - 1].lock);
+			return (f);
+		}
+
+		ConcurrentMap(const ConcurrentMap &);
+		ConcurrentMap	&operator=(const ConcurrentMap &);
+	};
+}
+
+#endif
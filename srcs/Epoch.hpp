@@ -0,0 +1,265 @@
+#ifndef EPOCH_HPP
+# define EPOCH_HPP
+
+# include <cstddef>
+# include <pthread.h>
+# include <sched.h>
+# include "Vector.hpp"
+
+namespace ft
+{
+	// epoch 기반 메모리 회수 (EBR)
+	// 읽는 쪽은 EpochGuard로 구간을 감싸고, 그 안에서는 잠금 없이 공유 구조를 읽는다.
+	// 쓰는 쪽은 구조에서 떼어낸 객체를 바로 지우지 않고 retire()로 넘긴다.
+	// 전역 epoch은 활동 중인 모든 읽기 구간이 현재 epoch을 본 뒤에만 하나 올라가므로,
+	// epoch e에 retire된 객체는 전역 epoch이 e + 2가 되면 아무 읽기 구간도 볼 수 없다.
+	//
+	// 읽는 쪽은 자기 슬롯(캐시 라인 하나)에만 쓰므로 다른 스레드와 캐시 라인을 다투지 않는다.
+	// 슬롯은 스레드가 처음 enter()할 때 잡고 스레드가 끝나면 돌려준다. 동시에 MAX_THREADS개까지
+	// 하나의 EpochDomain을 여러 컨테이너가 같이 써도 된다.
+	class EpochDomain
+	{
+	public:
+		enum { MAX_THREADS = 128, CACHE_LINE = 64, COLLECT_THRESHOLD = 64 };
+
+		// object를 지우는 함수, context는 retire()에 넘긴 값 (보통 할당자를 가진 컨테이너)
+		typedef void	(*deleter_type)(void *object, void *context);
+
+	private:
+		// state: 읽기 구간 밖이면 0, 안이면 (그때 본 epoch << 1) | 1
+		struct Slot
+		{
+			unsigned long	state;
+			int				in_use;
+			// 같은 스레드 안에서 겹친 enter() 횟수, 주인 스레드만 건드린다
+			int				depth;
+			char			pad[CACHE_LINE - sizeof(unsigned long) - 2 * sizeof(int)];
+		};
+
+		struct Retired
+		{
+			void			*object;
+			deleter_type	deleter;
+			void			*context;
+			unsigned long	epoch;
+		};
+
+		unsigned long		_epoch;
+		char				_pad[CACHE_LINE - sizeof(unsigned long)];
+		Slot				_slots[MAX_THREADS];
+		pthread_key_t		_key;
+		pthread_mutex_t		_lock;
+		ft::Vector<Retired>	_retired;
+
+	public:
+		EpochDomain() : _epoch(0)
+		{
+			for (size_t i = 0; i < MAX_THREADS; ++i)
+			{
+				_slots[i].state = 0;
+				_slots[i].in_use = 0;
+				_slots[i].depth = 0;
+			}
+			pthread_key_create(&_key, release_slot);
+			pthread_mutex_init(&_lock, 0);
+		}
+
+		// 남은 객체는 모두 지운다. 이때 읽는 스레드가 없어야 한다
+		~EpochDomain()
+		{
+			for (size_t i = 0; i < _retired.size(); ++i)
+				_retired[i].deleter(_retired[i].object, _retired[i].context);
+			pthread_key_delete(_key);
+			pthread_mutex_destroy(&_lock);
+		}
+
+		// 여러 컨테이너가 공유하는 기본 도메인
+		static EpochDomain	&global()
+		{
+			static EpochDomain	domain;
+
+			return (domain);
+		}
+
+		// 읽기 구간 시작, 같은 스레드에서 겹쳐도 된다
+		void			enter()
+		{
+			Slot	*slot;
+
+			slot = my_slot();
+			if (slot->depth++ != 0)
+				return ;
+			__atomic_store_n(&slot->state, (__atomic_load_n(&_epoch, __ATOMIC_RELAXED) << 1) | 1, __ATOMIC_RELAXED);
+			// 이후의 읽기가 위의 쓰기보다 앞당겨지지 않게 한다
+			__atomic_thread_fence(__ATOMIC_SEQ_CST);
+		}
+
+		// 읽기 구간 끝
+		void			exit()
+		{
+			Slot	*slot;
+
+			slot = static_cast<Slot *>(pthread_getspecific(_key));
+			if (--slot->depth != 0)
+				return ;
+			__atomic_store_n(&slot->state, 0, __ATOMIC_RELEASE);
+		}
+
+		// 공유 구조에서 떼어낸 뒤에 호출, 안전해지면 deleter(object, context)를 부른다
+		void			retire(void *object, deleter_type deleter, void *context)
+		{
+			Retired		item;
+			bool		full;
+
+			item.object = object;
+			item.deleter = deleter;
+			item.context = context;
+			pthread_mutex_lock(&_lock);
+			item.epoch = __atomic_load_n(&_epoch, __ATOMIC_SEQ_CST);
+			_retired.push_back(item);
+			full = _retired.size() >= COLLECT_THRESHOLD;
+			pthread_mutex_unlock(&_lock);
+			if (full)
+				collect();
+		}
+
+		// epoch을 올려보고, 안전해진 객체를 지운다. 지운 개수를 반환
+		size_t			collect()
+		{
+			ft::Vector<Retired>	ready;
+			ft::Vector<Retired>	keep;
+			unsigned long		epoch;
+
+			pthread_mutex_lock(&_lock);
+			try_advance();
+			epoch = __atomic_load_n(&_epoch, __ATOMIC_SEQ_CST);
+			for (size_t i = 0; i < _retired.size(); ++i)
+			{
+				if (_retired[i].epoch + 2 <= epoch)
+					ready.push_back(_retired[i]);
+				else
+					keep.push_back(_retired[i]);
+			}
+			_retired.swap(keep);
+			pthread_mutex_unlock(&_lock);
+			// deleter가 다시 retire()할 수 있으므로 잠금 밖에서 부른다
+			for (size_t i = 0; i < ready.size(); ++i)
+				ready[i].deleter(ready[i].object, ready[i].context);
+			return (ready.size());
+		}
+
+		// 지금까지 retire된 객체가 모두 지워질 때까지 기다린다
+		// 읽기 구간 안에서 부르면 끝나지 않는다
+		void			synchronize()
+		{
+			while (true)
+			{
+				collect();
+				pthread_mutex_lock(&_lock);
+				if (_retired.empty())
+				{
+					pthread_mutex_unlock(&_lock);
+					return ;
+				}
+				pthread_mutex_unlock(&_lock);
+				sched_yield();
+			}
+		}
+
+		// 아직 지워지지 않은 객체 수
+		size_t			pending() const
+		{
+			size_t		ret;
+
+			pthread_mutex_lock(const_cast<pthread_mutex_t *>(&_lock));
+			ret = _retired.size();
+			pthread_mutex_unlock(const_cast<pthread_mutex_t *>(&_lock));
+			return (ret);
+		}
+
+		unsigned long	epoch() const
+		{
+			return (__atomic_load_n(&_epoch, __ATOMIC_ACQUIRE));
+		}
+
+	private:
+		Slot			*my_slot()
+		{
+			Slot	*slot;
+			int		expected;
+
+			slot = static_cast<Slot *>(pthread_getspecific(_key));
+			if (slot)
+				return (slot);
+			while (true)
+			{
+				for (size_t i = 0; i < MAX_THREADS; ++i)
+				{
+					expected = 0;
+					if (__atomic_compare_exchange_n(&_slots[i].in_use, &expected, 1, false,
+							__ATOMIC_ACQ_REL, __ATOMIC_RELAXED))
+					{
+						_slots[i].depth = 0;
+						pthread_setspecific(_key, _slots + i);
+						return (_slots + i);
+					}
+				}
+				// 슬롯이 다 찼으면 다른 스레드가 끝나기를 기다린다
+				sched_yield();
+			}
+		}
+
+		static void		release_slot(void *p)
+		{
+			Slot	*slot = static_cast<Slot *>(p);
+
+			__atomic_store_n(&slot->state, 0, __ATOMIC_RELEASE);
+			__atomic_store_n(&slot->in_use, 0, __ATOMIC_RELEASE);
+		}
+
+		// _lock을 잡은 상태에서 호출
+		// 활동 중인 모든 슬롯이 현재 epoch을 보고 있으면 하나 올린다
+		void			try_advance()
+		{
+			unsigned long	epoch;
+			unsigned long	state;
+
+			__atomic_thread_fence(__ATOMIC_SEQ_CST);
+			epoch = __atomic_load_n(&_epoch, __ATOMIC_RELAXED);
+			for (size_t i = 0; i < MAX_THREADS; ++i)
+			{
+				state = __atomic_load_n(&_slots[i].state, __ATOMIC_ACQUIRE);
+				if ((state & 1) && (state >> 1) != epoch)
+					return ;
+			}
+			__atomic_store_n(&_epoch, epoch + 1, __ATOMIC_SEQ_CST);
+		}
+
+		EpochDomain(const EpochDomain &);
+		EpochDomain	&operator=(const EpochDomain &);
+	};
+
+	// 범위 동안 읽기 구간을 연다
+	class EpochGuard
+	{
+	private:
+		EpochDomain		&_domain;
+
+	public:
+		explicit EpochGuard(EpochDomain &domain) : _domain(domain)
+		{
+			_domain.enter();
+		}
+
+		~EpochGuard()
+		{
+			_domain.exit();
+		}
+
+	private:
+		EpochGuard(const EpochGuard &);
+		EpochGuard	&operator=(const EpochGuard &);
+	};
+}
+
+#endif
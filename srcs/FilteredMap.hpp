@@ -0,0 +1,444 @@
+#ifndef FILTERED_MAP_HPP
+# define FILTERED_MAP_HPP
+
+# include <memory>
+# include <cstddef>
+# include <cstring>
+# include <new>
+# include "Map.hpp"
+# include "Hash.hpp"
+# include "utils.hpp"
+
+namespace ft
+{
+	// 블록 블룸 필터 (split block)
+	// 키 하나의 비트 8개를 모두 64바이트 블록 하나 안에 둔다. 블록의 64비트 워드 8개에 하나씩 세우므로
+	// 질의 하나가 캐시 라인 하나만 읽는다. 비트가 모두 서 있으면 "있을 수도 있음", 하나라도 비어 있으면
+	// 확실히 없다. 키당 10비트면 거짓 양성이 1% 안팎이다. 지울 수 없으므로 지운 키가 쌓이면 다시 만든다.
+	template <class Key, class Hash = ft::hash<Key> >
+	class BloomFilter
+	{
+	public:
+		enum { BLOCK_BYTES = 64, BLOCK_WORDS = 8, DEFAULT_BITS_PER_KEY = 10 };
+
+	private:
+		typedef unsigned long long	word_type;
+
+		struct Block
+		{
+			word_type	words[BLOCK_WORDS];
+		};
+
+		// 블록이 64바이트 경계에 오도록 조금 더 받아서 맞춘다
+		void		*_raw;
+		Block		*_blocks;
+		size_t		_block_count;
+		size_t		_capacity;
+		size_t		_bits_per_key;
+		size_t		_inserted;
+		Hash		_hash;
+
+	public:
+		// 키 expected개를 넣을 때 키당 bits_per_key비트가 되도록 잡는다
+		explicit BloomFilter(size_t expected = 1024, size_t bits_per_key = DEFAULT_BITS_PER_KEY, const Hash &hash = Hash())
+			: _raw(0), _blocks(0), _block_count(0), _capacity(0), _bits_per_key(bits_per_key ? bits_per_key : 1),
+			_inserted(0), _hash(hash)
+		{
+			reset(expected);
+		}
+
+		BloomFilter(const BloomFilter &copy)
+			: _raw(0), _blocks(0), _block_count(0), _capacity(0), _bits_per_key(copy._bits_per_key),
+			_inserted(0), _hash(copy._hash)
+		{
+			*this = copy;
+		}
+
+		~BloomFilter()
+		{
+			::operator delete(_raw);
+		}
+
+		BloomFilter	&operator=(const BloomFilter &ref)
+		{
+			if (this == &ref)
+				return (*this);
+			_bits_per_key = ref._bits_per_key;
+			_hash = ref._hash;
+			reset(ref._capacity);
+			std::memcpy(_blocks, ref._blocks, _block_count * sizeof(Block));
+			_inserted = ref._inserted;
+			return (*this);
+		}
+
+		// 모두 비우고 expected개에 맞는 크기로 다시 잡는다
+		void		reset(size_t expected)
+		{
+			size_t	blocks;
+
+			if (expected == 0)
+				expected = 1;
+			blocks = (expected * _bits_per_key + BLOCK_BYTES * 8 - 1) / (BLOCK_BYTES * 8);
+			if (blocks != _block_count)
+			{
+				void	*raw = ::operator new((blocks + 1) * sizeof(Block));
+
+				::operator delete(_raw);
+				_raw = raw;
+				_blocks = reinterpret_cast<Block *>((reinterpret_cast<size_t>(raw) + BLOCK_BYTES - 1)
+					& ~static_cast<size_t>(BLOCK_BYTES - 1));
+				_block_count = blocks;
+			}
+			std::memset(_blocks, 0, _block_count * sizeof(Block));
+			_capacity = expected;
+			_inserted = 0;
+		}
+
+		void		insert(const Key &k)
+		{
+			size_t		h = _hash(k);
+			Block		&b = _blocks[block_index(h)];
+
+			for (size_t i = 0; i < BLOCK_WORDS; ++i)
+				b.words[i] |= bit(h, i);
+			++_inserted;
+		}
+
+		// false면 넣은 적이 없다
+		bool		may_contain(const Key &k) const
+		{
+			size_t		h = _hash(k);
+			const Block	&b = _blocks[block_index(h)];
+
+			for (size_t i = 0; i < BLOCK_WORDS; ++i)
+			{
+				if (!(b.words[i] & bit(h, i)))
+					return (false);
+			}
+			return (true);
+		}
+
+		// reset() 이후 insert() 횟수 (같은 키를 여러 번 넣으면 여러 번 센다)
+		size_t		inserted() const
+		{ return (_inserted); }
+
+		// 이만큼 넣을 때까지 키당 bits_per_key비트가 유지된다
+		size_t		capacity() const
+		{ return (_capacity); }
+
+		size_t		bits_per_key() const
+		{ return (_bits_per_key); }
+
+		size_t		memory_bytes() const
+		{ return (_block_count * sizeof(Block)); }
+
+		void		swap(BloomFilter &x)
+		{
+			ft::swap(_raw, x._raw);
+			ft::swap(_blocks, x._blocks);
+			ft::swap(_block_count, x._block_count);
+			ft::swap(_capacity, x._capacity);
+			ft::swap(_bits_per_key, x._bits_per_key);
+			ft::swap(_inserted, x._inserted);
+			ft::swap(_hash, x._hash);
+		}
+
+	private:
+		// 해시의 위 32비트로 블록을 고른다 (곱하고 밀어서 나머지 연산을 피한다)
+		size_t		block_index(size_t h) const
+		{
+			return (static_cast<size_t>(((static_cast<word_type>(h) >> 32) * _block_count) >> 32));
+		}
+
+		// 아래 32비트에 워드마다 다른 홀수를 곱해 위 6비트로 워드 안의 비트를 고른다
+		static word_type	bit(size_t h, size_t i)
+		{
+			static const unsigned int	salt[BLOCK_WORDS] = {
+				0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+				0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U
+			};
+			unsigned int	x = static_cast<unsigned int>(h) * salt[i];
+
+			return (static_cast<word_type>(1) << (x >> 26));
+		}
+	};
+
+	// FilteredMap의 질의 통계
+	struct FilterStats
+	{
+		// find/count/operator[]로 찾은 횟수
+		size_t		lookups;
+		// 필터가 없다고 답해서 트리를 내려가지 않은 횟수
+		size_t		filtered;
+		// 필터는 있을 수도 있다고 했지만 트리에 없던 횟수
+		size_t		false_positives;
+		// 필터를 다시 만든 횟수
+		size_t		rebuilds;
+		size_t		memory_bytes;
+
+		FilterStats() : lookups(0), filtered(0), false_positives(0), rebuilds(0), memory_bytes(0)
+		{
+		}
+
+		// 없는 키를 물었을 때 필터가 걸러내지 못한 비율
+		double		false_positive_rate() const
+		{
+			if (filtered + false_positives == 0)
+				return (0);
+			return (static_cast<double>(false_positives) / (filtered + false_positives));
+		}
+	};
+
+	// 블룸 필터를 앞에 둔 Map
+	// 없는 키를 찾을 때 대부분 필터의 캐시 라인 하나만 보고 끝내고 트리를 내려가지 않는다.
+	// 넣을 때마다 필터에도 넣고, 원소 수가 필터 용량을 넘으면 두 배로 다시 만든다.
+	// 필터에서는 지울 수 없으므로 지운 키가 남은 원소 수보다 많아지면 남은 키로 다시 만든다.
+	// 순회와 범위 질의는 Map을 그대로 쓴다. 원소를 바꾸는 이터레이터 연산은 Map과 같다.
+	template < class Key, class T, class Compare = ft::less<Key>, class Hash = ft::hash<Key>,
+				class Alloc = std::allocator<ft::Pair<Key, T> > >
+	class FilteredMap
+	{
+	public:
+		typedef ft::Map<Key, T, Compare, Alloc>				map_type;
+		typedef ft::BloomFilter<Key, Hash>					filter_type;
+		typedef typename map_type::key_type					key_type;
+		typedef typename map_type::mapped_type				mapped_type;
+		typedef typename map_type::value_type				value_type;
+		typedef typename map_type::key_compare				key_compare;
+		typedef typename map_type::allocator_type			allocator_type;
+		typedef typename map_type::iterator					iterator;
+		typedef typename map_type::const_iterator			const_iterator;
+		typedef typename map_type::reverse_iterator			reverse_iterator;
+		typedef typename map_type::const_reverse_iterator	const_reverse_iterator;
+		typedef typename map_type::size_type				size_type;
+
+		// 지운 키가 이보다 적으면 다시 만들지 않는다
+		enum { MIN_REBUILD = 64 };
+
+	private:
+		map_type			_map;
+		filter_type			_filter;
+		// 필터에 남아 있는, 이미 지운 키 수
+		size_type			_stale;
+		mutable FilterStats	_stats;
+
+	public:
+		explicit FilteredMap(size_type expected = 1024, size_type bits_per_key = filter_type::DEFAULT_BITS_PER_KEY,
+							const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type())
+			: _map(comp, alloc), _filter(expected, bits_per_key), _stale(0), _stats()
+		{
+		}
+
+		template <class InputIterator>
+		FilteredMap(InputIterator first, InputIterator last, size_type expected = 1024,
+					size_type bits_per_key = filter_type::DEFAULT_BITS_PER_KEY,
+					const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type())
+			: _map(comp, alloc), _filter(expected, bits_per_key), _stale(0), _stats()
+		{
+			insert(first, last);
+		}
+
+		iterator				begin()
+		{ return (_map.begin()); }
+		const_iterator			begin() const
+		{ return (_map.begin()); }
+		iterator				end()
+		{ return (_map.end()); }
+		const_iterator			end() const
+		{ return (_map.end()); }
+		reverse_iterator		rbegin()
+		{ return (_map.rbegin()); }
+		const_reverse_iterator	rbegin() const
+		{ return (_map.rbegin()); }
+		reverse_iterator		rend()
+		{ return (_map.rend()); }
+		const_reverse_iterator	rend() const
+		{ return (_map.rend()); }
+
+		bool			empty() const
+		{ return (_map.empty()); }
+
+		size_type		size() const
+		{ return (_map.size()); }
+
+		size_type		max_size() const
+		{ return (_map.max_size()); }
+
+		// 필터가 없다고 하면 트리를 찾지 않고 바로 넣는다
+		mapped_type		&operator[](const key_type &k)
+		{
+			iterator	it = lookup(k);
+
+			if (it != _map.end())
+				return (it->second);
+			return (insert(value_type(k, mapped_type())).first->second);
+		}
+
+		ft::Pair<iterator, bool>	insert(const value_type &val)
+		{
+			ft::Pair<iterator, bool>	ret = _map.insert(val);
+
+			if (ret.second)
+				note_insert(val.first);
+			return (ret);
+		}
+
+		iterator		insert(iterator position, const value_type &val)
+		{
+			size_type	before = _map.size();
+			iterator	ret = _map.insert(position, val);
+
+			if (_map.size() != before)
+				note_insert(val.first);
+			return (ret);
+		}
+
+		template <class InputIterator>
+		void			insert(InputIterator first, InputIterator last)
+		{
+			for (; first != last; ++first)
+				insert(*first);
+		}
+
+		void			erase(iterator position)
+		{
+			_map.erase(position);
+			note_erase(1);
+		}
+
+		size_type		erase(const key_type &k)
+		{
+			size_type	ret;
+
+			if (!_filter.may_contain(k))
+				return (0);
+			ret = _map.erase(k);
+			note_erase(ret);
+			return (ret);
+		}
+
+		void			erase(iterator first, iterator last)
+		{
+			size_type	before = _map.size();
+
+			_map.erase(first, last);
+			note_erase(before - _map.size());
+		}
+
+		void			swap(FilteredMap &x)
+		{
+			_map.swap(x._map);
+			_filter.swap(x._filter);
+			ft::swap(_stale, x._stale);
+			ft::swap(_stats, x._stats);
+		}
+
+		// 필터 크기는 그대로 두고 비운다
+		void			clear()
+		{
+			_map.clear();
+			_filter.reset(_filter.capacity());
+			_stale = 0;
+		}
+
+		key_compare		key_comp() const
+		{ return (_map.key_comp()); }
+
+		iterator		find(const key_type &k)
+		{ return (lookup(k)); }
+
+		const_iterator	find(const key_type &k) const
+		{ return (const_cast<FilteredMap *>(this)->lookup(k)); }
+
+		// Map의 const_iterator로는 비교할 수 없어서 iterator로 찾는다
+		size_type		count(const key_type &k) const
+		{
+			FilteredMap	*self = const_cast<FilteredMap *>(this);
+
+			return (self->lookup(k) != self->_map.end());
+		}
+
+		iterator		lower_bound(const key_type &k)
+		{ return (_map.lower_bound(k)); }
+		const_iterator	lower_bound(const key_type &k) const
+		{ return (_map.lower_bound(k)); }
+		iterator		upper_bound(const key_type &k)
+		{ return (_map.upper_bound(k)); }
+		const_iterator	upper_bound(const key_type &k) const
+		{ return (_map.upper_bound(k)); }
+
+		ft::Pair<iterator, iterator>	equal_range(const key_type &k)
+		{ return (_map.equal_range(k)); }
+
+		allocator_type	get_allocator() const
+		{ return (_map.get_allocator()); }
+
+		// 필터 없이 Map을 직접 읽을 때
+		const map_type	&map() const
+		{ return (_map); }
+
+		FilterStats		filter_stats() const
+		{
+			FilterStats	ret = _stats;
+
+			ret.memory_bytes = _filter.memory_bytes();
+			return (ret);
+		}
+
+		void			reset_stats()
+		{
+			size_type	rebuilds = _stats.rebuilds;
+
+			_stats = FilterStats();
+			_stats.rebuilds = rebuilds;
+		}
+
+		// 남은 키만 넣어 다시 만든다. 용량은 원소 수의 두 배로 잡되 한 번에 절반 아래로는 줄이지 않는다
+		void			rebuild_filter()
+		{
+			size_type	capacity = _map.size() * 2;
+
+			if (capacity < _filter.capacity() / 2)
+				capacity = _filter.capacity() / 2;
+			_filter.reset(capacity);
+			for (iterator it = _map.begin(); it != _map.end(); ++it)
+				_filter.insert(it->first);
+			_stale = 0;
+			++_stats.rebuilds;
+		}
+
+	private:
+		iterator		lookup(const key_type &k)
+		{
+			iterator	ret;
+
+			++_stats.lookups;
+			if (!_filter.may_contain(k))
+			{
+				++_stats.filtered;
+				return (_map.end());
+			}
+			ret = _map.find(k);
+			if (ret == _map.end())
+				++_stats.false_positives;
+			return (ret);
+		}
+
+		void			note_insert(const key_type &k)
+		{
+			if (_filter.inserted() >= _filter.capacity())
+				rebuild_filter();
+			else
+				_filter.insert(k);
+		}
+
+		void			note_erase(size_type n)
+		{
+			_stale += n;
+			if (_stale >= MIN_REBUILD && _stale > _map.size())
+				rebuild_filter();
+		}
+	};
+}
+
+#endif
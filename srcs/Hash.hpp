@@ -0,0 +1,101 @@
+#ifndef HASH_HPP
+# define HASH_HPP
+
+# include <cstddef>
+# include <cstring>
+# include <string>
+
+namespace ft
+{
+	// 64비트 정수를 섞는 함수 (splitmix64의 마무리 단계)
+	// 연속된 정수 키도 하위 비트가 고르게 퍼지도록 한다.
+	inline size_t	hash_mix(unsigned long long x)
+	{
+		x ^= x >> 30;
+		x *= 0xbf58476d1ce4e5b9ULL;
+		x ^= x >> 27;
+		x *= 0x94d049bb133111ebULL;
+		x ^= x >> 31;
+		return (static_cast<size_t>(x));
+	}
+
+	// 바이트 열의 FNV-1a 해시
+	inline size_t	hash_bytes(const void *data, size_t len)
+	{
+		const unsigned char		*p = static_cast<const unsigned char *>(data);
+		unsigned long long		h;
+
+		h = 0xcbf29ce484222325ULL;
+		for (size_t i = 0; i < len; ++i)
+		{
+			h ^= p[i];
+			h *= 0x100000001b3ULL;
+		}
+		return (static_cast<size_t>(h));
+	}
+
+	// hash 함수 객체, 정수형(enum 포함)은 기본 템플릿으로 처리한다
+	template <typename T>
+	class hash
+	{
+	public:
+		size_t	operator() (const T &x) const
+		{
+			return (hash_mix(static_cast<unsigned long long>(x)));
+		}
+	};
+
+	template <typename T>
+	class hash<T *>
+	{
+	public:
+		size_t	operator() (T *x) const
+		{
+			return (hash_mix(reinterpret_cast<size_t>(x)));
+		}
+	};
+
+	// 실수는 정수로 바꾸면 소수부가 잘려 0.1, 0.2, 0.7이 모두 같은 값이 되므로 비트 패턴을 섞는다
+	// -0.0과 0.0은 같은 키이므로 0.0으로 맞춘다
+	template <>
+	class hash<float>
+	{
+	public:
+		size_t	operator() (float x) const
+		{
+			unsigned int	bits;
+
+			if (x == 0.0f)
+				x = 0.0f;
+			std::memcpy(&bits, &x, sizeof(bits));
+			return (hash_mix(bits));
+		}
+	};
+
+	template <>
+	class hash<double>
+	{
+	public:
+		size_t	operator() (double x) const
+		{
+			unsigned long long	bits;
+
+			if (x == 0.0)
+				x = 0.0;
+			std::memcpy(&bits, &x, sizeof(bits));
+			return (hash_mix(bits));
+		}
+	};
+
+	template <>
+	class hash<std::string>
+	{
+	public:
+		size_t	operator() (const std::string &x) const
+		{
+			return (hash_bytes(x.data(), x.size()));
+		}
+	};
+}
+
+#endif
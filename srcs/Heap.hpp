@@ -0,0 +1,180 @@
+#ifndef HEAP_HPP
+# define HEAP_HPP
+
+# include <cstddef>
+# include "utils.hpp"
+# include "Algorithm.hpp"
+
+namespace ft
+{
+	// ft::make_heap 등이 쓰는 자식 수
+	enum { HEAP_ARITY = 4 };
+
+	namespace detail
+	{
+		// 자식이 Arity개인 힙 (comp 기준으로 가장 큰 원소가 맨 앞)
+		// 노드 i의 자식은 Arity * i + 1부터 Arity개. 자식들이 붙어 있어서 내려갈 때 한 캐시 라인에서
+		// 비교하고, 높이가 log_Arity(n)로 줄어 이진 힙보다 옮기는 횟수가 적다.
+		template <size_t Arity>
+		struct DaryHeap
+		{
+			// hole에서 부모 쪽으로 올라가며 value 자리를 찾는다
+			template <class Iterator, class T, class Compare>
+			static void		sift_up(Iterator first, size_t hole, T value, Compare comp)
+			{
+				size_t	parent;
+
+				while (hole > 0)
+				{
+					parent = (hole - 1) / Arity;
+					if (!comp(first[parent], value))
+						break ;
+					first[hole] = first[parent];
+					hole = parent;
+				}
+				first[hole] = value;
+			}
+
+			// hole에서 가장 큰 자식 쪽으로 내려가며 value 자리를 찾는다
+			template <class Iterator, class T, class Compare>
+			static void		sift_down(Iterator first, size_t hole, size_t len, T value, Compare comp)
+			{
+				size_t	child;
+				size_t	best;
+				size_t	end;
+
+				while ((child = Arity * hole + 1) < len)
+				{
+					best = child;
+					end = child + Arity < len ? child + Arity : len;
+					for (++child; child < end; ++child)
+					{
+						if (comp(first[best], first[child]))
+							best = child;
+					}
+					if (!comp(value, first[best]))
+						break ;
+					first[hole] = first[best];
+					hole = best;
+				}
+				first[hole] = value;
+			}
+
+			// 아래쪽 부모부터 내려보내서 O(n)
+			template <class T, class Iterator, class Compare>
+			static void		make(Iterator first, size_t len, Compare comp)
+			{
+				if (len < 2)
+					return ;
+				for (size_t i = (len - 2) / Arity + 1; i-- > 0; )
+					sift_down(first, i, len, T(first[i]), comp);
+			}
+
+			// [0, len - 1)이 힙이고 first[len - 1]을 새로 넣는다
+			template <class T, class Iterator, class Compare>
+			static void		push(Iterator first, size_t len, Compare comp)
+			{
+				if (len < 2)
+					return ;
+				sift_up(first, len - 1, T(first[len - 1]), comp);
+			}
+
+			// 맨 앞 원소를 first[len - 1]로 보내고 [0, len - 1)을 힙으로 되돌린다
+			template <class T, class Iterator, class Compare>
+			static void		pop(Iterator first, size_t len, Compare comp)
+			{
+				if (len < 2)
+					return ;
+				T	value = first[len - 1];
+
+				first[len - 1] = first[0];
+				sift_down(first, 0, len - 1, value, comp);
+			}
+
+			template <class Iterator, class Compare>
+			static bool		valid(Iterator first, size_t len, Compare comp)
+			{
+				for (size_t i = 1; i < len; ++i)
+				{
+					if (comp(first[(i - 1) / Arity], first[i]))
+						return (false);
+				}
+				return (true);
+			}
+		};
+	}
+
+	// 아래 함수들은 HEAP_ARITY진 힙을 다룬다. std::make_heap의 이진 힙과 섞어 쓰면 안 된다
+
+	template <class RandomIterator, class Compare>
+	void	make_heap(RandomIterator first, RandomIterator last, Compare comp)
+	{
+		typedef typename detail::RawType<RandomIterator>::type	T;
+		T	*f = detail::raw(first);
+
+		detail::DaryHeap<HEAP_ARITY>::template make<T>(f, detail::raw(last) - f, comp);
+	}
+
+	template <class RandomIterator>
+	void	make_heap(RandomIterator first, RandomIterator last)
+	{
+		typedef typename detail::RawType<RandomIterator>::type	T;
+
+		ft::make_heap(first, last, ft::less<T>());
+	}
+
+	// [first, last - 1)이 힙일 때 *(last - 1)을 넣는다
+	template <class RandomIterator, class Compare>
+	void	push_heap(RandomIterator first, RandomIterator last, Compare comp)
+	{
+		typedef typename detail::RawType<RandomIterator>::type	T;
+		T	*f = detail::raw(first);
+
+		detail::DaryHeap<HEAP_ARITY>::template push<T>(f, detail::raw(last) - f, comp);
+	}
+
+	template <class RandomIterator>
+	void	push_heap(RandomIterator first, RandomIterator last)
+	{
+		typedef typename detail::RawType<RandomIterator>::type	T;
+
+		ft::push_heap(first, last, ft::less<T>());
+	}
+
+	// 가장 큰 원소를 *(last - 1)로 옮기고 [first, last - 1)을 힙으로 남긴다
+	template <class RandomIterator, class Compare>
+	void	pop_heap(RandomIterator first, RandomIterator last, Compare comp)
+	{
+		typedef typename detail::RawType<RandomIterator>::type	T;
+		T	*f = detail::raw(first);
+
+		detail::DaryHeap<HEAP_ARITY>::template pop<T>(f, detail::raw(last) - f, comp);
+	}
+
+	template <class RandomIterator>
+	void	pop_heap(RandomIterator first, RandomIterator last)
+	{
+		typedef typename detail::RawType<RandomIterator>::type	T;
+
+		ft::pop_heap(first, last, ft::less<T>());
+	}
+
+	template <class RandomIterator, class Compare>
+	bool	is_heap(RandomIterator first, RandomIterator last, Compare comp)
+	{
+		typedef typename detail::RawType<RandomIterator>::type	T;
+		T	*f = detail::raw(first);
+
+		return (detail::DaryHeap<HEAP_ARITY>::valid(f, detail::raw(last) - f, comp));
+	}
+
+	template <class RandomIterator>
+	bool	is_heap(RandomIterator first, RandomIterator last)
+	{
+		typedef typename detail::RawType<RandomIterator>::type	T;
+
+		return (ft::is_heap(first, last, ft::less<T>()));
+	}
+}
+
+#endif
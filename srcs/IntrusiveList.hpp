@@ -0,0 +1,485 @@
+#ifndef INTRUSIVE_LIST_HPP
+# define INTRUSIVE_LIST_HPP
+
+# include <cstddef>
+# include "Iterator.hpp"
+# include "utils.hpp"
+
+namespace ft
+{
+	// IntrusiveList가 원소를 잇는 데 쓰는 고리. 원소 클래스에 멤버로 둔다
+	// 리스트마다 고리가 하나씩 필요하고, 고리가 여러 개면 한 원소가 여러 리스트에 동시에 들어간다.
+	// 원소를 복사해도 고리는 복사되지 않는다 (새 원소는 어느 리스트에도 없다).
+	// 리스트에 든 원소가 사라지면 안 된다. 먼저 erase하거나 unlink()로 빼야 한다.
+	struct ListHook
+	{
+		ListHook	*_prev;
+		ListHook	*_next;
+
+		ListHook() : _prev(0), _next(0)
+		{
+		}
+
+		ListHook(const ListHook &) : _prev(0), _next(0)
+		{
+		}
+
+		ListHook	&operator=(const ListHook &)
+		{
+			return (*this);
+		}
+
+		bool		is_linked() const
+		{
+			return (_next != 0);
+		}
+
+		// 어느 리스트에 있든 빼낸다. 리스트의 size()는 맞지 않게 되므로 리스트의 erase를 쓰는 편이 낫다
+		void		unlink()
+		{
+			if (!_next)
+				return ;
+			_prev->_next = _next;
+			_next->_prev = _prev;
+			_prev = 0;
+			_next = 0;
+		}
+	};
+
+	// 원소 안의 ListHook 멤버(Hook)로 원소들을 잇는 이중 연결 리스트, ft::List와 같은 API
+	// 노드를 할당하거나 값을 복사하지 않고 원소 자체를 잇는다. 삽입, 삭제, splice가 O(1)이다.
+	// 리스트는 원소를 소유하지 않는다. 소멸하거나 clear()해도 원소는 그대로고 고리만 풀린다.
+	//
+	//     struct Conn { ft::ListHook idle; ft::ListHook timeout; ... };
+	//     ft::IntrusiveList<Conn, &Conn::idle>     idle;
+	//     ft::IntrusiveList<Conn, &Conn::timeout>  timeouts;
+	template <typename T, ListHook T::*Hook>
+	class IntrusiveList
+	{
+	public:
+		typedef T				value_type;
+		typedef T&				reference;
+		typedef const T&		const_reference;
+		typedef T*				pointer;
+		typedef const T*		const_pointer;
+		typedef ptrdiff_t		difference_type;
+		typedef size_t			size_type;
+
+		// 원소 고리 사이를 오가는 이터레이터. 끝은 리스트 안의 _end 고리다
+		template <typename Ref, typename Ptr>
+		class Iter
+		{
+		public:
+			typedef bidirectional_iterator_tag	iterator_category;
+			typedef T							value_type;
+			typedef ptrdiff_t					difference_type;
+			typedef Ptr							pointer;
+			typedef Ref							reference;
+
+			ListHook	*_element;
+
+		public:
+			Iter() : _element(0) {}
+			explicit Iter(ListHook *h) : _element(h) {}
+			Iter(const Iter<T&, T*> &x) : _element(x._element) {}
+
+			reference	operator* () const
+			{ return (*IntrusiveList::owner(_element)); }
+
+			pointer		operator-> () const
+			{ return (IntrusiveList::owner(_element)); }
+
+			Iter		&operator++ ()
+			{ _element = _element->_next; return (*this); }
+			Iter		operator++ (int)
+			{ Iter	tmp(*this); _element = _element->_next; return (tmp); }
+			Iter		&operator-- ()
+			{ _element = _element->_prev; return (*this); }
+			Iter		operator-- (int)
+			{ Iter	tmp(*this); _element = _element->_prev; return (tmp); }
+
+			bool		operator== (const Iter &x) const
+			{ return (_element == x._element); }
+			bool		operator!= (const Iter &x) const
+			{ return (_element != x._element); }
+		};
+
+		template <typename It>
+		class ReverseIter
+		{
+		public:
+			It		_base;
+
+		public:
+			ReverseIter() {}
+			explicit ReverseIter(const It &it) : _base(it) {}
+
+			typename It::reference	operator* () const
+			{ It	tmp(_base); return (*--tmp); }
+
+			typename It::pointer	operator-> () const
+			{ return (&**this); }
+
+			ReverseIter	&operator++ ()
+			{ --_base; return (*this); }
+			ReverseIter	operator++ (int)
+			{ ReverseIter	tmp(*this); --_base; return (tmp); }
+			ReverseIter	&operator-- ()
+			{ ++_base; return (*this); }
+			ReverseIter	operator-- (int)
+			{ ReverseIter	tmp(*this); ++_base; return (tmp); }
+
+			bool		operator== (const ReverseIter &x) const
+			{ return (_base == x._base); }
+			bool		operator!= (const ReverseIter &x) const
+			{ return (_base != x._base); }
+		};
+
+		typedef Iter<T&, T*>						iterator;
+		typedef Iter<const T&, const T*>			const_iterator;
+		typedef ReverseIter<iterator>				reverse_iterator;
+		typedef ReverseIter<const_iterator>			const_reverse_iterator;
+
+	private:
+		ListHook	_end;
+		size_type	_size;
+
+	public:
+		IntrusiveList() : _size(0)
+		{
+			_end._prev = &_end;
+			_end._next = &_end;
+		}
+
+		// 원소들을 이 리스트에 잇는다. [first, last)는 원소(T)를 가리키는 이터레이터
+		template <class InputIterator>
+		IntrusiveList(InputIterator first, InputIterator last) : _size(0)
+		{
+			_end._prev = &_end;
+			_end._next = &_end;
+			insert(end(), first, last);
+		}
+
+		~IntrusiveList()
+		{
+			clear();
+		}
+
+		iterator				begin()
+		{ return (iterator(_end._next)); }
+		const_iterator			begin() const
+		{ return (const_iterator(_end._next)); }
+		iterator				end()
+		{ return (iterator(&_end)); }
+		const_iterator			end() const
+		{ return (const_iterator(const_cast<ListHook *>(&_end))); }
+		reverse_iterator		rbegin()
+		{ return (reverse_iterator(end())); }
+		const_reverse_iterator	rbegin() const
+		{ return (const_reverse_iterator(end())); }
+		reverse_iterator		rend()
+		{ return (reverse_iterator(begin())); }
+		const_reverse_iterator	rend() const
+		{ return (const_reverse_iterator(begin())); }
+
+		bool			empty() const
+		{ return (_size == 0); }
+
+		size_type		size() const
+		{ return (_size); }
+
+		size_type		max_size() const
+		{ return (static_cast<size_type>(-1) / sizeof(T)); }
+
+		reference		front()
+		{ return (*owner(_end._next)); }
+		const_reference	front() const
+		{ return (*owner(_end._next)); }
+		reference		back()
+		{ return (*owner(_end._prev)); }
+		const_reference	back() const
+		{ return (*owner(_end._prev)); }
+
+		// x를 가리키는 이터레이터, O(1). x는 이 리스트에 있어야 한다
+		static iterator	iterator_to(reference x)
+		{ return (iterator(&(x.*Hook))); }
+
+		static const_iterator	iterator_to(const_reference x)
+		{ return (const_iterator(const_cast<ListHook *>(&(x.*Hook)))); }
+
+		void			push_front(reference x)
+		{ link_before(_end._next, &(x.*Hook)); }
+
+		void			push_back(reference x)
+		{ link_before(&_end, &(x.*Hook)); }
+
+		void			pop_front()
+		{ unlink(_end._next); }
+
+		void			pop_back()
+		{ unlink(_end._prev); }
+
+		// x를 position 앞에 잇는다. x는 이 고리로 다른 리스트에 들어 있으면 안 된다
+		iterator		insert(iterator position, reference x)
+		{
+			link_before(position._element, &(x.*Hook));
+			return (iterator(&(x.*Hook)));
+		}
+
+		template <class InputIterator>
+		void			insert(iterator position, InputIterator first, InputIterator last)
+		{
+			for (; first != last; ++first)
+				insert(position, *first);
+		}
+
+		// 원소를 리스트에서 빼고 다음 위치를 반환. 원소 자체는 그대로 있다
+		iterator		erase(iterator position)
+		{
+			ListHook	*next = position._element->_next;
+
+			unlink(position._element);
+			return (iterator(next));
+		}
+
+		iterator		erase(iterator first, iterator last)
+		{
+			while (first != last)
+				first = erase(first);
+			return (last);
+		}
+
+		// 원소를 하나씩 풀어서 is_linked()가 거짓이 되게 한다, O(n)
+		void			clear()
+		{
+			ListHook	*h = _end._next;
+			ListHook	*next;
+
+			while (h != &_end)
+			{
+				next = h->_next;
+				h->_prev = 0;
+				h->_next = 0;
+				h = next;
+			}
+			_end._prev = &_end;
+			_end._next = &_end;
+			_size = 0;
+		}
+
+		void			swap(IntrusiveList &x)
+		{
+			IntrusiveList	tmp;
+
+			tmp.splice(tmp.end(), *this);
+			splice(end(), x);
+			x.splice(x.end(), tmp);
+		}
+
+		// x의 원소를 모두 position 앞으로 옮긴다, O(1)
+		void			splice(iterator position, IntrusiveList &x)
+		{
+			if (x.empty())
+				return ;
+			transfer(position._element, x._end._next, &x._end);
+			_size += x._size;
+			x._size = 0;
+		}
+
+		void			splice(iterator position, IntrusiveList &x, iterator i)
+		{
+			if (i._element == position._element || i._element->_next == position._element)
+				return ;
+			transfer(position._element, i._element, i._element->_next);
+			++_size;
+			--x._size;
+		}
+
+		// 다른 리스트에서 옮기면 개수를 세야 하므로 O(구간 길이), 같은 리스트 안이면 O(1)
+		void			splice(iterator position, IntrusiveList &x, iterator first, iterator last)
+		{
+			size_type	n = 0;
+
+			if (first == last)
+				return ;
+			if (&x != this)
+			{
+				for (ListHook *h = first._element; h != last._element; h = h->_next)
+					++n;
+				_size += n;
+				x._size -= n;
+			}
+			transfer(position._element, first._element, last._element);
+		}
+
+		void			remove(const value_type &val)
+		{
+			iterator	it = begin();
+
+			while (it != end())
+			{
+				if (*it == val)
+					it = erase(it);
+				else
+					++it;
+			}
+		}
+
+		template <class Predicate>
+		void			remove_if(Predicate pred)
+		{
+			iterator	it = begin();
+
+			while (it != end())
+			{
+				if (pred(*it))
+					it = erase(it);
+				else
+					++it;
+			}
+		}
+
+		void			unique()
+		{
+			unique(EqualTo());
+		}
+
+		template <class BinaryPredicate>
+		void			unique(BinaryPredicate binary_pred)
+		{
+			iterator	it = begin();
+			iterator	next;
+
+			if (it == end())
+				return ;
+			next = it;
+			++next;
+			while (next != end())
+			{
+				if (binary_pred(*it, *next))
+					next = erase(next);
+				else
+					it = next++;
+			}
+		}
+
+		void			merge(IntrusiveList &x)
+		{
+			merge(x, ft::less<T>());
+		}
+
+		// 정렬된 x를 정렬된 이 리스트에 합친다. 같으면 이 리스트의 원소가 먼저
+		template <class Compare>
+		void			merge(IntrusiveList &x, Compare comp)
+		{
+			iterator	it = begin();
+
+			if (&x == this)
+				return ;
+			while (it != end() && !x.empty())
+			{
+				if (comp(x.front(), *it))
+					splice(it, x, x.begin());
+				else
+					++it;
+			}
+			splice(end(), x);
+		}
+
+		void			sort()
+		{
+			sort(ft::less<T>());
+		}
+
+		// 합병 정렬, 고리만 다시 잇는다. 같은 원소는 원래 순서를 지킨다
+		template <class Compare>
+		void			sort(Compare comp)
+		{
+			IntrusiveList	right;
+			iterator		mid = begin();
+
+			if (_size < 2)
+				return ;
+			for (size_type i = 0; i < _size / 2; ++i)
+				++mid;
+			right.splice(right.end(), *this, mid, end());
+			sort(comp);
+			right.sort(comp);
+			merge(right, comp);
+		}
+
+		void			reverse()
+		{
+			ListHook	*h = &_end;
+
+			do
+			{
+				ft::swap(h->_prev, h->_next);
+				h = h->_prev;
+			}
+			while (h != &_end);
+		}
+
+	private:
+		// 리스트는 원소를 가리키기만 하므로 복사하지 않는다
+		IntrusiveList(const IntrusiveList &);
+		IntrusiveList	&operator=(const IntrusiveList &);
+
+		struct EqualTo
+		{
+			bool	operator() (const T &a, const T &b) const
+			{ return (a == b); }
+		};
+
+		// 고리 주소에서 고리를 품은 원소 주소를 구한다
+		static T		*owner(ListHook *h)
+		{
+			return (reinterpret_cast<T *>(reinterpret_cast<char *>(h) - hook_offset()));
+		}
+
+		static const T	*owner(const ListHook *h)
+		{
+			return (reinterpret_cast<const T *>(reinterpret_cast<const char *>(h) - hook_offset()));
+		}
+
+		static ptrdiff_t	hook_offset()
+		{
+			// 0이 아닌 정렬된 가짜 주소로 멤버 위치만 계산한다 (접근은 하지 않는다)
+			T	*fake = reinterpret_cast<T *>(static_cast<size_t>(64));
+
+			return (reinterpret_cast<char *>(&(fake->*Hook)) - reinterpret_cast<char *>(fake));
+		}
+
+		void			link_before(ListHook *position, ListHook *h)
+		{
+			h->_prev = position->_prev;
+			h->_next = position;
+			position->_prev->_next = h;
+			position->_prev = h;
+			++_size;
+		}
+
+		void			unlink(ListHook *h)
+		{
+			h->unlink();
+			--_size;
+		}
+
+		// [first, last)를 position 앞으로 옮긴다
+		static void		transfer(ListHook *position, ListHook *first, ListHook *last)
+		{
+			ListHook	*before_last = last->_prev;
+
+			if (position == last)
+				return ;
+			first->_prev->_next = last;
+			last->_prev = first->_prev;
+			first->_prev = position->_prev;
+			before_last->_next = position;
+			position->_prev->_next = first;
+			position->_prev = before_last;
+		}
+	};
+}
+
+#endif
@@ -108,7 +108,7 @@ namespace ft
 
 
 	public:
-		explicit List(const allocator_type& alloc = allocator_type()) : _allocator(alloc)
+		explicit List(const allocator_type& alloc = allocator_type()) : _node_alloc(alloc), _allocator(alloc)
 		{
 			_end = _node_alloc.allocate(1);
 			_node_alloc.construct(_end, Node<T>());
@@ -116,7 +116,7 @@ namespace ft
 			_end->_next = _end;
 		}
 
-		explicit List(size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type()) : _allocator(alloc)
+		explicit List(size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type()) : _node_alloc(alloc), _allocator(alloc)
 		{
 			_end = _node_alloc.allocate(1);
 			_node_alloc.construct(_end, Node<T>());
@@ -127,12 +127,12 @@ namespace ft
 		}
 
 		template <typename InputIterator>
-		List(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type()) : _allocator(alloc)
+		List(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type()) : _node_alloc(alloc), _allocator(alloc)
 		{
 			list_private(first, last);
 		}
 
-		List(const List &copy) : _allocator(copy._allocator)
+		List(const List &copy) : _node_alloc(copy._node_alloc), _allocator(copy._allocator)
 		{
 			iterator		iter;
 
@@ -528,6 +528,7 @@ namespace ft
 		void				swap(List& x)
 		{
 			ft::swap(this->_allocator, x._allocator);
+			ft::swap(this->_node_alloc, x._node_alloc);
 			ft::swap(this->_end, x._end);
 		}
 
@@ -0,0 +1,789 @@
+#ifndef LRU_CACHE_HPP
+# define LRU_CACHE_HPP
+
+# include <memory>
+# include <cstddef>
+# include <new>
+# include <pthread.h>
+# include "IntrusiveList.hpp"
+# include "Vector.hpp"
+# include "Hash.hpp"
+# include "utils.hpp"
+
+namespace ft
+{
+	// 원소마다 무게 1, 용량은 원소 수
+	template <class Key, class Value>
+	struct unit_weight
+	{
+		size_t	operator() (const Key &, const Value &) const
+		{ return (1); }
+	};
+
+	struct CacheStats
+	{
+		size_t		hits;
+		size_t		misses;
+		// 용량 때문에 밀려난 원소 수 (erase, clear, 덮어쓰기는 세지 않는다)
+		size_t		evictions;
+
+		CacheStats() : hits(0), misses(0), evictions(0)
+		{
+		}
+
+		double		hit_rate() const
+		{
+			if (hits + misses == 0)
+				return (0);
+			return (static_cast<double>(hits) / (hits + misses));
+		}
+
+		CacheStats	&operator+= (const CacheStats &x)
+		{
+			hits += x.hits;
+			misses += x.misses;
+			evictions += x.evictions;
+			return (*this);
+		}
+	};
+
+	namespace detail
+	{
+		// 원소 안의 chain 포인터로 버킷을 잇는 해시 테이블. 원소를 소유하지 않는다
+		// Entry에는 key, hash, chain 멤버가 있어야 한다. 버킷 수는 2의 거듭제곱이고
+		// 원소 수가 버킷 수를 넘으면 두 배로 늘린다.
+		template <class Key, class Entry, class Hash>
+		class CacheTable
+		{
+		private:
+			ft::Vector<Entry *>	_buckets;
+			size_t				_size;
+			Hash				_hash;
+
+		public:
+			explicit CacheTable(const Hash &hash = Hash())
+				: _buckets(16, static_cast<Entry *>(0)), _size(0), _hash(hash)
+			{
+			}
+
+			size_t		hash(const Key &k) const
+			{ return (_hash(k)); }
+
+			size_t		size() const
+			{ return (_size); }
+
+			Entry		*find(const Key &k, size_t h) const
+			{
+				for (Entry *e = _buckets[h & (_buckets.size() - 1)]; e; e = e->chain)
+				{
+					if (e->hash == h && e->key == k)
+						return (e);
+				}
+				return (0);
+			}
+
+			void		insert(Entry *e)
+			{
+				if (_size >= _buckets.size())
+					grow();
+				link(e);
+				++_size;
+			}
+
+			void		remove(Entry *e)
+			{
+				Entry	**p = &_buckets[e->hash & (_buckets.size() - 1)];
+
+				while (*p != e)
+					p = &(*p)->chain;
+				*p = e->chain;
+				--_size;
+			}
+
+			void		clear()
+			{
+				for (size_t i = 0; i < _buckets.size(); ++i)
+					_buckets[i] = 0;
+				_size = 0;
+			}
+
+		private:
+			void		link(Entry *e)
+			{
+				Entry	*&head = _buckets[e->hash & (_buckets.size() - 1)];
+
+				e->chain = head;
+				head = e;
+			}
+
+			void		grow()
+			{
+				ft::Vector<Entry *>	old(_buckets.size() * 2, static_cast<Entry *>(0));
+				Entry				*e;
+				Entry				*next;
+
+				old.swap(_buckets);
+				for (size_t i = 0; i < old.size(); ++i)
+				{
+					for (e = old[i]; e; e = next)
+					{
+						next = e->chain;
+						link(e);
+					}
+				}
+			}
+		};
+	}
+
+	// 가장 오래 쓰지 않은 원소부터 밀어내는 캐시
+	// 원소 하나가 할당 하나다: 키, 값, 해시 체인 포인터, 최근 순서 리스트의 고리(ListHook)를 한 덩어리에
+	// 담는다. 찾기는 해시 테이블로 O(1), 찾은 원소는 IntrusiveList의 splice로 맨 앞으로 옮긴다.
+	// 무게 합이 용량을 넘으면 맨 뒤부터 밀어내고, 밀어낼 때마다 콜백을 부른다.
+	// 용량은 Weigher가 매기는 무게의 합이다. 기본은 원소 수, 바이트로 재려면 Weigher를 넘긴다.
+	// 스레드 하나에서 쓴다. 여러 스레드는 ShardedCache로 감싼다.
+	template < class Key, class Value, class Hash = ft::hash<Key>, class Weigher = ft::unit_weight<Key, Value>,
+				class Alloc = std::allocator<Value> >
+	class LruCache
+	{
+	public:
+		typedef Key						key_type;
+		typedef Value					mapped_type;
+		typedef Hash					hasher;
+		typedef Weigher					weigher_type;
+		typedef Alloc					allocator_type;
+		typedef size_t					size_type;
+		// 밀려나는 원소를 지우기 직전에 부른다. 콜백 안에서 이 캐시를 건드리지 않는다
+		typedef void	(*evict_callback)(const Key &key, const Value &value, void *context);
+
+		// get이 캐시를 바꾸므로 ShardedCache는 get에도 쓰기 잠금을 잡는다
+		enum { SHARED_GET = 0 };
+
+	private:
+		struct Entry
+		{
+			Key			key;
+			Value		value;
+			size_t		weight;
+			size_t		hash;
+			Entry		*chain;
+			ListHook	hook;
+
+			Entry(const Key &k, const Value &v, size_t w, size_t h)
+				: key(k), value(v), weight(w), hash(h), chain(0)
+			{
+			}
+		};
+
+		typedef ft::IntrusiveList<Entry, &Entry::hook>							list_type;
+		typedef typename allocator_type::template rebind<Entry>::other		entry_allocator;
+
+		detail::CacheTable<Key, Entry, Hash>	_table;
+		// 앞이 가장 최근
+		list_type				_order;
+		entry_allocator			_entries;
+		weigher_type			_weigher;
+		size_type				_capacity;
+		size_type				_weight;
+		evict_callback			_callback;
+		void					*_context;
+		CacheStats				_stats;
+
+	public:
+		explicit LruCache(size_type capacity, const weigher_type &weigher = weigher_type(), const hasher &hash = hasher(),
+						const allocator_type &alloc = allocator_type())
+			: _table(hash), _order(), _entries(alloc), _weigher(weigher), _capacity(capacity), _weight(0),
+			_callback(0), _context(0), _stats()
+		{
+		}
+
+		// 남은 원소는 콜백 없이 지운다
+		~LruCache()
+		{
+			clear();
+		}
+
+		// 있으면 맨 앞으로 옮기고 값을 가리키는 포인터를, 없으면 0을 반환
+		// 포인터는 다음 put, erase, clear 전까지 유효하다
+		mapped_type		*get(const key_type &k)
+		{
+			Entry	*e = _table.find(k, _table.hash(k));
+
+			if (!e)
+			{
+				++_stats.misses;
+				return (0);
+			}
+			++_stats.hits;
+			_order.splice(_order.begin(), _order, list_type::iterator_to(*e));
+			return (&e->value);
+		}
+
+		// 순서와 통계를 건드리지 않고 본다
+		const mapped_type	*peek(const key_type &k) const
+		{
+			Entry	*e = _table.find(k, _table.hash(k));
+
+			return (e ? &e->value : 0);
+		}
+
+		bool			contains(const key_type &k) const
+		{ return (peek(k) != 0); }
+
+		// 넣거나 값을 바꾸고 맨 앞에 둔 뒤 용량에 맞게 밀어낸다
+		// 무게가 용량보다 큰 원소는 넣지 않고 (같은 키의 이전 값도 지우고) false를 반환
+		bool			put(const key_type &k, const mapped_type &v)
+		{
+			size_t		h = _table.hash(k);
+			size_type	w = _weigher(k, v);
+			Entry		*e = _table.find(k, h);
+
+			if (w > _capacity)
+			{
+				if (e)
+					destroy(e);
+				return (false);
+			}
+			if (e)
+			{
+				e->value = v;
+				_weight = _weight - e->weight + w;
+				e->weight = w;
+				_order.splice(_order.begin(), _order, list_type::iterator_to(*e));
+			}
+			else
+			{
+				e = _entries.allocate(1);
+				try
+				{
+					_entries.construct(e, Entry(k, v, w, h));
+				}
+				catch (...)
+				{
+					_entries.deallocate(e, 1);
+					throw ;
+				}
+				_table.insert(e);
+				_order.push_front(*e);
+				_weight += w;
+			}
+			evict_to(_capacity);
+			return (true);
+		}
+
+		size_type		erase(const key_type &k)
+		{
+			Entry	*e = _table.find(k, _table.hash(k));
+
+			if (!e)
+				return (0);
+			destroy(e);
+			return (1);
+		}
+
+		// 콜백 없이 모두 지운다
+		void			clear()
+		{
+			while (!_order.empty())
+				destroy(&_order.back());
+		}
+
+		size_type		size() const
+		{ return (_table.size()); }
+
+		bool			empty() const
+		{ return (_table.size() == 0); }
+
+		// 들어 있는 원소의 무게 합
+		size_type		weight() const
+		{ return (_weight); }
+
+		size_type		capacity() const
+		{ return (_capacity); }
+
+		// 줄이면 바로 밀어낸다
+		void			set_capacity(size_type capacity)
+		{
+			_capacity = capacity;
+			evict_to(_capacity);
+		}
+
+		void			set_evict_callback(evict_callback callback, void *context)
+		{
+			_callback = callback;
+			_context = context;
+		}
+
+		CacheStats		stats() const
+		{ return (_stats); }
+
+		void			reset_stats()
+		{ _stats = CacheStats(); }
+
+		// 가장 최근 원소부터 f(key, value)를 부른다. 순서는 바꾸지 않는다
+		template <class Function>
+		Function		for_each(Function f) const
+		{
+			for (typename list_type::const_iterator it = _order.begin(); it != _order.end(); ++it)
+				f(it->key, it->value);
+			return (f);
+		}
+
+	private:
+		void			evict_to(size_type limit)
+		{
+			Entry	*victim;
+
+			while (_weight > limit && !_order.empty())
+			{
+				victim = &_order.back();
+				if (_callback)
+					_callback(victim->key, victim->value, _context);
+				++_stats.evictions;
+				destroy(victim);
+			}
+		}
+
+		void			destroy(Entry *e)
+		{
+			_table.remove(e);
+			_order.erase(list_type::iterator_to(*e));
+			_weight -= e->weight;
+			_entries.destroy(e);
+			_entries.deallocate(e, 1);
+		}
+
+		LruCache(const LruCache &);
+		LruCache	&operator=(const LruCache &);
+	};
+
+	// CLOCK(두 번째 기회) 캐시, LruCache와 같은 API
+	// 원소는 고리 모양 리스트에 들어간 순서대로 있고, 찾으면 원소의 참조 비트만 세운다. 리스트를 고치지
+	// 않으므로 get이 구조를 바꾸지 않고, ShardedCache는 get에 읽기 잠금만 잡아 여러 스레드가 동시에
+	// 찾을 수 있다. 밀어낼 때는 시곗바늘을 돌리며 참조 비트가 선 원소는 비트만 내리고 지나가고,
+	// 내려가 있는 원소를 밀어낸다. 가장 최근에 쓴 원소를 정확히 남기지는 않지만 LRU에 가깝다.
+	template < class Key, class Value, class Hash = ft::hash<Key>, class Weigher = ft::unit_weight<Key, Value>,
+				class Alloc = std::allocator<Value> >
+	class ClockCache
+	{
+	public:
+		typedef Key						key_type;
+		typedef Value					mapped_type;
+		typedef Hash					hasher;
+		typedef Weigher					weigher_type;
+		typedef Alloc					allocator_type;
+		typedef size_t					size_type;
+		typedef void	(*evict_callback)(const Key &key, const Value &value, void *context);
+
+		// get은 참조 비트와 통계만 원자적으로 쓰므로 여러 스레드가 동시에 불러도 된다
+		enum { SHARED_GET = 1 };
+
+	private:
+		struct Entry
+		{
+			Key			key;
+			Value		value;
+			size_t		weight;
+			size_t		hash;
+			Entry		*chain;
+			ListHook	hook;
+			int			referenced;
+
+			Entry(const Key &k, const Value &v, size_t w, size_t h)
+				: key(k), value(v), weight(w), hash(h), chain(0), referenced(0)
+			{
+			}
+		};
+
+		typedef ft::IntrusiveList<Entry, &Entry::hook>							list_type;
+		typedef typename list_type::iterator									list_iterator;
+		typedef typename allocator_type::template rebind<Entry>::other		entry_allocator;
+
+		detail::CacheTable<Key, Entry, Hash>	_table;
+		list_type				_ring;
+		// 다음에 볼 원소, end()면 처음으로 돌아간다
+		list_iterator			_hand;
+		entry_allocator			_entries;
+		weigher_type			_weigher;
+		size_type				_capacity;
+		size_type				_weight;
+		evict_callback			_callback;
+		void					*_context;
+		CacheStats				_stats;
+
+	public:
+		explicit ClockCache(size_type capacity, const weigher_type &weigher = weigher_type(), const hasher &hash = hasher(),
+						const allocator_type &alloc = allocator_type())
+			: _table(hash), _ring(), _entries(alloc), _weigher(weigher), _capacity(capacity), _weight(0),
+			_callback(0), _context(0), _stats()
+		{
+			_hand = _ring.end();
+		}
+
+		~ClockCache()
+		{
+			clear();
+		}
+
+		// 참조 비트를 세운다. 이미 서 있으면 아무것도 쓰지 않는다
+		mapped_type		*get(const key_type &k)
+		{
+			Entry	*e = _table.find(k, _table.hash(k));
+
+			if (!e)
+			{
+				__atomic_add_fetch(&_stats.misses, 1, __ATOMIC_RELAXED);
+				return (0);
+			}
+			__atomic_add_fetch(&_stats.hits, 1, __ATOMIC_RELAXED);
+			if (!__atomic_load_n(&e->referenced, __ATOMIC_RELAXED))
+				__atomic_store_n(&e->referenced, 1, __ATOMIC_RELAXED);
+			return (&e->value);
+		}
+
+		const mapped_type	*peek(const key_type &k) const
+		{
+			Entry	*e = _table.find(k, _table.hash(k));
+
+			return (e ? &e->value : 0);
+		}
+
+		bool			contains(const key_type &k) const
+		{ return (peek(k) != 0); }
+
+		// 새 원소는 바늘 바로 앞(이번 바퀴에서 가장 늦게 보는 자리)에 넣는다
+		// 자리는 넣기 전에 만든다. 넣고 나서 밀어내면 다른 원소가 모두 참조 비트가 서 있을 때
+		// 바늘이 한 바퀴 돌아 방금 넣은 원소를 밀어낸다.
+		bool			put(const key_type &k, const mapped_type &v)
+		{
+			size_t		h = _table.hash(k);
+			size_type	w = _weigher(k, v);
+			Entry		*e = _table.find(k, h);
+
+			if (w > _capacity)
+			{
+				if (e)
+					destroy(e);
+				return (false);
+			}
+			if (e)
+			{
+				// 고친 원소도 밀려나지 않도록 고리에서 잠시 뺀다
+				e->value = v;
+				unlink(e);
+				evict_to(_capacity - w);
+				e->weight = w;
+				e->referenced = 1;
+			}
+			else
+			{
+				// k, v가 캐시 안의 값일 수 있으므로 밀어내기 전에 복사해 둔다.
+				// 아직 고리에 없으니 바늘이 이 원소를 밀어낼 일은 없다
+				e = _entries.allocate(1);
+				try
+				{
+					_entries.construct(e, Entry(k, v, w, h));
+				}
+				catch (...)
+				{
+					_entries.deallocate(e, 1);
+					throw ;
+				}
+				evict_to(_capacity - w);
+				_table.insert(e);
+			}
+			_ring.insert(_hand, *e);
+			_weight += w;
+			return (true);
+		}
+
+		size_type		erase(const key_type &k)
+		{
+			Entry	*e = _table.find(k, _table.hash(k));
+
+			if (!e)
+				return (0);
+			destroy(e);
+			return (1);
+		}
+
+		void			clear()
+		{
+			while (!_ring.empty())
+				destroy(&_ring.front());
+		}
+
+		size_type		size() const
+		{ return (_table.size()); }
+
+		bool			empty() const
+		{ return (_table.size() == 0); }
+
+		size_type		weight() const
+		{ return (_weight); }
+
+		size_type		capacity() const
+		{ return (_capacity); }
+
+		void			set_capacity(size_type capacity)
+		{
+			_capacity = capacity;
+			evict_to(_capacity);
+		}
+
+		void			set_evict_callback(evict_callback callback, void *context)
+		{
+			_callback = callback;
+			_context = context;
+		}
+
+		CacheStats		stats() const
+		{
+			CacheStats	ret;
+
+			ret.hits = __atomic_load_n(&_stats.hits, __ATOMIC_RELAXED);
+			ret.misses = __atomic_load_n(&_stats.misses, __ATOMIC_RELAXED);
+			ret.evictions = _stats.evictions;
+			return (ret);
+		}
+
+		void			reset_stats()
+		{ _stats = CacheStats(); }
+
+		// 바늘 위치부터 한 바퀴 f(key, value)를 부른다 (다음에 밀려날 후보부터)
+		template <class Function>
+		Function		for_each(Function f) const
+		{
+			list_type		&ring = const_cast<list_type &>(_ring);
+			list_iterator	it = _hand;
+
+			for (size_type i = 0; i < _table.size(); ++i, ++it)
+			{
+				if (it == ring.end())
+					it = ring.begin();
+				f(it->key, it->value);
+			}
+			return (f);
+		}
+
+	private:
+		void			evict_to(size_type limit)
+		{
+			Entry	*victim;
+
+			while (_weight > limit && !_ring.empty())
+			{
+				if (_hand == _ring.end())
+					_hand = _ring.begin();
+				victim = &*_hand;
+				if (victim->referenced)
+				{
+					victim->referenced = 0;
+					++_hand;
+					continue ;
+				}
+				if (_callback)
+					_callback(victim->key, victim->value, _context);
+				++_stats.evictions;
+				destroy(victim);
+			}
+		}
+
+		// 고리에서만 뺀다. 바늘이 가리키는 원소면 바늘을 먼저 옮긴다
+		void			unlink(Entry *e)
+		{
+			list_iterator	it = list_type::iterator_to(*e);
+
+			if (_hand == it)
+				++_hand;
+			_ring.erase(it);
+			_weight -= e->weight;
+		}
+
+		void			destroy(Entry *e)
+		{
+			unlink(e);
+			_table.remove(e);
+			_entries.destroy(e);
+			_entries.deallocate(e, 1);
+		}
+
+		ClockCache(const ClockCache &);
+		ClockCache	&operator=(const ClockCache &);
+	};
+
+	// 키의 해시로 샤드를 골라 샤드마다 따로 잠그는 캐시, Cache는 LruCache나 ClockCache
+	// 용량은 샤드에 똑같이 나누고 나머지는 앞쪽 샤드에 하나씩 더 준다. 값은 잠금 밖으로 복사해서 돌려준다.
+	// Cache::SHARED_GET이면(ClockCache) get에 읽기 잠금만 잡는다. 밀어내기 콜백은 샤드 잠금을 잡은 채 불린다.
+	template <class Cache>
+	class ShardedCache
+	{
+	public:
+		typedef typename Cache::key_type			key_type;
+		typedef typename Cache::mapped_type			mapped_type;
+		typedef typename Cache::hasher				hasher;
+		typedef typename Cache::weigher_type		weigher_type;
+		typedef typename Cache::allocator_type		allocator_type;
+		typedef typename Cache::size_type			size_type;
+		typedef typename Cache::evict_callback		evict_callback;
+		typedef Cache								cache_type;
+
+		enum { CACHE_LINE = 64 };
+
+	private:
+		// 이웃한 샤드의 잠금이 같은 캐시 라인에 놓이지 않도록 뒤를 채운다
+		struct Shard
+		{
+			pthread_rwlock_t	lock;
+			cache_type			cache;
+			char				pad[CACHE_LINE];
+
+			Shard(size_type capacity, const weigher_type &weigher, const hasher &hash, const allocator_type &alloc)
+				: cache(capacity, weigher, hash, alloc)
+			{
+				pthread_rwlock_init(&lock, 0);
+			}
+
+			~Shard()
+			{
+				pthread_rwlock_destroy(&lock);
+			}
+		};
+
+		typedef typename allocator_type::template rebind<Shard>::other		shard_allocator;
+
+		hasher			_hash;
+		shard_allocator	_shard_allocator;
+		Shard			*_shards;
+		size_type		_shard_count;
+
+	public:
+		ShardedCache(size_type shards, size_type capacity, const weigher_type &weigher = weigher_type(),
+					const hasher &hash = hasher(), const allocator_type &alloc = allocator_type())
+			: _hash(hash), _shard_allocator(alloc), _shard_count(shards ? shards : 1)
+		{
+			size_type	per_shard = capacity / _shard_count;
+			size_type	extra = capacity % _shard_count;
+
+			_shards = _shard_allocator.allocate(_shard_count);
+			for (size_type i = 0; i < _shard_count; ++i)
+				new (static_cast<void *>(_shards + i)) Shard(per_shard + (i < extra), weigher, hash, alloc);
+		}
+
+		~ShardedCache()
+		{
+			for (size_type i = 0; i < _shard_count; ++i)
+				_shards[i].~Shard();
+			_shard_allocator.deallocate(_shards, _shard_count);
+		}
+
+		size_type		shard_count() const
+		{ return (_shard_count); }
+
+		// 있으면 out에 복사하고 true
+		bool			get(const key_type &k, mapped_type &out)
+		{
+			Shard		&s = shard(k);
+			mapped_type	*v;
+
+			if (Cache::SHARED_GET)
+				pthread_rwlock_rdlock(&s.lock);
+			else
+				pthread_rwlock_wrlock(&s.lock);
+			v = s.cache.get(k);
+			if (v)
+				out = *v;
+			pthread_rwlock_unlock(&s.lock);
+			return (v != 0);
+		}
+
+		bool			put(const key_type &k, const mapped_type &v)
+		{
+			Shard	&s = shard(k);
+			bool	ret;
+
+			pthread_rwlock_wrlock(&s.lock);
+			ret = s.cache.put(k, v);
+			pthread_rwlock_unlock(&s.lock);
+			return (ret);
+		}
+
+		size_type		erase(const key_type &k)
+		{
+			Shard		&s = shard(k);
+			size_type	ret;
+
+			pthread_rwlock_wrlock(&s.lock);
+			ret = s.cache.erase(k);
+			pthread_rwlock_unlock(&s.lock);
+			return (ret);
+		}
+
+		void			clear()
+		{
+			for (size_type i = 0; i < _shard_count; ++i)
+			{
+				pthread_rwlock_wrlock(&_shards[i].lock);
+				_shards[i].cache.clear();
+				pthread_rwlock_unlock(&_shards[i].lock);
+			}
+		}
+
+		// 샤드를 하나씩 잠그며 더하므로 동시에 바뀌는 중이면 근삿값
+		size_type		size() const
+		{ return (sum(&cache_type::size)); }
+
+		size_type		weight() const
+		{ return (sum(&cache_type::weight)); }
+
+		size_type		capacity() const
+		{ return (sum(&cache_type::capacity)); }
+
+		void			set_evict_callback(evict_callback callback, void *context)
+		{
+			for (size_type i = 0; i < _shard_count; ++i)
+			{
+				pthread_rwlock_wrlock(&_shards[i].lock);
+				_shards[i].cache.set_evict_callback(callback, context);
+				pthread_rwlock_unlock(&_shards[i].lock);
+			}
+		}
+
+		CacheStats		stats() const
+		{
+			CacheStats	ret;
+
+			for (size_type i = 0; i < _shard_count; ++i)
+			{
+				pthread_rwlock_rdlock(&_shards[i].lock);
+				ret += _shards[i].cache.stats();
+				pthread_rwlock_unlock(&_shards[i].lock);
+			}
+			return (ret);
+		}
+
+	private:
+		// 테이블 버킷은 해시의 아래 비트로 고르므로 샤드는 섞은 해시로 고른다
+		Shard			&shard(const key_type &k) const
+		{
+			return (_shards[hash_mix(_hash(k)) % _shard_count]);
+		}
+
+		size_type		sum(size_type (cache_type::*get)() const) const
+		{
+			size_type	ret = 0;
+
+			for (size_type i = 0; i < _shard_count; ++i)
+			{
+				pthread_rwlock_rdlock(&_shards[i].lock);
+				ret += (_shards[i].cache.*get)();
+				pthread_rwlock_unlock(&_shards[i].lock);
+			}
+			return (ret);
+		}
+
+		ShardedCache(const ShardedCache &);
+		ShardedCache	&operator=(const ShardedCache &);
+	};
+}
+
+#endif
@@ -2,9 +2,7 @@
 # define MAP_HPP
 
 # include <memory>
-# include "MapNode.hpp"
-# include "MapIterator.hpp"
-# include "ReverseMapIterator.hpp"
+# include "RbTree.hpp"
 # include "utils.hpp"
 
 namespace ft
@@ -47,14 +45,10 @@ namespace ft
 		typedef size_t										size_type;
 
 	private:
-		typedef typename allocator_type::template
-				rebind< MapNode<value_type> >::other		node_allocator;
-		typedef typename node_allocator::pointer			node_pointer;
+		typedef ft::RbTree<key_type, value_type, ft::Select1st<value_type>, key_compare, allocator_type>	tree_type;
+
+		tree_type				_tree;
 
-		allocator_type			_allocator;
-		node_allocator			_node_allocator;
-		key_compare				_key_comp;
-		MapNode<value_type>*	_root;
 
 	public:
 
@@ -99,144 +93,86 @@ namespace ft
 //     Member type value_type is the type of the elements in the container, defined in map as an alias of pair<const key_type, mapped_type> (see map types).
 
 		explicit Map(const key_compare &comp = key_compare(), const allocator_type& alloc = allocator_type()) 
-			: _allocator(alloc), _key_comp(comp), _root(0)
+			: _tree(comp, alloc)
 		{
-			
 		}
 
 		template <class InputIterator>
 		Map (InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
-			: _allocator(alloc), _key_comp(comp), _root(0)
+			: _tree(comp, alloc)
 		{
-			while (first != last)
-			{
-				insert(*first);
-				++first;
-			}
+			insert(first, last);
 		}
 
-		Map (const Map& copy) : _allocator(copy._allocator), _key_comp(copy._key_comp), _root(0)
+		// 트리 구조를 그대로 복제, O(n)
+		Map (const Map& copy) : _tree(copy._tree)
 		{
-			this->insert(copy.begin(), copy.end());
 		}
 
 		~Map()
 		{
-			clear();
 		}
 
 
 		Map& operator=(const Map& x)
 		{
-			if (_root != 0)
-				this->clear();
-			this->insert(x.begin(), x.end());
+			_tree = x._tree;
 			return (*this);
 		}
 
 		iterator begin()
 		{
-			iterator			begin(_root);
-
-			if (_root == 0)
-				return (0);
-			while (begin._element->_left)
-			{
-				begin._element = begin._element->_left;
-			}
-			return (begin);
+			return (_tree.begin());
 		}
 
 		const_iterator begin() const
 		{
-			node_pointer		begin;
-
-			if (_root == 0)
-				return (0);
-			begin = _root;
-			while (begin->_left)
-			{
-				begin = begin->_left;
-			}
-			return (begin);
+			return (_tree.begin());
 		}
 
 		iterator end()
 		{
-			return (0);
+			return (_tree.end());
 		}
 
 		const_iterator end() const
 		{
-			return (0);
+			return (_tree.end());
 		}
 
 		reverse_iterator rbegin()
 		{
-			node_pointer		end;
-
-			if (_root == 0)
-				return (0);
-			end = _root;
-			while (end->_right)
-			{
-				end = end->_right;
-			}
-			return (end);
+			return (_tree.rbegin());
 		}
 
 		const_reverse_iterator rbegin() const
 		{
-			node_pointer		end;
-
-			if (_root == 0)
-				return (0);
-			end = _root;
-			while (end->_right)
-			{
-				end = end->_right;
-			}
-			return (end);
+			return (_tree.rbegin());
 		}
 
 		reverse_iterator rend()
 		{
-			return (0);
+			return (_tree.rend());
 		}
 
 		const_reverse_iterator rend() const
 		{
-			return (0);
+			return (_tree.rend());
 		}
 
 		bool		empty() const
 		{
-			if (size() == 0)
-				return (true);
-			else
-				return (false);
+			return (_tree.empty());
 		}
 
 		size_type	size() const
 		{
-			iterator		iter;
-			size_type		i;
-
-			if (_root == 0)
-				return (0);
-			i = 0;
-			iter = begin();
-			while (iter != end())
-			{
-				++iter;
-				++i;
-			}
-			return (i);
+			return (_tree.size());
 		}
 
 		size_type	max_size() const
 		{
-			return (_node_allocator.max_size());
+			return (_tree.max_size());
 		}
 
 // Access element
@@ -262,21 +198,9 @@ namespace ft
 
 // Member type mapped_type is the type of the mapped values in the container, 
 // defined in map as an alias of its second template parameter (T).
-
 		mapped_type&	operator[](const key_type& k)
 		{
-			iterator	target;
-
-			if (_root)
-			{
-				target = find(k);
-				if (target._element)
-					return (target->second);
-				else
-					return ((insert(value_type(k, mapped_type())).first)->second);
-			}
-			else
-				return ((insert(value_type(k, mapped_type())).first)->second);
+			return ((_tree.insert_unique(value_type(k, mapped_type())).first)->second);
 		}
 
 // Insert elements
@@ -337,21 +261,12 @@ namespace ft
 
 		ft::Pair<iterator, bool>	insert(const value_type& val)
 		{
-			if (_root == 0)
-			{
-				_root = _node_allocator.allocate(1);
-				_node_allocator.construct(_root, MapNode<value_type>(val));
-				return (ft::Pair<iterator, bool>(_root, true));
-			}
-			else
-			{
-				return (insert_value(_root, val));
-			}
+			return (_tree.insert_unique(val));
 		}
 
 		iterator insert(iterator position, const value_type &val)
 		{
-			return (insert_value(position._element, val).first);
+			return (_tree.insert_unique(position, val));
 		}
 
 		template <class InputIterator>
@@ -359,7 +274,7 @@ namespace ft
 		{
 			while (first != last)
 			{
-				insert(*first);
+				_tree.insert_unique(*first);
 				++first;
 			}
 		}
@@ -390,104 +305,40 @@ namespace ft
 
 // Member type size_type is an unsigned integral type.
 
+		// 후속 노드의 값을 복사하지 않고 노드 자체를 다시 연결하므로
+		// 지워지는 원소 외의 이터레이터는 모두 유효하다.
 		void		erase(iterator position)
 		{
-			if (position._element->_left && position._element->_right) // 자식 노드가 두개 있는 경우
-			{
-				iterator		successor(position._element->_right);
-
-				while (successor._element->_left)
-				{
-					successor = successor._element->_left;
-				}
-				position._element->_data = successor._element->_data;
-				erase(successor);
-			}
-			else if (position._element->_left || position._element->_right) // 자식 노드가 하나 있는 경우
-			{
-				if (position._element->_left)
-				{
-					if (position._element->_parent)
-					{
-						if (position._element->_parent->_left == position._element)
-							position._element->_parent->_left = position._element->_left;
-						else
-							position._element->_parent->_right = position._element->_left;
-						position._element->_left->_parent = position._element->_parent;
-					}
-					else
-					{
-						_root = position._element->_left;
-						position._element->_left->_parent = position._element->_parent;
-					}
-				}
-				else
-				{
-					if (position._element->_parent)
-					{
-						if (position._element->_parent->_left == position._element)
-							position._element->_parent->_left = position._element->_right;
-						else
-							position._element->_parent->_right = position._element->_right;
-						position._element->_right->_parent = position._element->_parent;
-					}
-					else
-					{
-						_root = position._element->_right;
-						position._element->_right->_parent = position._element->_parent;
-					}
-				}
-				_node_allocator.destroy(position._element);
-				_node_allocator.deallocate(position._element, 1);
-			}
-			else // 자식 노드가 없는경우
-			{
-				if (position._element->_parent)
-				{
-					if (position._element->_parent->_left == position._element)
-						position._element->_parent->_left = 0;
-					else
-						position._element->_parent->_right = 0;
-				}
-				else
-					_root = 0;
-				_node_allocator.destroy(position._element);
-				_node_allocator.deallocate(position._element, 1);
-			}
+			_tree.erase(position);
 		}
 
 		size_type	erase(const key_type& k)
 		{
-			iterator	target;
-
-			target = find(k);
-			if (target._element == 0)
-				return (0);
-			else
-			{
-				erase(target);
-				return (1);
-			}
+			return (_tree.erase_key(k));
 		}
 
+		// 범위를 먼저 떼어낸 뒤 한 번에 해제, O(k + log n)
 		void		erase(iterator first, iterator last)
 		{
-			while (first != last)
-			{
-				erase(first++);
-			}
+			_tree.erase(first, last);
+		}
+
+		// 내용을 gen()이 차례로 돌려주는 n개의 원소로 바꾼다, O(n)
+		// 원소는 키가 겹치지 않고 key_comp 순서로 정렬돼 있어야 한다 (예: 다른 Map을 순회한 결과)
+		template <class Generator>
+		void	assign_sorted(size_type n, Generator &gen)
+		{
+			_tree.build_sorted(n, gen);
 		}
 
 		void	swap(Map& x)
 		{
-			ft::swap(_allocator, x._allocator);
-			ft::swap(this->_root, x._root);
-			ft::swap(this->_key_comp, x._key_comp);
+			_tree.swap(x._tree);
 		}
 
 		void clear()
 		{
-			this->erase(this->begin(), this->end());
+			_tree.clear();
 		}
 
 // Return key comparison object
@@ -509,9 +360,10 @@ namespace ft
 
 		key_compare key_comp() const
 		{
-			return (key_compare());
+			return (_tree.key_comp());
 		}
 
+
 // Return value comparison object
 // Returns a comparison object that can be used to compare two elements to get whether the key of the first one goes before the second.
 
@@ -531,7 +383,7 @@ namespace ft
 
 		value_compare value_comp() const
 		{
-			return (value_compare(key_compare()));
+			return (value_compare(_tree.key_comp()));
 		}
 
 // Get iterator to element
@@ -553,33 +405,14 @@ namespace ft
 
 // Member types iterator and const_iterator are bidirectional iterator types pointing to elements (of type value_type).
 // Notice that value_type in map containers is an alias of pair<const key_type, mapped_type>.
-		MapNode<value_type>*		find_key(MapNode<value_type> *node, const key_type &k) const
-		{
-			if (k < (node->_data).first)
-			{
-				if (node->_left)
-					return (find_key(node->_left, k));
-				else
-					return (0);
-			}
-			else if (k > (node->_data).first)
-			{
-				if (node->_right)
-					return (find_key(node->_right, k));
-				else
-					return (0);
-			}
-			return (node);
-		}
-
 		iterator find (const key_type& k)
 		{
-			return (find_key(_root, k));
+			return (_tree.find(k));
 		}
 
 		const_iterator find (const key_type& k) const
 		{
-			return (find_key(_root, k));
+			return (_tree.find(k));
 		}
 
 // Count elements with a specific key
@@ -601,12 +434,10 @@ namespace ft
 
 		size_type count (const key_type& k) const
 		{
-			if (find_key(_root, k))
-				return (1);
-			else
-				return (0);
+			return (_tree.find(k)._element != 0 ? 1 : 0);
 		}
 
+
 // Return iterator to lower bound
 // Returns an iterator pointing to the first element in the container whose key is not considered to go before k 
 // (i.e., either it is equivalent or goes after).
@@ -631,17 +462,19 @@ namespace ft
 // Notice that value_type in map containers is itself also a pair type: pair<const key_type, mapped_type>.
 
 
+
 		iterator lower_bound (const key_type& k)
 		{
-			return (find_key(_root, k));
+			return (_tree.lower_bound(k));
 		}
 
 		const_iterator lower_bound (const key_type& k) const
 		{
-			return (find_key(_root, k));
+			return (_tree.lower_bound(k));
 		}
 
 
+
 // Return iterator to upper bound
 // Returns an iterator pointing to the first element in the container whose key is considered to go after k.
 
@@ -665,14 +498,15 @@ namespace ft
 
 		iterator upper_bound (const key_type& k)
 		{
-			return (++find(k));
+			return (_tree.upper_bound(k));
 		}
 
 		const_iterator upper_bound (const key_type& k) const
 		{
-			return (++find(k));
+			return (_tree.upper_bound(k));
 		}
 
+
 // Get range of equal elements
 // Returns the bounds of a range that includes all the elements in the container which have a key equivalent to k.
 
@@ -697,14 +531,15 @@ namespace ft
 
 		ft::Pair<const_iterator,const_iterator> equal_range (const key_type& k) const
 		{
-			return (ft::Pair<const_iterator, const_iterator>(lower_bound(k), upper_bound(k)));
+			return (_tree.equal_range(k));
 		}
 
 		ft::Pair<iterator,iterator>             equal_range (const key_type& k)
 		{
-			return (ft::Pair<iterator, iterator>(lower_bound(k), upper_bound(k)));
+			return (_tree.equal_range(k));
 		}
 
+
 // Get allocator
 // Returns a copy of the allocator object associated with the map.
 
@@ -715,48 +550,9 @@ namespace ft
 // The allocator.
 
 // Member type allocator_type is the type of the allocator used by the container, defined in map as an alias of its fourth template parameter (Alloc).
-
 		allocator_type get_allocator() const
 		{
-			return (_allocator);
-		}
-
-	private:
-
-		ft::Pair<iterator, bool>	insert_value(MapNode<value_type> *node, const value_type& val)
-		{
-			if (val.first < (node->_data).first)
-			{
-				if (node->_left == 0)
-				{
-					node->_left = _node_allocator.allocate(1);
-					_node_allocator.construct(node->_left, MapNode<value_type>(val));
-					node->_left->_parent = node;
-					return (ft::Pair<iterator, bool>(node->_left, true));
-				}
-				else
-				{
-					return (insert_value(node->_left, val));
-				}
-			}
-			else if (val.first > (node->_data).first)
-			{
-				if (node->_right == 0)
-				{
-					node->_right = _node_allocator.allocate(1);
-					_node_allocator.construct(node->_right, MapNode<value_type>(val));
-					node->_right->_parent = node;
-					return (ft::Pair<iterator, bool>(node->_right, true));
-				}
-				else
-				{
-					return (insert_value(node->_right, val));
-				}
-			}
-			else
-			{
-				return (ft::Pair<iterator, bool>(node, false));
-			}
+			return (_tree.get_allocator());
 		}
 	};
 }
@@ -9,16 +9,17 @@ public:
 	MapNode<T>*	_parent;
 	MapNode<T>*	_left;
 	MapNode<T>*	_right;
+	bool		_red;		// red-black 트리 색, 새 노드는 빨강
 
-	MapNode() : _data(0), _parent(0), _left(0), _right(0)
+	MapNode() : _data(0), _parent(0), _left(0), _right(0), _red(true)
 	{
 	}
 
-	MapNode(const T& data) : _data(data), _parent(0), _left(0), _right(0)
+	MapNode(const T& data) : _data(data), _parent(0), _left(0), _right(0), _red(true)
 	{
 	}
 
-	MapNode(const MapNode &copy) : _data(copy._data), _parent(copy._parent), _left(copy._left), _right(copy._right)
+	MapNode(const MapNode &copy) : _data(copy._data), _parent(copy._parent), _left(copy._left), _right(copy._right), _red(copy._red)
 	{
 	}
 
@@ -28,6 +29,7 @@ public:
 		this->_parent = ref._parent;
 		this->_left = ref._left;
 		this->_right = ref._right;
+		this->_red = ref._red;
 		return (*this);
 	}
 
@@ -37,4 +39,4 @@ public:
 
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,525 @@
+#ifndef MAPPED_MAP_HPP
+# define MAPPED_MAP_HPP
+
+# include <cstddef>
+# include <cstdio>
+# include <cstring>
+# include <cerrno>
+# include <string>
+# include <stdexcept>
+# include <fcntl.h>
+# include <unistd.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include "Map.hpp"
+# include "Vector.hpp"
+# include "Serialize.hpp"
+# include "utils.hpp"
+
+namespace ft
+{
+	// ft::Map을 mmap으로 바로 읽을 수 있는 바뀌지 않는 파일(이미지)로 내보내고, MappedMap으로 연다
+	//
+	// 이미지: 128바이트 헤더, 키 배열, 값 배열, 색인 키 배열, 색인 순위 배열 (각 배열은 64바이트 경계)
+	// 헤더에는 각 배열의 파일 안 위치(offset)만 있고 포인터는 없으므로 어느 주소에 매핑해도 된다.
+	// 색인은 키 MAP_IMAGE_BLOCK개마다 첫 키를 뽑아 Eytzinger 순서(k의 자식이 2k, 2k + 1)로 늘어놓은
+	// 것이다. 찾을 때는 색인을 위에서부터 내려가 블록을 고르고 블록 안에서 이분 탐색한다.
+	// 위쪽 층이 앞의 몇 캐시 라인에 모이므로 큰 이미지에서도 캐시 미스가 적다.
+	//
+	// 키와 값은 memcpy로 옮겨도 되는 타입이어야 하고, 기계의 바이트 순서를 그대로 쓴다.
+	// 이미지를 쓸 때와 같은 Compare로 열어야 한다 (확인하지 않는다).
+	class map_image_error : public std::runtime_error
+	{
+	public:
+		explicit map_image_error(const std::string &what) : std::runtime_error("ft::MappedMap: " + what)
+		{
+		}
+	};
+
+	enum
+	{
+		MAP_IMAGE_VERSION = 1,
+		// 색인 한 칸이 맡는 키 수
+		MAP_IMAGE_BLOCK = 16
+	};
+
+	namespace detail
+	{
+		struct MapImageHeader
+		{
+			char				magic[8];
+			unsigned int		version;
+			unsigned int		key_size;
+			unsigned int		value_size;
+			unsigned int		block;
+			unsigned long long	count;
+			unsigned long long	key_offset;
+			unsigned long long	value_offset;
+			// 색인 칸 수, 색인 배열은 1부터 쓰므로 index_count + 1칸이다
+			unsigned long long	index_count;
+			unsigned long long	index_offset;
+			unsigned long long	rank_offset;
+			unsigned long long	file_bytes;
+			char				pad[48];
+		};
+
+		enum { MAP_IMAGE_HEADER_BYTES = 128, MAP_IMAGE_ALIGN = 64 };
+
+		inline unsigned long long	image_align(unsigned long long off)
+		{
+			return ((off + MAP_IMAGE_ALIGN - 1) & ~static_cast<unsigned long long>(MAP_IMAGE_ALIGN - 1));
+		}
+
+		// 정렬된 fence[0, m)을 중위 순회 순서로 채워 Eytzinger 배열로 만든다
+		template <class K>
+		void	eytzinger_fill(const ft::Vector<K> &fence, size_t &next, size_t k,
+								ft::Vector<K> &index, ft::Vector<unsigned long long> &rank)
+		{
+			if (k > fence.size())
+				return ;
+			eytzinger_fill(fence, next, 2 * k, index, rank);
+			index[k] = fence[next];
+			rank[k] = next;
+			++next;
+			eytzinger_fill(fence, next, 2 * k + 1, index, rank);
+		}
+
+		// 작은 쓰기를 모아 OutputSink로 넘기고, 지금까지 쓴 바이트 수를 센다
+		class ImageWriter
+		{
+		private:
+			OutputSink			_out;
+			std::string			_buffer;
+			unsigned long long	_written;
+
+		public:
+			explicit ImageWriter(OutputSink out) : _out(out), _written(0)
+			{
+				_buffer.reserve(SERIALIZE_CHUNK_BYTES);
+			}
+
+			void	put(const void *data, size_t len)
+			{
+				_buffer.append(static_cast<const char *>(data), len);
+				_written += len;
+				if (_buffer.size() >= SERIALIZE_CHUNK_BYTES)
+					flush();
+			}
+
+			void	pad_to(unsigned long long off)
+			{
+				static const char	zero[MAP_IMAGE_ALIGN] = {};
+
+				while (_written < off)
+					put(zero, off - _written < MAP_IMAGE_ALIGN ? static_cast<size_t>(off - _written) : static_cast<size_t>(MAP_IMAGE_ALIGN));
+			}
+
+			void	flush()
+			{
+				if (!_buffer.empty())
+					_out.write(_buffer.data(), _buffer.size());
+				_buffer.clear();
+			}
+		};
+	}
+
+	// Map의 내용을 이미지로 쓴다. 맵을 키, 값 순서로 두 번 훑고, 버퍼 말고 추가 메모리는 색인 크기뿐이다
+	template <class Key, class T, class Compare, class Alloc>
+	void	write_map_image(const ft::Map<Key, T, Compare, Alloc> &m, OutputSink out)
+	{
+		typedef typename ft::Map<Key, T, Compare, Alloc>::iterator	iterator;
+		detail::MapImageHeader			h;
+		detail::ImageWriter				writer(out);
+		ft::Vector<Key>					fence;
+		ft::Vector<Key>					index;
+		ft::Vector<unsigned long long>	rank;
+		unsigned long long				n = m.size();
+		size_t							next = 0;
+		size_t							i = 0;
+
+		std::memset(static_cast<void *>(&h), 0, sizeof(h));
+		std::memcpy(h.magic, "FTMAPIMG", 8);
+		h.version = MAP_IMAGE_VERSION;
+		h.key_size = sizeof(Key);
+		h.value_size = sizeof(T);
+		h.block = MAP_IMAGE_BLOCK;
+		h.count = n;
+		h.index_count = (n + MAP_IMAGE_BLOCK - 1) / MAP_IMAGE_BLOCK;
+		h.key_offset = detail::image_align(detail::MAP_IMAGE_HEADER_BYTES);
+		h.value_offset = detail::image_align(h.key_offset + n * sizeof(Key));
+		h.index_offset = detail::image_align(h.value_offset + n * sizeof(T));
+		h.rank_offset = detail::image_align(h.index_offset + (h.index_count + 1) * sizeof(Key));
+		h.file_bytes = h.rank_offset + (h.index_count + 1) * sizeof(unsigned long long);
+		writer.put(&h, sizeof(h));
+		writer.pad_to(h.key_offset);
+		fence.reserve(h.index_count);
+		for (iterator it = m.begin(); it != m.end(); ++it, ++i)
+		{
+			if (i % MAP_IMAGE_BLOCK == 0)
+				fence.push_back(it->first);
+			writer.put(&it->first, sizeof(Key));
+		}
+		writer.pad_to(h.value_offset);
+		for (iterator it = m.begin(); it != m.end(); ++it)
+			writer.put(&it->second, sizeof(T));
+		writer.pad_to(h.index_offset);
+		if (h.index_count)
+		{
+			index.resize(h.index_count + 1, fence[0]);
+			rank.resize(h.index_count + 1, 0);
+			detail::eytzinger_fill(fence, next, 1, index, rank);
+			writer.put(&index[0], index.size() * sizeof(Key));
+		}
+		// 빈 맵이면 색인과 순위 배열의 쓰지 않는 0번 칸만 0으로 채운다
+		writer.pad_to(h.rank_offset);
+		if (h.index_count)
+			writer.put(&rank[0], rank.size() * sizeof(unsigned long long));
+		writer.pad_to(h.file_bytes);
+		writer.flush();
+	}
+
+	// path에 이미지를 쓴다. 임시 파일에 다 쓰고 fsync한 뒤 rename으로 바꾸므로,
+	// 이미 예전 이미지를 매핑한 프로세스는 계속 예전 내용을 보고 새로 여는 쪽은 새 내용만 본다
+	template <class Key, class T, class Compare, class Alloc>
+	void	write_map_image(const ft::Map<Key, T, Compare, Alloc> &m, const char *path)
+	{
+		std::string	tmp = std::string(path) + ".tmp";
+		int			fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+		if (fd < 0)
+			throw (map_image_error("open " + tmp + ": " + std::strerror(errno)));
+		try
+		{
+			write_map_image(m, OutputSink(fd));
+			if (fsync(fd) < 0)
+				throw (map_image_error(std::string("fsync: ") + std::strerror(errno)));
+		}
+		catch (...)
+		{
+			::close(fd);
+			unlink(tmp.c_str());
+			throw ;
+		}
+		::close(fd);
+		if (std::rename(tmp.c_str(), path) < 0)
+		{
+			unlink(tmp.c_str());
+			throw (map_image_error(std::string("rename: ") + std::strerror(errno)));
+		}
+	}
+
+	// write_map_image로 쓴 이미지를 읽기 전용으로 매핑해서 Map처럼 찾는 뷰
+	// 여는 비용은 mmap 한 번이고, 페이지는 처음 닿을 때 페이지 캐시에서 들어오며 프로세스끼리 나눠 쓴다.
+	// 이터레이터는 키와 값 배열의 순위 하나이고, *it는 Pair<Key, T>를 값으로 돌려준다.
+	template <class Key, class T, class Compare = ft::less<Key> >
+	class MappedMap
+	{
+	public:
+		typedef Key							key_type;
+		typedef T							mapped_type;
+		typedef ft::Pair<Key, T>			value_type;
+		typedef Compare						key_compare;
+		typedef size_t						size_type;
+		typedef ptrdiff_t					difference_type;
+
+		class iterator
+		{
+		public:
+			// it->first를 쓸 수 있게 Pair를 들고 있는 포인터 흉내
+			struct arrow
+			{
+				value_type	pair;
+
+				explicit arrow(const value_type &p) : pair(p) {}
+
+				const value_type	*operator-> () const
+				{ return (&pair); }
+			};
+
+		private:
+			const MappedMap	*_map;
+			size_type		_pos;
+
+		public:
+			iterator() : _map(0), _pos(0) {}
+			iterator(const MappedMap *m, size_type pos) : _map(m), _pos(pos) {}
+
+			const Key		&key() const
+			{ return (_map->_keys[_pos]); }
+
+			const T			&value() const
+			{ return (_map->_values[_pos]); }
+
+			// 키와 값 배열에서의 순위
+			size_type		rank() const
+			{ return (_pos); }
+
+			value_type		operator* () const
+			{ return (value_type(key(), value())); }
+
+			arrow			operator-> () const
+			{ return (arrow(**this)); }
+
+			iterator		&operator++ ()
+			{ ++_pos; return (*this); }
+			iterator		operator++ (int)
+			{ iterator	tmp(*this); ++_pos; return (tmp); }
+			iterator		&operator-- ()
+			{ --_pos; return (*this); }
+			iterator		operator-- (int)
+			{ iterator	tmp(*this); --_pos; return (tmp); }
+			iterator		&operator+= (difference_type n)
+			{ _pos += n; return (*this); }
+			iterator		operator+ (difference_type n) const
+			{ return (iterator(_map, _pos + n)); }
+			iterator		operator- (difference_type n) const
+			{ return (iterator(_map, _pos - n)); }
+			difference_type	operator- (const iterator &x) const
+			{ return (static_cast<difference_type>(_pos) - static_cast<difference_type>(x._pos)); }
+
+			bool			operator== (const iterator &x) const
+			{ return (_pos == x._pos && _map == x._map); }
+			bool			operator!= (const iterator &x) const
+			{ return (!(*this == x)); }
+			bool			operator< (const iterator &x) const
+			{ return (_pos < x._pos); }
+		};
+
+		typedef iterator					const_iterator;
+
+	private:
+		const detail::MapImageHeader	*_header;
+		size_t							_bytes;
+		const Key						*_keys;
+		const T							*_values;
+		const Key						*_index;
+		const unsigned long long		*_rank;
+		size_type						_size;
+		size_type						_index_count;
+		size_type						_block;
+		key_compare						_comp;
+
+	public:
+		explicit MappedMap(const key_compare &comp = key_compare())
+			: _header(0), _bytes(0), _keys(0), _values(0), _index(0), _rank(0),
+			_size(0), _index_count(0), _block(1), _comp(comp)
+		{
+		}
+
+		explicit MappedMap(const char *path, const key_compare &comp = key_compare())
+			: _header(0), _bytes(0), _keys(0), _values(0), _index(0), _rank(0),
+			_size(0), _index_count(0), _block(1), _comp(comp)
+		{
+			open(path);
+		}
+
+		~MappedMap()
+		{
+			close();
+		}
+
+		// 이미지를 매핑하고 헤더를 확인한다. 파일 디스크립터는 매핑 뒤 바로 닫는다
+		void			open(const char *path)
+		{
+			struct stat		st;
+			int				fd;
+			void			*p;
+
+			close();
+			fd = ::open(path, O_RDONLY);
+			if (fd < 0)
+				throw (map_image_error(std::string("open ") + path + ": " + std::strerror(errno)));
+			if (fstat(fd, &st) < 0 || static_cast<size_t>(st.st_size) < detail::MAP_IMAGE_HEADER_BYTES)
+			{
+				::close(fd);
+				throw (map_image_error("not an image"));
+			}
+			p = mmap(0, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+			::close(fd);
+			if (p == MAP_FAILED)
+				throw (map_image_error(std::string("mmap: ") + std::strerror(errno)));
+			_header = static_cast<const detail::MapImageHeader *>(p);
+			_bytes = st.st_size;
+			try
+			{
+				check();
+			}
+			catch (...)
+			{
+				close();
+				throw ;
+			}
+			_keys = reinterpret_cast<const Key *>(base() + _header->key_offset);
+			_values = reinterpret_cast<const T *>(base() + _header->value_offset);
+			_index = reinterpret_cast<const Key *>(base() + _header->index_offset);
+			_rank = reinterpret_cast<const unsigned long long *>(base() + _header->rank_offset);
+			_size = _header->count;
+			_index_count = _header->index_count;
+			_block = _header->block;
+		}
+
+		void			close()
+		{
+			if (_header)
+				munmap(const_cast<detail::MapImageHeader *>(_header), _bytes);
+			_header = 0;
+			_bytes = 0;
+			_keys = 0;
+			_values = 0;
+			_index = 0;
+			_rank = 0;
+			_size = 0;
+			_index_count = 0;
+			_block = 1;
+		}
+
+		bool			is_open() const
+		{ return (_header != 0); }
+
+		// 곧 많이 찾을 것이면 WILLNEED로 색인과 키를 미리 읽게 한다
+		void			advise(int madvice)
+		{
+			if (_header)
+				madvise(const_cast<detail::MapImageHeader *>(_header), _bytes, madvice);
+		}
+
+		size_type		size() const
+		{ return (_size); }
+
+		bool			empty() const
+		{ return (_size == 0); }
+
+		key_compare		key_comp() const
+		{ return (_comp); }
+
+		iterator		begin() const
+		{ return (iterator(this, 0)); }
+
+		iterator		end() const
+		{ return (iterator(this, _size)); }
+
+		// 키와 값 배열을 그대로 본다
+		const Key		*keys() const
+		{ return (_keys); }
+
+		const T			*values() const
+		{ return (_values); }
+
+		iterator		lower_bound(const key_type &k) const
+		{ return (iterator(this, search(k, false))); }
+
+		iterator		upper_bound(const key_type &k) const
+		{ return (iterator(this, search(k, true))); }
+
+		ft::Pair<iterator, iterator>	equal_range(const key_type &k) const
+		{
+			iterator	lo = lower_bound(k);
+
+			if (lo != end() && !_comp(k, lo.key()))
+				return (ft::Pair<iterator, iterator>(lo, lo + 1));
+			return (ft::Pair<iterator, iterator>(lo, lo));
+		}
+
+		iterator		find(const key_type &k) const
+		{
+			iterator	it = lower_bound(k);
+
+			if (it != end() && !_comp(k, it.key()))
+				return (it);
+			return (end());
+		}
+
+		size_type		count(const key_type &k) const
+		{ return (find(k) != end()); }
+
+		const T			&at(const key_type &k) const
+		{
+			iterator	it = find(k);
+
+			if (it == end())
+				throw (std::out_of_range("MappedMap::at"));
+			return (it.value());
+		}
+
+	private:
+		enum
+		{
+			KEY_ALIGN = __alignof__(Key) < 64 ? __alignof__(Key) : 64,
+			VALUE_ALIGN = __alignof__(T) < 64 ? __alignof__(T) : 64
+		};
+
+		MappedMap(const MappedMap &);
+		MappedMap		&operator=(const MappedMap &);
+
+		const char		*base() const
+		{ return (reinterpret_cast<const char *>(_header)); }
+
+		// 배열 [off, off + n * size)가 파일 안에 있고 정렬이 맞는지
+		bool			fits(unsigned long long off, unsigned long long n, size_t size, size_t align) const
+		{
+			return (off % align == 0 && off <= _bytes && n <= (_bytes - off) / size);
+		}
+
+		void			check() const
+		{
+			const detail::MapImageHeader	&h = *_header;
+
+			if (std::memcmp(h.magic, "FTMAPIMG", 8) != 0)
+				throw (map_image_error("bad magic"));
+			if (h.version != MAP_IMAGE_VERSION)
+				throw (map_image_error("unsupported version"));
+			if (h.key_size != sizeof(Key) || h.value_size != sizeof(T))
+				throw (map_image_error("key or value size mismatch"));
+			if (h.block == 0 || h.index_count != (h.count + h.block - 1) / h.block || h.file_bytes != _bytes)
+				throw (map_image_error("corrupt header"));
+			// 쓸 때는 배열을 64바이트에 맞추므로 타입의 정렬(64까지)만 보면 된다. 크기로 보면
+			// 12바이트 값 같은 것은 제대로 쓴 이미지도 못 연다
+			if (!fits(h.key_offset, h.count, sizeof(Key), KEY_ALIGN)
+				|| !fits(h.value_offset, h.count, sizeof(T), VALUE_ALIGN)
+				|| !fits(h.index_offset, h.index_count + 1, sizeof(Key), 1)
+				|| !fits(h.rank_offset, h.index_count + 1, sizeof(unsigned long long), 8))
+				throw (map_image_error("truncated image"));
+		}
+
+		// 색인 키 중 처음으로 go_right가 거짓인 칸의 순위, 없으면 _index_count
+		// go_right는 lower_bound면 index < k, upper_bound면 !(k < index)
+		size_type		search_index(const key_type &k, bool upper) const
+		{
+			size_type	i = 1;
+
+			while (i <= _index_count)
+			{
+				// 네 층 아래의 자식들은 한 캐시 라인에 모여 있으므로 미리 당긴다
+				__builtin_prefetch(_index + 16 * i);
+				i = 2 * i + (upper ? !_comp(k, _index[i]) : _comp(_index[i], k));
+			}
+			// 마지막으로 왼쪽으로 간 곳까지 되돌아간다
+			i >>= __builtin_ffsl(~i);
+			return (i ? static_cast<size_type>(_rank[i]) : _index_count);
+		}
+
+		size_type		search(const key_type &k, bool upper) const
+		{
+			size_type	block = search_index(k, upper);
+			size_type	lo;
+			size_type	hi;
+			size_type	mid;
+
+			if (block == 0)
+				return (0);
+			lo = (block - 1) * _block;
+			hi = block * _block < _size ? block * _block : _size;
+			while (lo < hi)
+			{
+				mid = lo + (hi - lo) / 2;
+				if (upper ? !_comp(k, _keys[mid]) : _comp(_keys[mid], k))
+					lo = mid + 1;
+				else
+					hi = mid;
+			}
+			return (lo);
+		}
+	};
+}
+
+#endif
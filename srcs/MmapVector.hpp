@@ -0,0 +1,504 @@
+#ifndef MMAP_VECTOR_HPP
+# define MMAP_VECTOR_HPP
+
+# include <cstddef>
+# include <cstring>
+# include <cerrno>
+# include <string>
+# include <stdexcept>
+# include <fcntl.h>
+# include <unistd.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include "utils.hpp"
+# include "VectorIterator.hpp"
+# include "ReverseVectorIterator.hpp"
+
+namespace ft
+{
+	class mmap_error : public std::runtime_error
+	{
+	public:
+		explicit mmap_error(const std::string &what) : std::runtime_error("ft::MmapVector: " + what)
+		{
+		}
+	};
+
+	// 원소를 파일에 두고 mmap으로 매핑한 Vector. T는 memcpy로 옮겨도 되는 타입이어야 한다
+	// (생성자와 소멸자를 부르지 않는다).
+	//
+	// 파일: 64바이트 헤더(표시, 버전, 원소 크기, 원소 수, 용량) 뒤에 원소 배열
+	// 원소 수도 매핑 안의 헤더에 있으므로 다시 열 때는 mmap 한 번이면 되고, 읽지 않은 페이지는
+	// 닿을 때 페이지 캐시에서 들어온다. MAP_SHARED라서 같은 파일을 연 프로세스끼리 페이지 캐시를
+	// 나눠 쓴다. 여러 프로세스가 동시에 쓰는 것은 막지 않는다 (바깥에서 잠가야 한다).
+	//
+	// 용량이 모자라면 두 배로 ftruncate하고 mremap으로 매핑을 늘린다. 매핑이 옮겨질 수 있으므로
+	// 용량이 바뀌면 이터레이터와 참조가 무효가 된다 (Vector와 같다).
+	// 파일에 쓴 내용이 디스크에 닿는 시점은 커널이 정한다. 바로 내려야 하면 sync()를 부른다.
+	template <typename T>
+	class MmapVector
+	{
+	public:
+		typedef T									value_type;
+		typedef T&									reference;
+		typedef const T&							const_reference;
+		typedef T*									pointer;
+		typedef const T*							const_pointer;
+		typedef VectorIterator<T>					iterator;
+		typedef const VectorIterator<T>				const_iterator;
+		typedef ReverseVectorIterator<T>			reverse_iterator;
+		typedef const ReverseVectorIterator<T>		const_reverse_iterator;
+		typedef ptrdiff_t							difference_type;
+		typedef size_t								size_type;
+
+		enum OpenMode
+		{
+			// 있으면 열고 없으면 만든다
+			READ_WRITE,
+			// 내용을 비우고 연다
+			TRUNCATE,
+			// 바꾸는 함수는 mmap_error를 던진다
+			READ_ONLY
+		};
+
+		// madvise에 넘기는 접근 방식
+		enum Advice
+		{
+			NORMAL,
+			// 앞에서부터 훑는다: 미리 많이 읽고 지나간 페이지는 빨리 내보낸다
+			SEQUENTIAL,
+			// 여기저기 찍는다: 미리 읽지 않는다
+			RANDOM,
+			// 곧 쓸 것이니 미리 읽어 둔다
+			WILLNEED,
+			// 당분간 쓰지 않는다 (내용은 파일에 남는다)
+			DONTNEED
+		};
+
+	private:
+		struct Header
+		{
+			char				magic[8];
+			unsigned int		version;
+			unsigned int		element_size;
+			unsigned long long	size;
+			unsigned long long	capacity;
+			char				pad[32];
+		};
+
+		enum { HEADER_BYTES = 64, VERSION = 1 };
+
+		int			_fd;
+		bool		_read_only;
+		Header		*_header;
+		pointer		_begin;
+		size_type	_capacity;
+
+	public:
+		MmapVector() : _fd(-1), _read_only(false), _header(0), _begin(0), _capacity(0)
+		{
+		}
+
+		explicit MmapVector(const char *path, OpenMode mode = READ_WRITE)
+			: _fd(-1), _read_only(false), _header(0), _begin(0), _capacity(0)
+		{
+			open(path, mode);
+		}
+
+		~MmapVector()
+		{
+			close();
+		}
+
+		// 파일을 연다. 이미 열려 있으면 먼저 닫는다
+		void				open(const char *path, OpenMode mode = READ_WRITE)
+		{
+			struct stat		st;
+			int				flags;
+
+			close();
+			_read_only = (mode == READ_ONLY);
+			flags = _read_only ? O_RDONLY : O_RDWR | O_CREAT;
+			if (mode == TRUNCATE)
+				flags |= O_TRUNC;
+			_fd = ::open(path, flags, 0644);
+			if (_fd < 0)
+				fail(std::string("open ") + path);
+			try
+			{
+				if (fstat(_fd, &st) < 0)
+					fail("fstat");
+				if (st.st_size == 0 && !_read_only)
+				{
+					if (ftruncate(_fd, HEADER_BYTES) < 0)
+						fail("ftruncate");
+					map(HEADER_BYTES);
+					std::memset(static_cast<void *>(_header), 0, HEADER_BYTES);
+					std::memcpy(_header->magic, "FTMMVEC", 8);
+					_header->version = VERSION;
+					_header->element_size = sizeof(T);
+					return ;
+				}
+				if (static_cast<size_t>(st.st_size) < HEADER_BYTES)
+					throw (mmap_error("file too short"));
+				map(st.st_size);
+				if (std::memcmp(_header->magic, "FTMMVEC", 8) != 0 || _header->version != VERSION)
+					throw (mmap_error("bad header"));
+				if (_header->element_size != sizeof(T))
+					throw (mmap_error("element size mismatch"));
+				if (_header->size > _capacity)
+					throw (mmap_error("size exceeds file"));
+			}
+			catch (...)
+			{
+				close();
+				throw ;
+			}
+		}
+
+		// 매핑을 풀고 파일을 닫는다. 내용은 페이지 캐시를 거쳐 파일에 남는다
+		void				close()
+		{
+			if (_header)
+				munmap(_header, map_bytes(_capacity));
+			if (_fd >= 0)
+				::close(_fd);
+			_fd = -1;
+			_header = 0;
+			_begin = 0;
+			_capacity = 0;
+		}
+
+		bool				is_open() const
+		{ return (_header != 0); }
+
+		bool				read_only() const
+		{ return (_read_only); }
+
+		// 바뀐 페이지를 파일에 내린다. wait가 거짓이면 내리기를 시작만 하고 돌아온다
+		void				sync(bool wait = true)
+		{
+			if (_header && !_read_only && msync(_header, map_bytes(_capacity), wait ? MS_SYNC : MS_ASYNC) < 0)
+				fail("msync");
+		}
+
+		// 앞으로의 접근 방식을 커널에 알린다. 결과에는 영향이 없다
+		void				advise(Advice advice)
+		{
+			static const int	table[] = { MADV_NORMAL, MADV_SEQUENTIAL, MADV_RANDOM, MADV_WILLNEED, MADV_DONTNEED };
+
+			if (_header && madvise(_header, map_bytes(_capacity), table[advice]) < 0)
+				fail("madvise");
+		}
+
+		iterator			begin()
+		{ return (_begin); }
+		const_iterator		begin() const
+		{ return (_begin); }
+		iterator			end()
+		{ return (_begin + size()); }
+		const_iterator		end() const
+		{ return (_begin + size()); }
+		reverse_iterator	rbegin()
+		{ return (_begin + size() - 1); }
+		const_reverse_iterator rbegin() const
+		{ return (_begin + size() - 1); }
+		reverse_iterator	rend()
+		{ return (_begin - 1); }
+		const_reverse_iterator rend() const
+		{ return (_begin - 1); }
+
+		// 다른 핸들이 파일을 늘렸으면 이 핸들의 매핑에 들어오는 데까지만 보인다
+		size_type			size() const
+		{
+			if (!_header)
+				return (0);
+			return (_header->size < _capacity ? static_cast<size_type>(_header->size) : _capacity);
+		}
+
+		size_type			max_size() const
+		{ return ((static_cast<size_type>(-1) - HEADER_BYTES) / sizeof(T)); }
+
+		size_type			capacity() const
+		{ return (_capacity); }
+
+		bool				empty() const
+		{ return (size() == 0); }
+
+		// 파일을 n개 크기로 늘린다. 늘어난 부분은 파일의 빈 곳이라 디스크를 차지하지 않는다
+		void				reserve(size_type n)
+		{
+			writable();
+			if (n > _capacity)
+				remap(n);
+		}
+
+		// 용량을 원소 수에 맞춰 파일을 줄인다
+		void				shrink_to_fit()
+		{
+			writable();
+			if (_capacity > size())
+				remap(size());
+		}
+
+		void				resize(size_type n, value_type val = value_type())
+		{
+			size_type	old = size();
+
+			writable();
+			if (n > _capacity)
+				remap(grow_to(n));
+			for (size_type i = old; i < n; ++i)
+				_begin[i] = val;
+			_header->size = n;
+		}
+
+		reference			operator[](size_type n)
+		{ return (_begin[n]); }
+		const_reference		operator[](size_type n) const
+		{ return (_begin[n]); }
+
+		reference			at(size_type n)
+		{
+			if (n >= size())
+				throw (std::out_of_range("_M_range_check"));
+			return (_begin[n]);
+		}
+
+		const_reference		at(size_type n) const
+		{
+			if (n >= size())
+				throw (std::out_of_range("_M_range_check"));
+			return (_begin[n]);
+		}
+
+		reference			front()
+		{ return (at(0)); }
+		const_reference		front() const
+		{ return (at(0)); }
+		reference			back()
+		{ return (at(size() - 1)); }
+		const_reference		back() const
+		{ return (at(size() - 1)); }
+
+		pointer				data()
+		{ return (_begin); }
+		const_pointer		data() const
+		{ return (_begin); }
+
+		template <typename InputIterator>
+		void				assign(InputIterator first, InputIterator last)
+		{
+			clear();
+			insert_range(end(), first, last);
+		}
+
+		void				assign(size_type n, const value_type &val)
+		{
+			clear();
+			resize(n, val);
+		}
+
+		void				push_back(const value_type &value)
+		{
+			size_type	n = size();
+
+			writable();
+			if (n == _capacity)
+			{
+				value_type	copy = value;
+
+				remap(grow_to(n + 1));
+				_begin[n] = copy;
+			}
+			else
+				_begin[n] = value;
+			_header->size = n + 1;
+		}
+
+		void				pop_back()
+		{
+			writable();
+			if (size() > 0)
+				--_header->size;
+		}
+
+		iterator			insert(iterator position, const value_type &val)
+		{
+			size_type	pos = position - begin();
+
+			open_gap(pos, 1, val);
+			return (_begin + pos);
+		}
+
+		void				insert(iterator position, size_type n, const value_type &val)
+		{
+			open_gap(position - begin(), n, val);
+		}
+
+		template <class InputIterator>
+		void				insert(iterator position, InputIterator first, InputIterator last)
+		{
+			insert_range(position, first, last);
+		}
+
+		iterator			erase(iterator position)
+		{
+			return (erase(position, position + 1));
+		}
+
+		iterator			erase(iterator first, iterator last)
+		{
+			size_type	lo = first - begin();
+			size_type	hi = last - begin();
+			size_type	n = size();
+
+			writable();
+			std::memmove(static_cast<void *>(_begin + lo), _begin + hi, (n - hi) * sizeof(T));
+			_header->size = n - (hi - lo);
+			return (_begin + lo);
+		}
+
+		void				clear()
+		{
+			writable();
+			_header->size = 0;
+		}
+
+		void				swap(MmapVector &x)
+		{
+			ft::swap(_fd, x._fd);
+			ft::swap(_read_only, x._read_only);
+			ft::swap(_header, x._header);
+			ft::swap(_begin, x._begin);
+			ft::swap(_capacity, x._capacity);
+		}
+
+		friend bool operator==(const MmapVector &lhs, const MmapVector &rhs)
+		{
+			if (lhs.size() == rhs.size())
+				return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+			else
+				return (false);
+		}
+
+		friend bool operator!=(const MmapVector &lhs, const MmapVector &rhs)
+		{ return (!(lhs == rhs)); }
+
+		friend bool operator<(const MmapVector &lhs, const MmapVector &rhs)
+		{ return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end())); }
+
+		friend bool operator<=(const MmapVector &lhs, const MmapVector &rhs)
+		{ return (!(rhs < lhs)); }
+
+		friend bool operator>(const MmapVector &lhs, const MmapVector &rhs)
+		{ return (rhs < lhs); }
+
+		friend bool operator>=(const MmapVector &lhs, const MmapVector &rhs)
+		{ return (!(lhs < rhs)); }
+
+	private:
+		// 파일과 매핑은 하나뿐이므로 복사하지 않는다
+		MmapVector(const MmapVector &);
+		MmapVector			&operator=(const MmapVector &);
+
+		static size_t		map_bytes(size_type capacity)
+		{ return (HEADER_BYTES + capacity * sizeof(T)); }
+
+		// 두 배씩 늘리되 처음에는 한 페이지를 채운다
+		size_type			grow_to(size_type n) const
+		{
+			size_type	cap = _capacity ? _capacity * 2 : (4096 - HEADER_BYTES) / sizeof(T);
+
+			return (cap > n ? cap : n);
+		}
+
+		void				fail(const std::string &what) const
+		{
+			throw (mmap_error(what + ": " + std::strerror(errno)));
+		}
+
+		void				writable() const
+		{
+			if (!_header)
+				throw (mmap_error("not open"));
+			if (_read_only)
+				throw (mmap_error("read-only"));
+		}
+
+		void				map(size_t bytes)
+		{
+			void	*p = mmap(0, bytes, _read_only ? PROT_READ : PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+
+			if (p == MAP_FAILED)
+				fail("mmap");
+			set_mapping(p, bytes);
+		}
+
+		void				set_mapping(void *p, size_t bytes)
+		{
+			_header = static_cast<Header *>(p);
+			_begin = reinterpret_cast<pointer>(static_cast<char *>(p) + HEADER_BYTES);
+			_capacity = (bytes - HEADER_BYTES) / sizeof(T);
+		}
+
+		// 파일 크기를 바꾸고 매핑을 그 크기로 옮긴다
+		void				remap(size_type capacity)
+		{
+			size_t	old_bytes = map_bytes(_capacity);
+			size_t	new_bytes = map_bytes(capacity);
+			bool	shrink = capacity < _capacity;
+			void	*p;
+
+			if (!shrink && ftruncate(_fd, new_bytes) < 0)
+				fail("ftruncate");
+# ifdef MREMAP_MAYMOVE
+			p = mremap(_header, old_bytes, new_bytes, MREMAP_MAYMOVE);
+			if (p == MAP_FAILED)
+				fail("mremap");
+# else
+			p = mmap(0, new_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+			if (p == MAP_FAILED)
+				fail("mmap");
+			munmap(_header, old_bytes);
+# endif
+			set_mapping(p, new_bytes);
+			_header->capacity = capacity;
+			// 줄일 때는 매핑을 먼저 줄여야 잘린 페이지에 닿지 않는다
+			if (shrink && ftruncate(_fd, new_bytes) < 0)
+				fail("ftruncate");
+		}
+
+		// [pos, pos + n)을 비우고 val로 채운다. val이 벡터 안의 원소여도 된다
+		void				open_gap(size_type pos, size_type n, const value_type &val)
+		{
+			value_type	copy = val;
+			size_type	old = size();
+
+			writable();
+			if (old + n > _capacity)
+				remap(grow_to(old + n));
+			std::memmove(static_cast<void *>(_begin + pos + n), _begin + pos, (old - pos) * sizeof(T));
+			for (size_type i = 0; i < n; ++i)
+				_begin[pos + i] = copy;
+			_header->size = old + n;
+		}
+
+		// MmapVector<int>(...).insert(pos, 10, 30)이 이터레이터 구간으로 들어오지 않게 한다
+		void				insert_range(iterator position, int n, int val)
+		{
+			open_gap(position - begin(), n, static_cast<value_type>(val));
+		}
+
+		template <typename InputIterator>
+		void				insert_range(iterator position, InputIterator first, InputIterator last)
+		{
+			size_type	pos = position - begin();
+
+			for (; first != last; ++first, ++pos)
+				open_gap(pos, 1, *first);
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,340 @@
+#ifndef MPMC_QUEUE_HPP
+# define MPMC_QUEUE_HPP
+
+# include <memory>
+# include <cstddef>
+# include <pthread.h>
+# include <sched.h>
+# include <time.h>
+# include <errno.h>
+
+namespace ft
+{
+	// 생산자 여럿, 소비자 여럿이 쓰는 lock-free 고정 크기 큐 (Dmitry Vyukov의 bounded MPMC queue)
+	// 칸마다 순번(_seq)이 있어서 생산자/소비자는 자기 위치를 CAS로 잡은 뒤 그 칸만 건드린다.
+	//   _seq[i] == pos       : 비어 있음, pos 번째 push가 쓸 수 있다
+	//   _seq[i] == pos + 1   : 차 있음, pos 번째 pop이 꺼낼 수 있다
+	// 꺼낸 뒤에는 pos + capacity로 바꿔서 한 바퀴 뒤의 push에게 넘긴다.
+	// try_ 계열은 기다리지 않고, push/pop은 기다리고, _for 계열은 주어진 시간(마이크로초)까지만 기다린다.
+	// parking이 켜져 있으면 잠깐 돌아본 뒤 condition variable에서 잠들고, 꺼져 있으면 sched_yield로 양보하며 돈다.
+	template <class T, class Alloc = std::allocator<T> >
+	class MpmcQueue
+	{
+	public:
+		typedef T								value_type;
+		typedef Alloc							allocator_type;
+		typedef size_t							size_type;
+
+		enum { CACHE_LINE = 64, SPIN_COUNT = 64 };
+
+	private:
+		typedef typename allocator_type::template
+				rebind<size_type>::other		seq_allocator;
+
+		size_type		_enqueue_pos;
+		char			_pad0[CACHE_LINE - sizeof(size_type)];
+		size_type		_dequeue_pos;
+		char			_pad1[CACHE_LINE - sizeof(size_type)];
+		// 잠든 스레드 수, 0이면 깨우는 쪽이 mutex를 잡지 않는다
+		int				_push_waiters;
+		int				_pop_waiters;
+		char			_pad2[CACHE_LINE - 2 * sizeof(int)];
+		allocator_type	_allocator;
+		seq_allocator	_seq_allocator;
+		T*				_buffer;
+		size_type*		_seq;
+		size_type		_capacity;
+		size_type		_mask;
+		bool			_parking;
+		pthread_mutex_t	_lock;
+		pthread_cond_t	_not_full;
+		pthread_cond_t	_not_empty;
+
+	public:
+		// 용량은 2의 거듭제곱으로 올림 (최소 2)
+		explicit MpmcQueue(size_type capacity, bool parking = true, const allocator_type &alloc = allocator_type())
+			: _enqueue_pos(0), _dequeue_pos(0), _push_waiters(0), _pop_waiters(0),
+			_allocator(alloc), _seq_allocator(alloc), _parking(parking)
+		{
+			_capacity = 2;
+			while (_capacity < capacity)
+				_capacity <<= 1;
+			_mask = _capacity - 1;
+			_buffer = _allocator.allocate(_capacity);
+			_seq = _seq_allocator.allocate(_capacity);
+			for (size_type i = 0; i < _capacity; ++i)
+				_seq[i] = i;
+			pthread_mutex_init(&_lock, 0);
+			pthread_cond_init(&_not_full, 0);
+			pthread_cond_init(&_not_empty, 0);
+		}
+
+		// 다른 스레드가 쓰고 있지 않을 때만 부를 것
+		~MpmcQueue()
+		{
+			for (size_type pos = _dequeue_pos; pos != _enqueue_pos; ++pos)
+				_allocator.destroy(_buffer + (pos & _mask));
+			_allocator.deallocate(_buffer, _capacity);
+			_seq_allocator.deallocate(_seq, _capacity);
+			pthread_mutex_destroy(&_lock);
+			pthread_cond_destroy(&_not_full);
+			pthread_cond_destroy(&_not_empty);
+		}
+
+		size_type		capacity() const
+		{
+			return (_capacity);
+		}
+
+		// 다른 스레드가 동시에 바꾸고 있으면 근삿값
+		size_type		size() const
+		{
+			size_type	enq;
+			size_type	deq;
+
+			deq = __atomic_load_n(&_dequeue_pos, __ATOMIC_ACQUIRE);
+			enq = __atomic_load_n(&_enqueue_pos, __ATOMIC_ACQUIRE);
+			if (enq < deq)
+				return (0);
+			return (enq - deq > _capacity ? _capacity : enq - deq);
+		}
+
+		bool			empty() const
+		{
+			return (size() == 0);
+		}
+
+		// 가득 차 있으면 false
+		bool			try_push(const value_type &val)
+		{
+			if (!enqueue(val))
+				return (false);
+			wake(_pop_waiters, _not_empty);
+			return (true);
+		}
+
+		// 비어 있으면 false
+		bool			try_pop(value_type &out)
+		{
+			if (!dequeue(out))
+				return (false);
+			wake(_push_waiters, _not_full);
+			return (true);
+		}
+
+		// 자리가 날 때까지 기다린다
+		void			push(const value_type &val)
+		{
+			push_until(val, 0);
+		}
+
+		// 원소가 들어올 때까지 기다린다
+		void			pop(value_type &out)
+		{
+			pop_until(out, 0);
+		}
+
+		// timeout_us 마이크로초 안에 넣지 못하면 false
+		bool			try_push_for(const value_type &val, long timeout_us)
+		{
+			struct timespec		deadline;
+
+			make_deadline(deadline, timeout_us);
+			return (push_until(val, &deadline));
+		}
+
+		// timeout_us 마이크로초 안에 꺼내지 못하면 false
+		bool			try_pop_for(value_type &out, long timeout_us)
+		{
+			struct timespec		deadline;
+
+			make_deadline(deadline, timeout_us);
+			return (pop_until(out, &deadline));
+		}
+
+	private:
+		bool			enqueue(const value_type &val)
+		{
+			size_type		pos;
+			size_type		seq;
+			long			diff;
+
+			pos = __atomic_load_n(&_enqueue_pos, __ATOMIC_RELAXED);
+			while (true)
+			{
+				seq = __atomic_load_n(_seq + (pos & _mask), __ATOMIC_ACQUIRE);
+				diff = static_cast<long>(seq) - static_cast<long>(pos);
+				if (diff == 0)
+				{
+					if (__atomic_compare_exchange_n(&_enqueue_pos, &pos, pos + 1, true,
+							__ATOMIC_RELAXED, __ATOMIC_RELAXED))
+						break ;
+				}
+				else if (diff < 0)
+					return (false);
+				else
+					pos = __atomic_load_n(&_enqueue_pos, __ATOMIC_RELAXED);
+			}
+			_allocator.construct(_buffer + (pos & _mask), val);
+			__atomic_store_n(_seq + (pos & _mask), pos + 1, __ATOMIC_RELEASE);
+			return (true);
+		}
+
+		bool			dequeue(value_type &out)
+		{
+			size_type		pos;
+			size_type		seq;
+			long			diff;
+
+			pos = __atomic_load_n(&_dequeue_pos, __ATOMIC_RELAXED);
+			while (true)
+			{
+				seq = __atomic_load_n(_seq + (pos & _mask), __ATOMIC_ACQUIRE);
+				diff = static_cast<long>(seq) - static_cast<long>(pos + 1);
+				if (diff == 0)
+				{
+					if (__atomic_compare_exchange_n(&_dequeue_pos, &pos, pos + 1, true,
+							__ATOMIC_RELAXED, __ATOMIC_RELAXED))
+						break ;
+				}
+				else if (diff < 0)
+					return (false);
+				else
+					pos = __atomic_load_n(&_dequeue_pos, __ATOMIC_RELAXED);
+			}
+			out = _buffer[pos & _mask];
+			_allocator.destroy(_buffer + (pos & _mask));
+			__atomic_store_n(_seq + (pos & _mask), pos + _mask + 1, __ATOMIC_RELEASE);
+			return (true);
+		}
+
+		// 잠든 쪽이 있을 때만 mutex를 잡는다
+		// 잠드는 쪽은 _waiters를 올린 뒤 다시 확인하고, 깨우는 쪽은 칸을 발행한 뒤 _waiters를 보므로
+		// 둘 다 seq_cst면 적어도 한쪽은 상대를 본다.
+		void			wake(int &waiters, pthread_cond_t &cond)
+		{
+			__atomic_thread_fence(__ATOMIC_SEQ_CST);
+			if (__atomic_load_n(&waiters, __ATOMIC_RELAXED) == 0)
+				return ;
+			pthread_mutex_lock(&_lock);
+			pthread_cond_signal(&cond);
+			pthread_mutex_unlock(&_lock);
+		}
+
+		bool			push_until(const value_type &val, const struct timespec *deadline)
+		{
+			for (int i = 0; i < SPIN_COUNT; ++i)
+			{
+				if (try_push(val))
+					return (true);
+			}
+			while (true)
+			{
+				if (!_parking)
+				{
+					if (try_push(val))
+						return (true);
+					if (expired(deadline))
+						return (false);
+					sched_yield();
+					continue ;
+				}
+				pthread_mutex_lock(&_lock);
+				__atomic_fetch_add(&_push_waiters, 1, __ATOMIC_SEQ_CST);
+				if (enqueue(val))
+				{
+					__atomic_fetch_sub(&_push_waiters, 1, __ATOMIC_SEQ_CST);
+					pthread_mutex_unlock(&_lock);
+					wake(_pop_waiters, _not_empty);
+					return (true);
+				}
+				if (!wait(_not_full, deadline))
+				{
+					__atomic_fetch_sub(&_push_waiters, 1, __ATOMIC_SEQ_CST);
+					pthread_mutex_unlock(&_lock);
+					return (try_push(val));
+				}
+				__atomic_fetch_sub(&_push_waiters, 1, __ATOMIC_SEQ_CST);
+				pthread_mutex_unlock(&_lock);
+			}
+		}
+
+		bool			pop_until(value_type &out, const struct timespec *deadline)
+		{
+			for (int i = 0; i < SPIN_COUNT; ++i)
+			{
+				if (try_pop(out))
+					return (true);
+			}
+			while (true)
+			{
+				if (!_parking)
+				{
+					if (try_pop(out))
+						return (true);
+					if (expired(deadline))
+						return (false);
+					sched_yield();
+					continue ;
+				}
+				pthread_mutex_lock(&_lock);
+				__atomic_fetch_add(&_pop_waiters, 1, __ATOMIC_SEQ_CST);
+				if (dequeue(out))
+				{
+					__atomic_fetch_sub(&_pop_waiters, 1, __ATOMIC_SEQ_CST);
+					pthread_mutex_unlock(&_lock);
+					wake(_push_waiters, _not_full);
+					return (true);
+				}
+				if (!wait(_not_empty, deadline))
+				{
+					__atomic_fetch_sub(&_pop_waiters, 1, __ATOMIC_SEQ_CST);
+					pthread_mutex_unlock(&_lock);
+					return (try_pop(out));
+				}
+				__atomic_fetch_sub(&_pop_waiters, 1, __ATOMIC_SEQ_CST);
+				pthread_mutex_unlock(&_lock);
+			}
+		}
+
+		// _lock을 잡은 상태에서 호출, 시간이 다 되면 false
+		bool			wait(pthread_cond_t &cond, const struct timespec *deadline)
+		{
+			if (deadline == 0)
+			{
+				pthread_cond_wait(&cond, &_lock);
+				return (true);
+			}
+			return (pthread_cond_timedwait(&cond, &_lock, deadline) != ETIMEDOUT);
+		}
+
+		static void		make_deadline(struct timespec &deadline, long timeout_us)
+		{
+			clock_gettime(CLOCK_REALTIME, &deadline);
+			deadline.tv_sec += timeout_us / 1000000;
+			deadline.tv_nsec += (timeout_us % 1000000) * 1000;
+			if (deadline.tv_nsec >= 1000000000)
+			{
+				deadline.tv_sec += 1;
+				deadline.tv_nsec -= 1000000000;
+			}
+		}
+
+		static bool		expired(const struct timespec *deadline)
+		{
+			struct timespec		now;
+
+			if (deadline == 0)
+				return (false);
+			clock_gettime(CLOCK_REALTIME, &now);
+			if (now.tv_sec != deadline->tv_sec)
+				return (now.tv_sec > deadline->tv_sec);
+			return (now.tv_nsec >= deadline->tv_nsec);
+		}
+
+		MpmcQueue(const MpmcQueue &);
+		MpmcQueue	&operator=(const MpmcQueue &);
+	};
+}
+
+#endif
@@ -0,0 +1,738 @@
+#ifndef ORDER_STAT_MAP_HPP
+# define ORDER_STAT_MAP_HPP
+
+# include <memory>
+# include "MapNode.hpp"
+# include "MapIterator.hpp"
+# include "ReverseMapIterator.hpp"
+# include "utils.hpp"
+
+namespace ft
+{
+	// 집계 정책(monoid)
+	// result_type, identity(), lift(value), combine(a, b) 를 제공해야 하고 combine은 결합법칙을 만족해야 한다.
+
+	// 집계를 하지 않는 기본 정책
+	template <typename Value>
+	class NoAggregate
+	{
+	public:
+		class result_type {};
+
+		result_type		identity() const
+		{ return (result_type()); }
+
+		result_type		lift(const Value &) const
+		{ return (result_type()); }
+
+		result_type		combine(const result_type &, const result_type &) const
+		{ return (result_type()); }
+	};
+
+	// mapped 값의 합
+	template <typename Value>
+	class SumAggregate
+	{
+	public:
+		typedef typename Value::second_type		result_type;
+
+		result_type		identity() const
+		{ return (result_type()); }
+
+		result_type		lift(const Value &val) const
+		{ return (val.second); }
+
+		result_type		combine(const result_type &a, const result_type &b) const
+		{ return (a + b); }
+	};
+
+	// MapNode에 서브트리 크기와 집계값을 붙인 노드
+	// 링크는 MapNode<T>* 그대로라서 MapIterator로 순회할 수 있다.
+	template <typename T, typename A>
+	class OrderStatNode : public MapNode<T>
+	{
+	public:
+		size_t		_size;
+		A			_agg;
+
+		OrderStatNode(const T &data, const A &agg) : MapNode<T>(data), _size(1), _agg(agg)
+		{
+		}
+
+		OrderStatNode(const OrderStatNode &copy) : MapNode<T>(copy), _size(copy._size), _agg(copy._agg)
+		{
+		}
+
+		~OrderStatNode()
+		{
+		}
+	};
+
+	// 순위 통계 Map
+	// 서브트리 크기로 균형을 잡는 weight-balanced tree (delta = 3, ratio = 2)
+	// rank, select, count_range, aggregate_range, distance가 모두 O(log n)이다.
+	// 삭제는 노드를 다시 연결하므로 지워지지 않은 원소의 이터레이터는 계속 유효하다.
+	template < class Key, class T, class Compare = ft::less<Key>,
+				class Aggregate = ft::NoAggregate<ft::Pair<Key, T> >,
+				class Alloc = std::allocator<ft::Pair<Key, T> > >
+	class OrderStatMap
+	{
+	public:
+		typedef Key											key_type;
+		typedef T											mapped_type;
+		typedef ft::Pair<key_type, mapped_type>				value_type;
+		typedef Compare										key_compare;
+		typedef Aggregate									aggregate_type;
+		typedef typename Aggregate::result_type				aggregate_result;
+		typedef Alloc										allocator_type;
+		typedef typename allocator_type::reference			reference;
+		typedef typename allocator_type::const_reference	const_reference;
+		typedef typename allocator_type::pointer			pointer;
+		typedef typename allocator_type::const_pointer		const_pointer;
+		typedef MapIterator<value_type>						iterator;
+		typedef const MapIterator<value_type>				const_iterator;
+		typedef ReverseMapIterator<value_type>				reverse_iterator;
+		typedef const ReverseMapIterator<value_type>		const_reverse_iterator;
+		typedef ptrdiff_t									difference_type;
+		typedef size_t										size_type;
+
+	private:
+		typedef OrderStatNode<value_type, aggregate_result>	node_type;
+		typedef typename allocator_type::template
+				rebind<node_type>::other					node_allocator;
+
+		enum { DELTA = 3, RATIO = 2 };
+
+		allocator_type		_allocator;
+		node_allocator		_node_allocator;
+		key_compare			_key_comp;
+		aggregate_type		_aggregate;
+		node_type*			_root;
+
+	public:
+		explicit OrderStatMap(const key_compare &comp = key_compare(), const aggregate_type &agg = aggregate_type(),
+							const allocator_type &alloc = allocator_type())
+			: _allocator(alloc), _node_allocator(alloc), _key_comp(comp), _aggregate(agg), _root(0)
+		{
+		}
+
+		template <class InputIterator>
+		OrderStatMap(InputIterator first, InputIterator last, const key_compare &comp = key_compare(),
+					const aggregate_type &agg = aggregate_type(), const allocator_type &alloc = allocator_type())
+			: _allocator(alloc), _node_allocator(alloc), _key_comp(comp), _aggregate(agg), _root(0)
+		{
+			insert(first, last);
+		}
+
+		// 구조를 그대로 복제하므로 O(n)
+		OrderStatMap(const OrderStatMap &copy)
+			: _allocator(copy._allocator), _node_allocator(copy._node_allocator),
+			_key_comp(copy._key_comp), _aggregate(copy._aggregate), _root(0)
+		{
+			_root = clone(copy._root, 0);
+		}
+
+		~OrderStatMap()
+		{
+			clear();
+		}
+
+		OrderStatMap	&operator=(const OrderStatMap &ref)
+		{
+			if (this == &ref)
+				return (*this);
+			clear();
+			_key_comp = ref._key_comp;
+			_aggregate = ref._aggregate;
+			_root = clone(ref._root, 0);
+			return (*this);
+		}
+
+		iterator				begin()
+		{ return (leftmost(_root)); }
+
+		const_iterator			begin() const
+		{ return (leftmost(_root)); }
+
+		iterator				end()
+		{ return (0); }
+
+		const_iterator			end() const
+		{ return (0); }
+
+		reverse_iterator		rbegin()
+		{ return (rightmost(_root)); }
+
+		const_reverse_iterator	rbegin() const
+		{ return (rightmost(_root)); }
+
+		reverse_iterator		rend()
+		{ return (0); }
+
+		const_reverse_iterator	rend() const
+		{ return (0); }
+
+		bool		empty() const
+		{ return (_root == 0); }
+
+		size_type	size() const
+		{ return (node_size(_root)); }
+
+		size_type	max_size() const
+		{ return (_node_allocator.max_size()); }
+
+		// 반환된 레퍼런스로 값을 바꾸면 집계값이 갱신되지 않는다. assign()이나 refresh()를 쓸 것
+		mapped_type		&operator[](const key_type &k)
+		{
+			return ((insert(value_type(k, mapped_type())).first)->second);
+		}
+
+		// 키가 있으면 값을 덮어쓰고 없으면 삽입한다. 집계값도 함께 갱신
+		iterator	assign(const key_type &k, const mapped_type &val)
+		{
+			ft::Pair<iterator, bool>	ret;
+
+			ret = insert(value_type(k, val));
+			if (!ret.second)
+			{
+				ret.first->second = val;
+				refresh(ret.first);
+			}
+			return (ret.first);
+		}
+
+		// 이터레이터로 mapped 값을 바꾼 뒤 루트까지 집계값을 다시 계산한다. O(log n)
+		void		refresh(iterator position)
+		{
+			node_type	*node;
+
+			node = static_cast<node_type *>(position._element);
+			while (node)
+			{
+				update(node);
+				node = parent(node);
+			}
+		}
+
+		ft::Pair<iterator, bool>	insert(const value_type &val)
+		{
+			node_type	*result;
+			bool		inserted;
+
+			result = 0;
+			inserted = false;
+			_root = insert_node(_root, val, result, inserted);
+			_root->_parent = 0;
+			return (ft::Pair<iterator, bool>(result, inserted));
+		}
+
+		iterator	insert(iterator position, const value_type &val)
+		{
+			(void)position;
+			return (insert(val).first);
+		}
+
+		template <class InputIterator>
+		void		insert(InputIterator first, InputIterator last)
+		{
+			while (first != last)
+			{
+				insert(*first);
+				++first;
+			}
+		}
+
+		void		erase(iterator position)
+		{
+			erase(position->first);
+		}
+
+		size_type	erase(const key_type &k)
+		{
+			node_type	*removed;
+
+			removed = 0;
+			_root = erase_node(_root, k, removed);
+			if (_root)
+				_root->_parent = 0;
+			if (removed == 0)
+				return (0);
+			destroy_node(removed);
+			return (1);
+		}
+
+		void		erase(iterator first, iterator last)
+		{
+			while (first != last)
+				erase(first++);
+		}
+
+		void		swap(OrderStatMap &x)
+		{
+			ft::swap(_allocator, x._allocator);
+			ft::swap(_node_allocator, x._node_allocator);
+			ft::swap(_key_comp, x._key_comp);
+			ft::swap(_aggregate, x._aggregate);
+			ft::swap(_root, x._root);
+		}
+
+		void		clear()
+		{
+			destroy_tree(_root);
+			_root = 0;
+		}
+
+		key_compare		key_comp() const
+		{ return (_key_comp); }
+
+		aggregate_type	aggregate_policy() const
+		{ return (_aggregate); }
+
+		iterator		find(const key_type &k)
+		{ return (find_node(k)); }
+
+		const_iterator	find(const key_type &k) const
+		{ return (find_node(k)); }
+
+		size_type		count(const key_type &k) const
+		{ return (find_node(k) ? 1 : 0); }
+
+		iterator		lower_bound(const key_type &k)
+		{ return (lower_node(k)); }
+
+		const_iterator	lower_bound(const key_type &k) const
+		{ return (lower_node(k)); }
+
+		iterator		upper_bound(const key_type &k)
+		{ return (upper_node(k)); }
+
+		const_iterator	upper_bound(const key_type &k) const
+		{ return (upper_node(k)); }
+
+		ft::Pair<iterator, iterator>	equal_range(const key_type &k)
+		{ return (ft::Pair<iterator, iterator>(lower_bound(k), upper_bound(k))); }
+
+		ft::Pair<const_iterator, const_iterator>	equal_range(const key_type &k) const
+		{ return (ft::Pair<const_iterator, const_iterator>(lower_bound(k), upper_bound(k))); }
+
+		allocator_type	get_allocator() const
+		{ return (_allocator); }
+
+		// k보다 작은 키의 개수
+		size_type		rank(const key_type &k) const
+		{
+			node_type	*node;
+			size_type	ret;
+
+			ret = 0;
+			node = _root;
+			while (node)
+			{
+				if (_key_comp(node->_data.first, k))
+				{
+					ret += node_size(left(node)) + 1;
+					node = right(node);
+				}
+				else
+					node = left(node);
+			}
+			return (ret);
+		}
+
+		// i번째(0부터) 원소, 범위를 벗어나면 end()
+		iterator		select(size_type i)
+		{ return (select_node(i)); }
+
+		const_iterator	select(size_type i) const
+		{ return (select_node(i)); }
+
+		// 이터레이터의 순서 위치, end()는 size()
+		size_type		index_of(const_iterator position) const
+		{
+			node_type	*node;
+			size_type	ret;
+
+			if (position._element == 0)
+				return (size());
+			node = static_cast<node_type *>(position._element);
+			ret = node_size(left(node));
+			while (node->_parent)
+			{
+				if (node->_parent->_right == node)
+					ret += node_size(left(parent(node))) + 1;
+				node = parent(node);
+			}
+			return (ret);
+		}
+
+		difference_type	distance(const_iterator first, const_iterator last) const
+		{
+			return (static_cast<difference_type>(index_of(last)) - static_cast<difference_type>(index_of(first)));
+		}
+
+		// [lo, hi) 범위의 키 개수
+		size_type		count_range(const key_type &lo, const key_type &hi) const
+		{
+			if (!_key_comp(lo, hi))
+				return (0);
+			return (rank(hi) - rank(lo));
+		}
+
+		// 전체 집계값
+		aggregate_result	aggregate() const
+		{ return (node_agg(_root)); }
+
+		// [lo, hi) 범위의 집계값
+		aggregate_result	aggregate_range(const key_type &lo, const key_type &hi) const
+		{
+			if (!_key_comp(lo, hi))
+				return (_aggregate.identity());
+			return (agg_between(_root, lo, hi));
+		}
+
+	private:
+		static node_type	*left(const MapNode<value_type> *node)
+		{ return (static_cast<node_type *>(node->_left)); }
+
+		static node_type	*right(const MapNode<value_type> *node)
+		{ return (static_cast<node_type *>(node->_right)); }
+
+		static node_type	*parent(const MapNode<value_type> *node)
+		{ return (static_cast<node_type *>(node->_parent)); }
+
+		static size_type	node_size(const node_type *node)
+		{ return (node ? node->_size : 0); }
+
+		aggregate_result	node_agg(const node_type *node) const
+		{ return (node ? node->_agg : _aggregate.identity()); }
+
+		static void			set_left(node_type *node, node_type *child)
+		{
+			node->_left = child;
+			if (child)
+				child->_parent = node;
+		}
+
+		static void			set_right(node_type *node, node_type *child)
+		{
+			node->_right = child;
+			if (child)
+				child->_parent = node;
+		}
+
+		static node_type	*leftmost(node_type *node)
+		{
+			if (node == 0)
+				return (0);
+			while (node->_left)
+				node = left(node);
+			return (node);
+		}
+
+		static node_type	*rightmost(node_type *node)
+		{
+			if (node == 0)
+				return (0);
+			while (node->_right)
+				node = right(node);
+			return (node);
+		}
+
+		void		update(node_type *node)
+		{
+			node->_size = node_size(left(node)) + node_size(right(node)) + 1;
+			node->_agg = _aggregate.combine(_aggregate.combine(node_agg(left(node)), _aggregate.lift(node->_data)),
+											node_agg(right(node)));
+		}
+
+		node_type	*rotate_left(node_type *node)
+		{
+			node_type	*r;
+
+			r = right(node);
+			set_right(node, left(r));
+			set_left(r, node);
+			update(node);
+			update(r);
+			return (r);
+		}
+
+		node_type	*rotate_right(node_type *node)
+		{
+			node_type	*l;
+
+			l = left(node);
+			set_left(node, right(l));
+			set_right(l, node);
+			update(node);
+			update(l);
+			return (l);
+		}
+
+		// 한쪽 서브트리가 원소 하나만큼 바뀐 뒤 호출, 새 서브트리 루트를 반환
+		node_type	*balance(node_type *node)
+		{
+			size_type	wl;
+			size_type	wr;
+
+			wl = node_size(left(node)) + 1;
+			wr = node_size(right(node)) + 1;
+			if (wr > DELTA * wl)
+			{
+				if (node_size(left(right(node))) + 1 >= RATIO * (node_size(right(right(node))) + 1))
+					set_right(node, rotate_right(right(node)));
+				return (rotate_left(node));
+			}
+			else if (wl > DELTA * wr)
+			{
+				if (node_size(right(left(node))) + 1 >= RATIO * (node_size(left(left(node))) + 1))
+					set_left(node, rotate_left(left(node)));
+				return (rotate_right(node));
+			}
+			update(node);
+			return (node);
+		}
+
+		node_type	*create_node(const value_type &val)
+		{
+			node_type	*node;
+
+			node = _node_allocator.allocate(1);
+			_node_allocator.construct(node, node_type(val, _aggregate.lift(val)));
+			return (node);
+		}
+
+		void		destroy_node(node_type *node)
+		{
+			_node_allocator.destroy(node);
+			_node_allocator.deallocate(node, 1);
+		}
+
+		void		destroy_tree(node_type *node)
+		{
+			if (node == 0)
+				return ;
+			destroy_tree(left(node));
+			destroy_tree(right(node));
+			destroy_node(node);
+		}
+
+		node_type	*clone(const node_type *node, node_type *parent_node)
+		{
+			node_type	*ret;
+
+			if (node == 0)
+				return (0);
+			ret = _node_allocator.allocate(1);
+			_node_allocator.construct(ret, *node);
+			ret->_parent = parent_node;
+			ret->_left = clone(left(node), ret);
+			ret->_right = clone(right(node), ret);
+			return (ret);
+		}
+
+		node_type	*insert_node(node_type *node, const value_type &val, node_type *&result, bool &inserted)
+		{
+			if (node == 0)
+			{
+				result = create_node(val);
+				inserted = true;
+				return (result);
+			}
+			if (_key_comp(val.first, node->_data.first))
+				set_left(node, insert_node(left(node), val, result, inserted));
+			else if (_key_comp(node->_data.first, val.first))
+				set_right(node, insert_node(right(node), val, result, inserted));
+			else
+			{
+				result = node;
+				return (node);
+			}
+			if (!inserted)
+				return (node);
+			return (balance(node));
+		}
+
+		// 서브트리의 최솟값 노드를 떼어내고 남은 서브트리의 루트를 반환
+		node_type	*erase_min(node_type *node, node_type *&min)
+		{
+			if (node->_left == 0)
+			{
+				min = node;
+				return (right(node));
+			}
+			set_left(node, erase_min(left(node), min));
+			return (balance(node));
+		}
+
+		// node를 빼고 그 자리에 후속 노드를 연결한다 (값 복사 없음)
+		node_type	*remove_node(node_type *node)
+		{
+			node_type	*min;
+			node_type	*rest;
+
+			if (node->_left == 0)
+				return (right(node));
+			if (node->_right == 0)
+				return (left(node));
+			min = 0;
+			rest = erase_min(right(node), min);
+			set_left(min, left(node));
+			set_right(min, rest);
+			return (balance(min));
+		}
+
+		node_type	*erase_node(node_type *node, const key_type &k, node_type *&removed)
+		{
+			if (node == 0)
+				return (0);
+			if (_key_comp(k, node->_data.first))
+				set_left(node, erase_node(left(node), k, removed));
+			else if (_key_comp(node->_data.first, k))
+				set_right(node, erase_node(right(node), k, removed));
+			else
+			{
+				removed = node;
+				return (remove_node(node));
+			}
+			if (removed == 0)
+				return (node);
+			return (balance(node));
+		}
+
+		node_type	*find_node(const key_type &k) const
+		{
+			node_type	*node;
+
+			node = _root;
+			while (node)
+			{
+				if (_key_comp(k, node->_data.first))
+					node = left(node);
+				else if (_key_comp(node->_data.first, k))
+					node = right(node);
+				else
+					return (node);
+			}
+			return (0);
+		}
+
+		node_type	*lower_node(const key_type &k) const
+		{
+			node_type	*node;
+			node_type	*ret;
+
+			ret = 0;
+			node = _root;
+			while (node)
+			{
+				if (!_key_comp(node->_data.first, k))
+				{
+					ret = node;
+					node = left(node);
+				}
+				else
+					node = right(node);
+			}
+			return (ret);
+		}
+
+		node_type	*upper_node(const key_type &k) const
+		{
+			node_type	*node;
+			node_type	*ret;
+
+			ret = 0;
+			node = _root;
+			while (node)
+			{
+				if (_key_comp(k, node->_data.first))
+				{
+					ret = node;
+					node = left(node);
+				}
+				else
+					node = right(node);
+			}
+			return (ret);
+		}
+
+		node_type	*select_node(size_type i) const
+		{
+			node_type	*node;
+			size_type	l;
+
+			node = _root;
+			while (node)
+			{
+				l = node_size(left(node));
+				if (i < l)
+					node = left(node);
+				else if (i == l)
+					return (node);
+				else
+				{
+					i -= l + 1;
+					node = right(node);
+				}
+			}
+			return (0);
+		}
+
+		// lo 이상인 키들의 집계
+		aggregate_result	agg_from(const node_type *node, const key_type &lo) const
+		{
+			aggregate_result	ret;
+
+			ret = _aggregate.identity();
+			while (node)
+			{
+				if (_key_comp(node->_data.first, lo))
+					node = right(node);
+				else
+				{
+					ret = _aggregate.combine(_aggregate.combine(_aggregate.lift(node->_data), node_agg(right(node))), ret);
+					node = left(node);
+				}
+			}
+			return (ret);
+		}
+
+		// hi 미만인 키들의 집계
+		aggregate_result	agg_until(const node_type *node, const key_type &hi) const
+		{
+			aggregate_result	ret;
+
+			ret = _aggregate.identity();
+			while (node)
+			{
+				if (!_key_comp(node->_data.first, hi))
+					node = left(node);
+				else
+				{
+					ret = _aggregate.combine(ret, _aggregate.combine(node_agg(left(node)), _aggregate.lift(node->_data)));
+					node = right(node);
+				}
+			}
+			return (ret);
+		}
+
+		// 두 경계의 경로가 갈라지는 노드를 찾은 뒤 양쪽을 따로 모은다
+		aggregate_result	agg_between(const node_type *node, const key_type &lo, const key_type &hi) const
+		{
+			while (node)
+			{
+				if (_key_comp(node->_data.first, lo))
+					node = right(node);
+				else if (!_key_comp(node->_data.first, hi))
+					node = left(node);
+				else
+					return (_aggregate.combine(_aggregate.combine(agg_from(left(node), lo), _aggregate.lift(node->_data)),
+												agg_until(right(node), hi)));
+			}
+			return (_aggregate.identity());
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,367 @@
+#ifndef PARALLEL_HPP
+# define PARALLEL_HPP
+
+# include <cstddef>
+# include "ThreadPool.hpp"
+# include "Algorithm.hpp"
+# include "Vector.hpp"
+
+namespace ft
+{
+	// ft::Vector(VectorIterator)와 포인터 구간에 대한 병렬 알고리즘
+	// 구간을 grain 크기 덩어리로 나눠 ThreadPool에서 돌리고, threshold보다 짧으면 부른 스레드에서 바로 돈다.
+	// reduce와 scan은 덩어리 경계가 grain으로만 정해지고 덩어리 결과를 항상 왼쪽부터 합치므로,
+	// 결합 법칙이 성립하는 연산이면 스레드 수나 실행 순서와 상관없이 같은 값을 낸다.
+	// 함수 객체는 여러 스레드에서 동시에 불리므로 공유 상태를 바꾸면 안 된다.
+	namespace par
+	{
+		class Policy
+		{
+		public:
+			enum { DEFAULT_GRAIN = 1 << 16, DEFAULT_THRESHOLD = 1 << 15 };
+
+			ThreadPool	*pool;
+			size_t		grain;
+			size_t		threshold;
+
+		public:
+			Policy(size_t g = DEFAULT_GRAIN, size_t t = DEFAULT_THRESHOLD, ThreadPool &p = ThreadPool::global())
+				: pool(&p), grain(g ? g : 1), threshold(t)
+			{
+			}
+
+			bool	sequential(size_t n) const
+			{
+				return (n < threshold || pool->size() == 0);
+			}
+
+			size_t	chunks(size_t n) const
+			{
+				return ((n + grain - 1) / grain);
+			}
+		};
+
+		namespace detail
+		{
+			// [0, n)을 덩어리로 나눠 f(lo, hi)를 부른다
+			template <class Function>
+			void				run(size_t n, const Policy &policy, Function f)
+			{
+				if (n == 0)
+					return ;
+				if (policy.sequential(n))
+					f(0, n);
+				else
+					policy.pool->parallel_for(0, n, policy.grain, f);
+			}
+
+			// 덩어리 번호 [0, chunks)마다 f(c)를 부른다
+			template <class Function>
+			void				run_chunks(size_t chunks, size_t n, const Policy &policy, Function f)
+			{
+				if (policy.sequential(n))
+				{
+					for (size_t c = 0; c < chunks; ++c)
+						f(c, c + 1);
+				}
+				else
+					policy.pool->parallel_for(0, chunks, 1, f);
+			}
+
+			template <class T, class Function>
+			struct ForEach
+			{
+				T			*first;
+				Function	f;
+
+				ForEach(T *p, const Function &fn) : first(p), f(fn) {}
+
+				void	operator() (size_t lo, size_t hi)
+				{
+					for (size_t i = lo; i < hi; ++i)
+						f(first[i]);
+				}
+			};
+
+			template <class T, class U, class Function>
+			struct Transform
+			{
+				T			*in;
+				U			*out;
+				Function	op;
+
+				Transform(T *i, U *o, const Function &fn) : in(i), out(o), op(fn) {}
+
+				void	operator() (size_t lo, size_t hi)
+				{
+					for (size_t i = lo; i < hi; ++i)
+						out[i] = op(in[i]);
+				}
+			};
+
+			template <class T, class U>
+			struct Copy
+			{
+				T		*in;
+				U		*out;
+
+				Copy(T *i, U *o) : in(i), out(o) {}
+
+				void	operator() (size_t lo, size_t hi) const
+				{
+					for (size_t i = lo; i < hi; ++i)
+						out[i] = in[i];
+				}
+			};
+
+			template <class T, class V>
+			struct Fill
+			{
+				T		*out;
+				V		value;
+
+				Fill(T *o, const V &v) : out(o), value(v) {}
+
+				void	operator() (size_t lo, size_t hi) const
+				{
+					for (size_t i = lo; i < hi; ++i)
+						out[i] = value;
+				}
+			};
+
+			// 덩어리마다 첫 원소부터 왼쪽으로 접은 값을 partial[c]에 둔다
+			template <class T, class V, class Function>
+			struct ChunkReduce
+			{
+				T			*in;
+				V			*partial;
+				size_t		n;
+				size_t		grain;
+				Function	op;
+
+				ChunkReduce(T *i, V *p, size_t n_, size_t g, const Function &fn)
+					: in(i), partial(p), n(n_), grain(g), op(fn) {}
+
+				void	operator() (size_t lo, size_t hi)
+				{
+					for (size_t c = lo; c < hi; ++c)
+					{
+						size_t	begin = c * grain;
+						size_t	end = begin + grain < n ? begin + grain : n;
+						V		acc = in[begin];
+
+						for (size_t i = begin + 1; i < end; ++i)
+							acc = op(acc, in[i]);
+						partial[c] = acc;
+					}
+				}
+			};
+
+			// 덩어리마다 offset[c]에서 시작해 누적한다. inclusive가 아니면 자기 자신은 빼고 쓴다
+			// offset[c]가 없는 첫 덩어리(has_offset 거짓)는 첫 원소부터 시작한다
+			template <class T, class U, class V, class Function>
+			struct ChunkScan
+			{
+				T			*in;
+				U			*out;
+				V			*offset;
+				size_t		n;
+				size_t		grain;
+				bool		inclusive;
+				bool		has_first_offset;
+				Function	op;
+
+				ChunkScan(T *i, U *o, V *off, size_t n_, size_t g, bool inc, bool first_off, const Function &fn)
+					: in(i), out(o), offset(off), n(n_), grain(g), inclusive(inc), has_first_offset(first_off), op(fn) {}
+
+				void	operator() (size_t lo, size_t hi)
+				{
+					for (size_t c = lo; c < hi; ++c)
+					{
+						size_t	begin = c * grain;
+						size_t	end = begin + grain < n ? begin + grain : n;
+						size_t	i = begin;
+						V		acc;
+
+						if (c == 0 && !has_first_offset)
+						{
+							acc = in[0];
+							out[0] = acc;
+							i = 1;
+						}
+						else
+							acc = offset[c];
+						for (; i < end; ++i)
+						{
+							V	x = in[i];
+
+							if (inclusive)
+							{
+								acc = op(acc, x);
+								out[i] = acc;
+							}
+							else
+							{
+								out[i] = acc;
+								acc = op(acc, x);
+							}
+						}
+					}
+				}
+			};
+
+			template <class T>
+			struct Plus
+			{
+				T	operator() (const T &a, const T &b) const
+				{ return (a + b); }
+			};
+
+			// 덩어리 합을 구하고, 왼쪽부터 누적한 시작값으로 각 덩어리를 다시 훑는다
+			template <class T, class U, class V, class Function>
+			void				scan(T *in, U *out, size_t n, const V *init, bool inclusive,
+									Function op, const Policy &policy)
+			{
+				size_t			chunks;
+				ft::Vector<V>	partial;
+				ft::Vector<V>	offset;
+
+				if (n == 0)
+					return ;
+				chunks = policy.chunks(n);
+				partial.assign(chunks, V());
+				offset.assign(chunks, V());
+				run_chunks(chunks, n, policy, ChunkReduce<T, V, Function>(in, &partial[0], n, policy.grain, op));
+				// offset[c] = init op partial[0] op ... op partial[c - 1]
+				for (size_t c = 0; c < chunks; ++c)
+				{
+					if (c == 0)
+					{
+						if (init)
+							offset[0] = *init;
+					}
+					else if (c == 1 && !init)
+						offset[1] = partial[0];
+					else
+						offset[c] = op(offset[c - 1], partial[c - 1]);
+				}
+				run_chunks(chunks, n, policy,
+					ChunkScan<T, U, V, Function>(in, out, &offset[0], n, policy.grain, inclusive, init != 0, op));
+			}
+		}
+
+		// 각 원소에 f(x)를 부른다
+		template <class Iterator, class Function>
+		void			for_each(Iterator first, Iterator last, Function f, const Policy &policy = Policy())
+		{
+			typedef typename ft::detail::RawType<Iterator>::type	T;
+			T		*p = ft::detail::raw(first);
+
+			detail::run(ft::detail::raw(last) - p, policy, detail::ForEach<T, Function>(p, f));
+		}
+
+		// out[i] = op(first[i]), 출력의 끝을 반환. 제자리(out == first)도 된다
+		template <class InputIterator, class OutputIterator, class Function>
+		OutputIterator	transform(InputIterator first, InputIterator last, OutputIterator out, Function op,
+								const Policy &policy = Policy())
+		{
+			typedef typename ft::detail::RawType<InputIterator>::type	T;
+			typedef typename ft::detail::RawType<OutputIterator>::type	U;
+			size_t	n = ft::detail::raw(last) - ft::detail::raw(first);
+
+			detail::run(n, policy, detail::Transform<T, U, Function>(ft::detail::raw(first), ft::detail::raw(out), op));
+			return (ft::detail::advance(out, n));
+		}
+
+		// 출력의 끝을 반환. 두 구간이 겹치면 안 된다
+		template <class InputIterator, class OutputIterator>
+		OutputIterator	copy(InputIterator first, InputIterator last, OutputIterator out, const Policy &policy = Policy())
+		{
+			typedef typename ft::detail::RawType<InputIterator>::type	T;
+			typedef typename ft::detail::RawType<OutputIterator>::type	U;
+			size_t	n = ft::detail::raw(last) - ft::detail::raw(first);
+
+			detail::run(n, policy, detail::Copy<T, U>(ft::detail::raw(first), ft::detail::raw(out)));
+			return (ft::detail::advance(out, n));
+		}
+
+		template <class Iterator, class V>
+		void			fill(Iterator first, Iterator last, const V &value, const Policy &policy = Policy())
+		{
+			typedef typename ft::detail::RawType<Iterator>::type	T;
+			T		*p = ft::detail::raw(first);
+
+			detail::run(ft::detail::raw(last) - p, policy, detail::Fill<T, V>(p, value));
+		}
+
+		// init op x0 op x1 ... , 덩어리마다 접은 값을 왼쪽부터 합친다
+		template <class Iterator, class V, class Function>
+		V				reduce(Iterator first, Iterator last, V init, Function op, const Policy &policy = Policy())
+		{
+			typedef typename ft::detail::RawType<Iterator>::type	T;
+			size_t			n = ft::detail::raw(last) - ft::detail::raw(first);
+			size_t			chunks;
+			ft::Vector<V>	partial;
+
+			if (n == 0)
+				return (init);
+			chunks = policy.chunks(n);
+			partial.assign(chunks, V());
+			detail::run_chunks(chunks, n, policy,
+				detail::ChunkReduce<T, V, Function>(ft::detail::raw(first), &partial[0], n, policy.grain, op));
+			for (size_t c = 0; c < chunks; ++c)
+				init = op(init, partial[c]);
+			return (init);
+		}
+
+		template <class Iterator, class V>
+		V				reduce(Iterator first, Iterator last, V init, const Policy &policy = Policy())
+		{
+			return (par::reduce(first, last, init, detail::Plus<V>(), policy));
+		}
+
+		// out[i] = x0 op ... op xi, 출력의 끝을 반환. 제자리도 된다
+		template <class InputIterator, class OutputIterator, class Function>
+		OutputIterator	inclusive_scan(InputIterator first, InputIterator last, OutputIterator out, Function op,
+									const Policy &policy = Policy())
+		{
+			typedef typename ft::detail::RawType<InputIterator>::type	T;
+			typedef typename ft::detail::RawType<OutputIterator>::type	U;
+			size_t	n = ft::detail::raw(last) - ft::detail::raw(first);
+
+			detail::scan<T, U, U>(ft::detail::raw(first), ft::detail::raw(out), n, 0, true, op, policy);
+			return (ft::detail::advance(out, n));
+		}
+
+		template <class InputIterator, class OutputIterator>
+		OutputIterator	inclusive_scan(InputIterator first, InputIterator last, OutputIterator out,
+									const Policy &policy = Policy())
+		{
+			typedef typename ft::detail::RawType<OutputIterator>::type	U;
+
+			return (par::inclusive_scan(first, last, out, detail::Plus<U>(), policy));
+		}
+
+		// out[i] = init op x0 op ... op x(i - 1), 출력의 끝을 반환. 제자리도 된다
+		template <class InputIterator, class OutputIterator, class V, class Function>
+		OutputIterator	exclusive_scan(InputIterator first, InputIterator last, OutputIterator out, V init, Function op,
+									const Policy &policy = Policy())
+		{
+			typedef typename ft::detail::RawType<InputIterator>::type	T;
+			typedef typename ft::detail::RawType<OutputIterator>::type	U;
+			size_t	n = ft::detail::raw(last) - ft::detail::raw(first);
+
+			detail::scan<T, U, V>(ft::detail::raw(first), ft::detail::raw(out), n, &init, false, op, policy);
+			return (ft::detail::advance(out, n));
+		}
+
+		template <class InputIterator, class OutputIterator, class V>
+		OutputIterator	exclusive_scan(InputIterator first, InputIterator last, OutputIterator out, V init,
+									const Policy &policy = Policy())
+		{
+			return (par::exclusive_scan(first, last, out, init, detail::Plus<V>(), policy));
+		}
+	}
+}
+
+#endif
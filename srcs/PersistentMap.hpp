@@ -0,0 +1,432 @@
+#ifndef PERSISTENT_MAP_HPP
+# define PERSISTENT_MAP_HPP
+
+# include <memory>
+# include <stdexcept>
+# include "PersistentNode.hpp"
+# include "PersistentMapIterator.hpp"
+# include "ReversePersistentMapIterator.hpp"
+# include "utils.hpp"
+
+namespace ft
+{
+	// 불변(persistent) Map
+	// 수정은 루트부터 바뀐 노드까지의 경로(O(log n)개)만 새로 만들고 나머지 노드는 이전 버전과 공유한다.
+	// 복사(스냅샷)는 루트의 참조 카운트만 올리므로 O(1)이고, 스냅샷은 다른 스레드로 넘겨도 된다.
+	// 한 객체를 여러 스레드가 동시에 수정하는 것은 안 된다. 쓰는 쪽이 스냅샷을 만들어 읽는 쪽에 넘길 것
+	// 균형은 OrderStatMap과 같은 weight-balanced tree (delta = 3, ratio = 2)
+	template < class Key, class T, class Compare = ft::less<Key>, class Alloc = std::allocator<ft::Pair<Key, T> > >
+	class PersistentMap
+	{
+	public:
+		typedef Key												key_type;
+		typedef T												mapped_type;
+		typedef ft::Pair<key_type, mapped_type>					value_type;
+		typedef Compare											key_compare;
+		typedef Alloc											allocator_type;
+		typedef typename allocator_type::reference				reference;
+		typedef typename allocator_type::const_reference		const_reference;
+		typedef typename allocator_type::pointer				pointer;
+		typedef typename allocator_type::const_pointer			const_pointer;
+		typedef PersistentMapIterator<value_type>				iterator;
+		typedef PersistentMapIterator<value_type>				const_iterator;
+		typedef ReversePersistentMapIterator<value_type>		reverse_iterator;
+		typedef ReversePersistentMapIterator<value_type>		const_reverse_iterator;
+		typedef ptrdiff_t										difference_type;
+		typedef size_t											size_type;
+
+	private:
+		typedef PersistentNode<value_type>						node_type;
+		typedef typename allocator_type::template
+				rebind<node_type>::other						node_allocator;
+
+		enum { DELTA = 3, RATIO = 2 };
+
+		allocator_type		_allocator;
+		node_allocator		_node_allocator;
+		key_compare			_key_comp;
+		node_type*			_root;
+
+	public:
+		explicit PersistentMap(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type())
+			: _allocator(alloc), _node_allocator(alloc), _key_comp(comp), _root(0)
+		{
+		}
+
+		template <class InputIterator>
+		PersistentMap(InputIterator first, InputIterator last, const key_compare &comp = key_compare(),
+					const allocator_type &alloc = allocator_type())
+			: _allocator(alloc), _node_allocator(alloc), _key_comp(comp), _root(0)
+		{
+			insert(first, last);
+		}
+
+		// 스냅샷, O(1)
+		PersistentMap(const PersistentMap &copy)
+			: _allocator(copy._allocator), _node_allocator(copy._node_allocator), _key_comp(copy._key_comp), _root(copy._root)
+		{
+			if (_root)
+				_root->retain();
+		}
+
+		~PersistentMap()
+		{
+			release(_root);
+		}
+
+		PersistentMap	&operator=(const PersistentMap &ref)
+		{
+			if (ref._root)
+				ref._root->retain();
+			release(_root);
+			_root = ref._root;
+			_key_comp = ref._key_comp;
+			return (*this);
+		}
+
+		PersistentMap	snapshot() const
+		{
+			return (*this);
+		}
+
+		const_iterator			begin() const
+		{
+			const_iterator	ret(_root);
+
+			ret.push_leftmost(_root);
+			return (ret);
+		}
+
+		const_iterator			end() const
+		{
+			return (const_iterator(_root));
+		}
+
+		const_reverse_iterator	rbegin() const
+		{
+			const_iterator	ret(_root);
+
+			ret.push_rightmost(_root);
+			return (ret);
+		}
+
+		const_reverse_iterator	rend() const
+		{
+			return (const_iterator(_root));
+		}
+
+		bool		empty() const
+		{ return (_root == 0); }
+
+		size_type	size() const
+		{ return (node_size(_root)); }
+
+		size_type	max_size() const
+		{ return (_node_allocator.max_size()); }
+
+		const mapped_type	&at(const key_type &k) const
+		{
+			const node_type		*node;
+
+			node = find_node(k);
+			if (node == 0)
+				throw (std::out_of_range("PersistentMap::at"));
+			return (node->_data.second);
+		}
+
+		// 같은 키가 있으면 바꾸지 않는다 (Map::insert와 같음)
+		ft::Pair<iterator, bool>	insert(const value_type &val)
+		{
+			node_type	*new_root;
+
+			if (find_node(val.first))
+				return (ft::Pair<iterator, bool>(find(val.first), false));
+			new_root = insert_node(_root, val);
+			release(_root);
+			_root = new_root;
+			return (ft::Pair<iterator, bool>(find(val.first), true));
+		}
+
+		iterator	insert(iterator position, const value_type &val)
+		{
+			(void)position;
+			return (insert(val).first);
+		}
+
+		template <class InputIterator>
+		void		insert(InputIterator first, InputIterator last)
+		{
+			while (first != last)
+			{
+				insert(*first);
+				++first;
+			}
+		}
+
+		// 키가 있으면 값을 바꾼 경로를 새로 만들고, 없으면 삽입한다
+		iterator	assign(const key_type &k, const mapped_type &val)
+		{
+			node_type	*new_root;
+
+			if (find_node(k))
+				new_root = replace_node(_root, value_type(k, val));
+			else
+				new_root = insert_node(_root, value_type(k, val));
+			release(_root);
+			_root = new_root;
+			return (find(k));
+		}
+
+		void		erase(iterator position)
+		{
+			erase(position->first);
+		}
+
+		size_type	erase(const key_type &k)
+		{
+			node_type	*new_root;
+
+			if (find_node(k) == 0)
+				return (0);
+			new_root = erase_node(_root, k);
+			release(_root);
+			_root = new_root;
+			return (1);
+		}
+
+		// 이터레이터가 가리키는 노드가 중간에 해제되지 않도록 이전 버전을 잡아둔다
+		void		erase(iterator first, iterator last)
+		{
+			PersistentMap	keep(*this);
+
+			while (first != last)
+			{
+				erase(first->first);
+				++first;
+			}
+		}
+
+		void		swap(PersistentMap &x)
+		{
+			ft::swap(_allocator, x._allocator);
+			ft::swap(_node_allocator, x._node_allocator);
+			ft::swap(_key_comp, x._key_comp);
+			ft::swap(_root, x._root);
+		}
+
+		void		clear()
+		{
+			release(_root);
+			_root = 0;
+		}
+
+		key_compare		key_comp() const
+		{ return (_key_comp); }
+
+		const_iterator	find(const key_type &k) const
+		{
+			const_iterator	ret;
+
+			ret = lower_bound(k);
+			if (ret != end() && _key_comp(k, ret->first))
+				return (end());
+			return (ret);
+		}
+
+		size_type		count(const key_type &k) const
+		{ return (find_node(k) ? 1 : 0); }
+
+		const_iterator	lower_bound(const key_type &k) const
+		{
+			const_iterator		ret(_root);
+			const node_type		*node;
+			int					found;
+
+			found = 0;
+			node = _root;
+			while (node)
+			{
+				ret._path[ret._depth++] = node;
+				if (!_key_comp(node->_data.first, k))
+				{
+					found = ret._depth;
+					node = node->_left;
+				}
+				else
+					node = node->_right;
+			}
+			ret._depth = found;
+			return (ret);
+		}
+
+		const_iterator	upper_bound(const key_type &k) const
+		{
+			const_iterator		ret(_root);
+			const node_type		*node;
+			int					found;
+
+			found = 0;
+			node = _root;
+			while (node)
+			{
+				ret._path[ret._depth++] = node;
+				if (_key_comp(k, node->_data.first))
+				{
+					found = ret._depth;
+					node = node->_left;
+				}
+				else
+					node = node->_right;
+			}
+			ret._depth = found;
+			return (ret);
+		}
+
+		ft::Pair<const_iterator, const_iterator>	equal_range(const key_type &k) const
+		{ return (ft::Pair<const_iterator, const_iterator>(lower_bound(k), upper_bound(k))); }
+
+		allocator_type	get_allocator() const
+		{ return (_allocator); }
+
+	private:
+		static size_type	node_size(const node_type *node)
+		{ return (node ? node->_size : 0); }
+
+		static node_type	*retain(node_type *node)
+		{
+			if (node)
+				node->retain();
+			return (node);
+		}
+
+		// 참조를 하나 놓고, 마지막이었으면 자식들의 참조도 놓는다
+		void		release(node_type *node)
+		{
+			node_type	*right;
+
+			while (node && node->release())
+			{
+				release(node->_left);
+				right = node->_right;
+				_node_allocator.destroy(node);
+				_node_allocator.deallocate(node, 1);
+				node = right;
+			}
+		}
+
+		// left, right의 참조를 넘겨받는다
+		node_type	*make_node(const value_type &val, node_type *left, node_type *right)
+		{
+			node_type	*node;
+
+			node = _node_allocator.allocate(1);
+			_node_allocator.construct(node, node_type(val, left, right));
+			return (node);
+		}
+
+		// left, right의 참조를 넘겨받아 균형 잡힌 새 노드를 반환
+		// 회전에 쓰인 자식 노드는 새로 만들고 원래 것은 참조를 놓는다
+		node_type	*balance(const value_type &val, node_type *left, node_type *right)
+		{
+			node_type	*ret;
+			node_type	*mid;
+
+			if (node_size(right) + 1 > DELTA * (node_size(left) + 1))
+			{
+				if (node_size(right->_left) + 1 < RATIO * (node_size(right->_right) + 1))
+					ret = make_node(right->_data, make_node(val, left, retain(right->_left)), retain(right->_right));
+				else
+				{
+					mid = right->_left;
+					ret = make_node(mid->_data, make_node(val, left, retain(mid->_left)),
+									make_node(right->_data, retain(mid->_right), retain(right->_right)));
+				}
+				release(right);
+				return (ret);
+			}
+			if (node_size(left) + 1 > DELTA * (node_size(right) + 1))
+			{
+				if (node_size(left->_right) + 1 < RATIO * (node_size(left->_left) + 1))
+					ret = make_node(left->_data, retain(left->_left), make_node(val, retain(left->_right), right));
+				else
+				{
+					mid = left->_right;
+					ret = make_node(mid->_data, make_node(left->_data, retain(left->_left), retain(mid->_left)),
+									make_node(val, retain(mid->_right), right));
+				}
+				release(left);
+				return (ret);
+			}
+			return (make_node(val, left, right));
+		}
+
+		const node_type	*find_node(const key_type &k) const
+		{
+			const node_type		*node;
+
+			node = _root;
+			while (node)
+			{
+				if (_key_comp(k, node->_data.first))
+					node = node->_left;
+				else if (_key_comp(node->_data.first, k))
+					node = node->_right;
+				else
+					return (node);
+			}
+			return (0);
+		}
+
+		// 키가 없다는 것을 확인한 뒤 호출, 새 버전의 루트(참조 1개)를 반환
+		node_type	*insert_node(node_type *node, const value_type &val)
+		{
+			if (node == 0)
+				return (make_node(val, 0, 0));
+			if (_key_comp(val.first, node->_data.first))
+				return (balance(node->_data, insert_node(node->_left, val), retain(node->_right)));
+			return (balance(node->_data, retain(node->_left), insert_node(node->_right, val)));
+		}
+
+		// 키가 있다는 것을 확인한 뒤 호출, 모양은 그대로 두고 경로만 복사
+		node_type	*replace_node(node_type *node, const value_type &val)
+		{
+			if (_key_comp(val.first, node->_data.first))
+				return (make_node(node->_data, replace_node(node->_left, val), retain(node->_right)));
+			if (_key_comp(node->_data.first, val.first))
+				return (make_node(node->_data, retain(node->_left), replace_node(node->_right, val)));
+			return (make_node(val, retain(node->_left), retain(node->_right)));
+		}
+
+		// 최솟값을 min에 복사하고 그것을 뺀 서브트리를 반환
+		node_type	*erase_min(node_type *node, const node_type *&min)
+		{
+			if (node->_left == 0)
+			{
+				min = node;
+				return (retain(node->_right));
+			}
+			return (balance(node->_data, erase_min(node->_left, min), retain(node->_right)));
+		}
+
+		// 키가 있다는 것을 확인한 뒤 호출
+		node_type	*erase_node(node_type *node, const key_type &k)
+		{
+			node_type			*rest;
+			const node_type		*min;
+
+			if (_key_comp(k, node->_data.first))
+				return (balance(node->_data, erase_node(node->_left, k), retain(node->_right)));
+			if (_key_comp(node->_data.first, k))
+				return (balance(node->_data, retain(node->_left), erase_node(node->_right, k)));
+			if (node->_left == 0)
+				return (retain(node->_right));
+			if (node->_right == 0)
+				return (retain(node->_left));
+			min = 0;
+			rest = erase_min(node->_right, min);
+			return (balance(min->_data, retain(node->_left), rest));
+		}
+	};
+}
+
+#endif
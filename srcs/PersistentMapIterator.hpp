@@ -0,0 +1,155 @@
+#ifndef PERSISTENT_MAP_ITERATOR_HPP
+# define PERSISTENT_MAP_ITERATOR_HPP
+
+# include "Iterator.hpp"
+# include "PersistentNode.hpp"
+
+// PersistentMap 이터레이터
+// 노드에 부모 포인터가 없으므로 루트부터의 경로를 스택으로 들고 다닌다. _depth == 0 이면 end()
+// 원소는 여러 스냅샷이 공유하므로 const로만 접근한다.
+// 이터레이터를 만든 스냅샷이 살아있는 동안만 유효하다.
+template <typename T>
+class PersistentMapIterator
+{
+public:
+	// weight-balanced tree에서 자식의 무게는 부모의 3/4 이하라서 높이는 log_{4/3}(n) 이하, 2^39개까지 충분하다
+	enum { MAX_DEPTH = 96 };
+
+	const PersistentNode<T>*	_root;
+	const PersistentNode<T>*	_path[MAX_DEPTH];
+	int							_depth;
+
+public:
+	typedef typename Iterator<bidirectional_iterator_tag, T>::iterator_category	iterator_category;
+	typedef typename Iterator<bidirectional_iterator_tag, T>::value_type		value_type;
+	typedef typename Iterator<bidirectional_iterator_tag, T>::difference_type	difference_type;
+	typedef const T*															pointer;
+	typedef const T&															reference;
+
+	PersistentMapIterator() : _root(0), _depth(0)
+	{
+	}
+
+	explicit PersistentMapIterator(const PersistentNode<T> *root) : _root(root), _depth(0)
+	{
+	}
+
+	PersistentMapIterator(const PersistentMapIterator &copy)
+	{
+		*this = copy;
+	}
+
+	PersistentMapIterator&	operator=(const PersistentMapIterator &ref)
+	{
+		_root = ref._root;
+		_depth = ref._depth;
+		for (int i = 0; i < _depth; ++i)
+			_path[i] = ref._path[i];
+		return (*this);
+	}
+
+	~PersistentMapIterator()
+	{
+	}
+
+	const PersistentNode<T>	*node() const
+	{
+		return (_depth ? _path[_depth - 1] : 0);
+	}
+
+	bool				operator==(const PersistentMapIterator &ref) const
+	{
+		return (node() == ref.node());
+	}
+
+	bool				operator!=(const PersistentMapIterator &ref) const
+	{
+		return (node() != ref.node());
+	}
+
+	reference			operator*() const
+	{
+		return (_path[_depth - 1]->_data);
+	}
+
+	pointer				operator->() const
+	{
+		return (&(_path[_depth - 1]->_data));
+	}
+
+	void				push_leftmost(const PersistentNode<T> *node)
+	{
+		while (node)
+		{
+			_path[_depth++] = node;
+			node = node->_left;
+		}
+	}
+
+	void				push_rightmost(const PersistentNode<T> *node)
+	{
+		while (node)
+		{
+			_path[_depth++] = node;
+			node = node->_right;
+		}
+	}
+
+	// end()에서 ++하면 첫 원소 (rend()에서 --할 때 쓰인다)
+	PersistentMapIterator	&operator++()
+	{
+		const PersistentNode<T>*	child;
+
+		if (_depth == 0)
+			push_leftmost(_root);
+		else if (_path[_depth - 1]->_right)
+			push_leftmost(_path[_depth - 1]->_right);
+		else
+		{
+			do
+			{
+				child = _path[--_depth];
+			}
+			while (_depth && _path[_depth - 1]->_right == child);
+		}
+		return (*this);
+	}
+
+	PersistentMapIterator	operator++(int)
+	{
+		PersistentMapIterator	tmp(*this);
+
+		++(*this);
+		return (tmp);
+	}
+
+	// end()에서 --하면 마지막 원소
+	PersistentMapIterator	&operator--()
+	{
+		const PersistentNode<T>*	child;
+
+		if (_depth == 0)
+			push_rightmost(_root);
+		else if (_path[_depth - 1]->_left)
+			push_rightmost(_path[_depth - 1]->_left);
+		else
+		{
+			do
+			{
+				child = _path[--_depth];
+			}
+			while (_depth && _path[_depth - 1]->_left == child);
+		}
+		return (*this);
+	}
+
+	PersistentMapIterator	operator--(int)
+	{
+		PersistentMapIterator	tmp(*this);
+
+		--(*this);
+		return (tmp);
+	}
+};
+
+#endif
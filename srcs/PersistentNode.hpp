@@ -0,0 +1,52 @@
+#ifndef PERSISTENT_NODE_HPP
+# define PERSISTENT_NODE_HPP
+
+# include <cstddef>
+
+// PersistentMap의 노드
+// 한 번 만들어지면 바뀌지 않고 여러 버전(스냅샷)이 공유한다.
+// _refs는 이 노드를 가리키는 부모/루트의 수, 다른 스레드에서 스냅샷을 놓을 수 있으므로 원자적으로 바꾼다.
+template <typename T>
+class PersistentNode
+{
+public:
+	T					_data;
+	PersistentNode<T>*	_left;
+	PersistentNode<T>*	_right;
+	size_t				_size;
+	long				_refs;
+
+	PersistentNode(const T &data, PersistentNode<T> *left, PersistentNode<T> *right)
+		: _data(data), _left(left), _right(right), _size(1), _refs(1)
+	{
+		if (left)
+			_size += left->_size;
+		if (right)
+			_size += right->_size;
+	}
+
+	PersistentNode(const PersistentNode &copy)
+		: _data(copy._data), _left(copy._left), _right(copy._right), _size(copy._size), _refs(copy._refs)
+	{
+	}
+
+	~PersistentNode()
+	{
+	}
+
+	void		retain()
+	{
+		__sync_add_and_fetch(&_refs, 1);
+	}
+
+	// 마지막 참조였으면 true
+	bool		release()
+	{
+		return (__sync_sub_and_fetch(&_refs, 1) == 0);
+	}
+
+private:
+	PersistentNode		&operator=(const PersistentNode &);
+};
+
+#endif
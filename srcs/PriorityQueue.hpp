@@ -0,0 +1,118 @@
+#ifndef PRIORITY_QUEUE_HPP
+# define PRIORITY_QUEUE_HPP
+
+# include "Vector.hpp"
+# include "Heap.hpp"
+
+namespace ft
+{
+	// 힙 위의 우선순위 큐, top()이 comp 기준으로 가장 큰 원소 (가장 작은 것이 먼저면 ft::greater)
+	// 자식이 Arity개인 힙을 Container 하나에 담는다. Container는 임의 접근 이터레이터와
+	// front, push_back, pop_back이 있어야 한다 (ft::Vector, std::vector, std::deque).
+	template <class T, class Container = ft::Vector<T>, class Compare = ft::less<typename Container::value_type>,
+			size_t Arity = HEAP_ARITY>
+	class PriorityQueue
+	{
+	public:
+		typedef T								value_type;
+		typedef Container						container_type;
+		typedef Compare							value_compare;
+		typedef size_t							size_type;
+
+	private:
+		typedef detail::DaryHeap<Arity>			heap;
+
+		Container				_container;
+		Compare					_comp;
+
+	public:
+		explicit PriorityQueue(const value_compare &comp = value_compare(), const container_type &ctnr = container_type())
+			: _container(ctnr), _comp(comp)
+		{
+			heapify();
+		}
+
+		template <class InputIterator>
+		PriorityQueue(InputIterator first, InputIterator last, const value_compare &comp = value_compare(),
+					const container_type &ctnr = container_type())
+			: _container(ctnr), _comp(comp)
+		{
+			for (; first != last; ++first)
+				_container.push_back(*first);
+			heapify();
+		}
+
+		bool				empty() const
+		{
+			return (_container.empty());
+		}
+
+		size_type			size() const
+		{
+			return (_container.size());
+		}
+
+		const value_type	&top() const
+		{
+			return (_container.front());
+		}
+
+		void				push(const value_type &val)
+		{
+			_container.push_back(val);
+			heap::sift_up(_container.begin(), _container.size() - 1, val, _comp);
+		}
+
+		// 여러 개를 한 번에 넣는다. 넣는 개수가 많으면 하나씩 올리지 않고 전체를 O(n)에 다시 쌓는다
+		template <class InputIterator>
+		void				push_range(InputIterator first, InputIterator last)
+		{
+			size_type	before = _container.size();
+			size_type	added;
+
+			for (; first != last; ++first)
+				_container.push_back(*first);
+			added = _container.size() - before;
+			// 하나씩 올리면 added * 높이, 다시 쌓으면 전체 크기에 비례
+			if (added * height(_container.size()) >= _container.size())
+				heapify();
+			else
+			{
+				for (size_type i = before; i < _container.size(); ++i)
+					heap::sift_up(_container.begin(), i, value_type(_container[i]), _comp);
+			}
+		}
+
+		void				pop()
+		{
+			heap::template pop<value_type>(_container.begin(), _container.size(), _comp);
+			_container.pop_back();
+		}
+
+		void				swap(PriorityQueue &x)
+		{
+			_container.swap(x._container);
+			ft::swap(_comp, x._comp);
+		}
+
+	private:
+		void				heapify()
+		{
+			heap::template make<value_type>(_container.begin(), _container.size(), _comp);
+		}
+
+		static size_type	height(size_type n)
+		{
+			size_type	h = 1;
+
+			while (n >= Arity)
+			{
+				n /= Arity;
+				++h;
+			}
+			return (h);
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,298 @@
+#ifndef RADIX_SORT_HPP
+# define RADIX_SORT_HPP
+
+# include <cstddef>
+# include <cstring>
+# include <climits>
+# include "Algorithm.hpp"
+# include "Parallel.hpp"
+# include "Vector.hpp"
+
+namespace ft
+{
+	// 키를 같은 크기의 부호 없는 정수로 바꿔서, 그 정수의 대소가 원래 키의 대소와 같게 한다
+	// 부호 있는 정수는 부호 비트를 뒤집고, 실수는 음수면 모든 비트를, 양수면 부호 비트만 뒤집는다.
+	// 실수의 -0.0은 0.0보다 앞에, NaN은 부호에 따라 맨 앞이나 맨 뒤에 온다.
+	template <typename K>
+	struct RadixKey;
+
+	template <typename U>
+	struct UnsignedRadixKey
+	{
+		typedef U		type;
+
+		static type		encode(U x)
+		{ return (x); }
+	};
+
+	template <typename S, typename U>
+	struct SignedRadixKey
+	{
+		typedef U		type;
+
+		static type		encode(S x)
+		{ return (static_cast<U>(x) ^ (static_cast<U>(1) << (sizeof(U) * 8 - 1))); }
+	};
+
+	template <typename F, typename U>
+	struct FloatRadixKey
+	{
+		typedef U		type;
+
+		static type		encode(F x)
+		{
+			U	bits;
+			U	sign = static_cast<U>(1) << (sizeof(U) * 8 - 1);
+
+			std::memcpy(&bits, &x, sizeof(U));
+			return ((bits & sign) ? ~bits : (bits | sign));
+		}
+	};
+
+	template <> struct RadixKey<unsigned char> : UnsignedRadixKey<unsigned char> {};
+	template <> struct RadixKey<unsigned short> : UnsignedRadixKey<unsigned short> {};
+	template <> struct RadixKey<unsigned int> : UnsignedRadixKey<unsigned int> {};
+	template <> struct RadixKey<unsigned long> : UnsignedRadixKey<unsigned long> {};
+	template <> struct RadixKey<unsigned long long> : UnsignedRadixKey<unsigned long long> {};
+	template <> struct RadixKey<signed char> : SignedRadixKey<signed char, unsigned char> {};
+# if CHAR_MIN < 0
+	template <> struct RadixKey<char> : SignedRadixKey<char, unsigned char> {};
+# else
+	template <> struct RadixKey<char> : UnsignedRadixKey<char> {};
+# endif
+	template <> struct RadixKey<short> : SignedRadixKey<short, unsigned short> {};
+	template <> struct RadixKey<int> : SignedRadixKey<int, unsigned int> {};
+	template <> struct RadixKey<long> : SignedRadixKey<long, unsigned long> {};
+	template <> struct RadixKey<long long> : SignedRadixKey<long long, unsigned long long> {};
+	template <> struct RadixKey<float> : FloatRadixKey<float, unsigned int> {};
+	template <> struct RadixKey<double> : FloatRadixKey<double, unsigned long long> {};
+
+	namespace detail
+	{
+		// 한 번에 보는 자릿수 (8비트, 256칸 히스토그램이 L1에 들어간다)
+		enum { RADIX_BITS = 8, RADIX_BUCKETS = 1 << RADIX_BITS };
+
+		// 원소를 그대로 키로 쓴다
+		template <typename T>
+		struct RadixIdentity
+		{
+			const T		&operator() (const T &x) const
+			{ return (x); }
+		};
+
+		// 블록 [lo, hi)마다 자리 pass의 히스토그램을 센다. pass가 음수면 모든 자리를 한 번에 센다
+		template <class T, class KeyOf, class K>
+		struct RadixCount
+		{
+			typedef typename RadixKey<K>::type	U;
+			enum { PASSES = sizeof(U) };
+
+			const T		*in;
+			size_t		n;
+			size_t		blocks;
+			KeyOf		key;
+			int			pass;
+			// [블록][자리][칸]
+			size_t		*count;
+
+			RadixCount(const T *i, size_t n_, size_t b, const KeyOf &k, int p, size_t *c)
+				: in(i), n(n_), blocks(b), key(k), pass(p), count(c) {}
+
+			void	operator() (size_t lo, size_t hi)
+			{
+				for (size_t b = lo; b < hi; ++b)
+				{
+					size_t	*hist = count + b * PASSES * RADIX_BUCKETS;
+					size_t	end = n * (b + 1) / blocks;
+
+					for (size_t i = n * b / blocks; i < end; ++i)
+					{
+						U	u = RadixKey<K>::encode(key(in[i]));
+
+						if (pass >= 0)
+							++hist[pass * RADIX_BUCKETS + ((u >> (pass * RADIX_BITS)) & (RADIX_BUCKETS - 1))];
+						else
+						{
+							for (int p = 0; p < PASSES; ++p)
+								++hist[p * RADIX_BUCKETS + ((u >> (p * RADIX_BITS)) & (RADIX_BUCKETS - 1))];
+						}
+					}
+				}
+			}
+		};
+
+		// 블록마다 offset[블록][칸]부터 차례로 옮긴다. 블록과 블록 안의 순서를 지키므로 안정 정렬
+		template <class T, class KeyOf, class K>
+		struct RadixScatter
+		{
+			typedef typename RadixKey<K>::type	U;
+
+			const T		*in;
+			T			*out;
+			size_t		n;
+			size_t		blocks;
+			KeyOf		key;
+			int			pass;
+			size_t		*offset;
+
+			RadixScatter(const T *i, T *o, size_t n_, size_t b, const KeyOf &k, int p, size_t *off)
+				: in(i), out(o), n(n_), blocks(b), key(k), pass(p), offset(off) {}
+
+			void	operator() (size_t lo, size_t hi)
+			{
+				for (size_t b = lo; b < hi; ++b)
+				{
+					size_t	*off = offset + b * RADIX_BUCKETS;
+					size_t	end = n * (b + 1) / blocks;
+
+					for (size_t i = n * b / blocks; i < end; ++i)
+					{
+						U	u = RadixKey<K>::encode(key(in[i]));
+
+						out[off[(u >> (pass * RADIX_BITS)) & (RADIX_BUCKETS - 1)]++] = in[i];
+					}
+				}
+			}
+		};
+
+		template <class Function>
+		void	radix_run(size_t blocks, const par::Policy *policy, Function f)
+		{
+			if (blocks == 1)
+				f(0, 1);
+			else
+				policy->pool->parallel_for(0, blocks, 1, f);
+		}
+
+		// LSD 기수 정렬, 아래 자리부터 한 자리씩 안정적으로 흩뿌린다
+		// 모든 자리의 히스토그램을 한 번에 세고, 모든 키가 같은 값을 가진 자리는 건너뛴다.
+		// policy가 있으면 구간을 스레드 수만큼의 블록으로 나눠 세기와 흩뿌리기를 병렬로 한다.
+		// sample은 키 타입 K를 추론하기 위한 것
+		template <class T, class KeyOf, class K>
+		void	radix_sort(T *data, size_t n, KeyOf key, const par::Policy *policy, const K &sample)
+		{
+			typedef typename RadixKey<K>::type	U;
+			enum { PASSES = sizeof(U) };
+			size_t			blocks = 1;
+			ft::Vector<size_t>	count;
+			ft::Vector<size_t>	total;
+			ft::Vector<size_t>	offset;
+			ft::Vector<T>	buffer;
+			T				*src = data;
+			T				*dst;
+			T				*tmp;
+			size_t			sum;
+
+			(void)sample;
+			if (policy && !policy->sequential(n))
+			{
+				blocks = policy->pool->size() + 1;
+				if (blocks > policy->chunks(n))
+					blocks = policy->chunks(n);
+			}
+			count.assign(blocks * PASSES * RADIX_BUCKETS, 0);
+			radix_run(blocks, policy, RadixCount<T, KeyOf, K>(data, n, blocks, key, -1, &count[0]));
+			// 블록별 히스토그램을 합친다
+			total.assign(count.begin(), count.begin() + PASSES * RADIX_BUCKETS);
+			for (size_t b = 1; b < blocks; ++b)
+			{
+				for (size_t i = 0; i < PASSES * RADIX_BUCKETS; ++i)
+					total[i] += count[b * PASSES * RADIX_BUCKETS + i];
+			}
+			buffer.assign(data, data + n);
+			dst = &buffer[0];
+			offset.assign(blocks * RADIX_BUCKETS, 0);
+			for (int p = 0; p < PASSES; ++p)
+			{
+				U	first_digit = (RadixKey<K>::encode(key(src[0])) >> (p * RADIX_BITS)) & (RADIX_BUCKETS - 1);
+
+				if (total[p * RADIX_BUCKETS + first_digit] == n)
+					continue ;
+				if (blocks == 1)
+				{
+					sum = 0;
+					for (size_t d = 0; d < RADIX_BUCKETS; ++d)
+					{
+						offset[d] = sum;
+						sum += total[p * RADIX_BUCKETS + d];
+					}
+				}
+				else
+				{
+					// 흩뿌릴 때마다 블록 안의 원소가 바뀌므로 이 자리를 블록별로 다시 센다
+					count.assign(blocks * PASSES * RADIX_BUCKETS, 0);
+					radix_run(blocks, policy, RadixCount<T, KeyOf, K>(src, n, blocks, key, p, &count[0]));
+					// 칸 순서, 같은 칸 안에서는 블록 순서로 시작 위치를 정한다
+					sum = 0;
+					for (size_t d = 0; d < RADIX_BUCKETS; ++d)
+					{
+						for (size_t b = 0; b < blocks; ++b)
+						{
+							offset[b * RADIX_BUCKETS + d] = sum;
+							sum += count[(b * PASSES + p) * RADIX_BUCKETS + d];
+						}
+					}
+				}
+				radix_run(blocks, policy, RadixScatter<T, KeyOf, K>(src, dst, n, blocks, key, p, &offset[0]));
+				tmp = src;
+				src = dst;
+				dst = tmp;
+			}
+			if (src != data)
+			{
+				for (size_t i = 0; i < n; ++i)
+					data[i] = src[i];
+			}
+		}
+	}
+
+	// 정수나 실수 구간을 오름차순으로 정렬한다. 같은 값의 순서는 지킨다 (안정 정렬)
+	// 구간 크기만큼 버퍼를 쓴다
+	template <class RandomIterator>
+	void	radix_sort(RandomIterator first, RandomIterator last)
+	{
+		typedef typename detail::RawType<RandomIterator>::type	T;
+		T		*f = detail::raw(first);
+		size_t	n = detail::raw(last) - f;
+
+		if (n > 1)
+			detail::radix_sort(f, n, detail::RadixIdentity<T>(), static_cast<const par::Policy *>(0), *f);
+	}
+
+	// policy의 ThreadPool로 세기와 흩뿌리기를 나눠서 한다. 구간이 threshold보다 짧으면 순차 실행
+	template <class RandomIterator>
+	void	radix_sort(RandomIterator first, RandomIterator last, const par::Policy &policy)
+	{
+		typedef typename detail::RawType<RandomIterator>::type	T;
+		T		*f = detail::raw(first);
+		size_t	n = detail::raw(last) - f;
+
+		if (n > 1)
+			detail::radix_sort(f, n, detail::RadixIdentity<T>(), &policy, *f);
+	}
+
+	// key(x)가 돌려주는 정수나 실수로 정렬한다 (예: ft::Select1st로 Pair의 first)
+	template <class RandomIterator, class KeyOf>
+	void	radix_sort_by_key(RandomIterator first, RandomIterator last, KeyOf key)
+	{
+		typedef typename detail::RawType<RandomIterator>::type	T;
+		T		*f = detail::raw(first);
+		size_t	n = detail::raw(last) - f;
+
+		if (n > 1)
+			detail::radix_sort(f, n, key, static_cast<const par::Policy *>(0), key(*f));
+	}
+
+	template <class RandomIterator, class KeyOf>
+	void	radix_sort_by_key(RandomIterator first, RandomIterator last, KeyOf key, const par::Policy &policy)
+	{
+		typedef typename detail::RawType<RandomIterator>::type	T;
+		T		*f = detail::raw(first);
+		size_t	n = detail::raw(last) - f;
+
+		if (n > 1)
+			detail::radix_sort(f, n, key, &policy, key(*f));
+	}
+}
+
+#endif
@@ -0,0 +1,809 @@
+#ifndef RB_TREE_HPP
+# define RB_TREE_HPP
+
+# include <memory>
+# include "MapNode.hpp"
+# include "MapIterator.hpp"
+# include "ReverseMapIterator.hpp"
+# include "utils.hpp"
+
+namespace ft
+{
+	// Map, Set, Multimap, Multiset이 공유하는 red-black 트리
+	// Value: 노드에 저장되는 값, KeyOfValue: Value에서 비교에 쓸 키를 꺼내는 함수 객체
+	// end()는 Map과 같이 널 이터레이터다.
+	// 맨 왼쪽, 맨 오른쪽 노드를 따로 들고 있어서 begin(), rbegin()과 힌트 삽입의 양 끝 확인이 O(1)이다.
+	template < class Key, class Value, class KeyOfValue, class Compare, class Alloc >
+	class RbTree
+	{
+	public:
+		typedef Key											key_type;
+		typedef Value										value_type;
+		typedef Compare										key_compare;
+		typedef Alloc										allocator_type;
+		typedef MapIterator<value_type>						iterator;
+		typedef const MapIterator<value_type>				const_iterator;
+		typedef ReverseMapIterator<value_type>				reverse_iterator;
+		typedef const ReverseMapIterator<value_type>		const_reverse_iterator;
+		typedef ptrdiff_t									difference_type;
+		typedef size_t										size_type;
+
+	private:
+		typedef typename allocator_type::template
+				rebind< MapNode<value_type> >::other		node_allocator;
+
+		allocator_type			_allocator;
+		node_allocator			_node_allocator;
+		key_compare				_key_comp;
+		KeyOfValue				_key_of;
+		MapNode<value_type>*	_root;
+		MapNode<value_type>*	_leftmost;
+		MapNode<value_type>*	_rightmost;
+		size_type				_size;
+
+	public:
+		explicit RbTree(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type())
+			: _allocator(alloc), _node_allocator(alloc), _key_comp(comp), _key_of(), _root(0), _leftmost(0),
+			_rightmost(0), _size(0)
+		{
+		}
+
+		// 모양과 색을 그대로 복제하므로 O(n)
+		RbTree(const RbTree &copy)
+			: _allocator(copy._allocator), _node_allocator(copy._node_allocator), _key_comp(copy._key_comp),
+			_key_of(copy._key_of), _root(0), _leftmost(0), _rightmost(0), _size(copy._size)
+		{
+			_root = clone(copy._root, 0);
+			reset_ends();
+		}
+
+		~RbTree()
+		{
+			clear();
+		}
+
+		RbTree		&operator=(const RbTree &ref)
+		{
+			if (this == &ref)
+				return (*this);
+			clear();
+			_key_comp = ref._key_comp;
+			_root = clone(ref._root, 0);
+			_size = ref._size;
+			reset_ends();
+			return (*this);
+		}
+
+		iterator				begin()
+		{ return (_leftmost); }
+
+		const_iterator			begin() const
+		{ return (_leftmost); }
+
+		iterator				end()
+		{ return (0); }
+
+		const_iterator			end() const
+		{ return (0); }
+
+		reverse_iterator		rbegin()
+		{ return (_rightmost); }
+
+		const_reverse_iterator	rbegin() const
+		{ return (_rightmost); }
+
+		reverse_iterator		rend()
+		{ return (0); }
+
+		const_reverse_iterator	rend() const
+		{ return (0); }
+
+		bool		empty() const
+		{ return (_size == 0); }
+
+		size_type	size() const
+		{ return (_size); }
+
+		size_type	max_size() const
+		{ return (_node_allocator.max_size()); }
+
+		key_compare		key_comp() const
+		{ return (_key_comp); }
+
+		allocator_type	get_allocator() const
+		{ return (_allocator); }
+
+		// 같은 키가 있으면 삽입하지 않는다
+		ft::Pair<iterator, bool>	insert_unique(const value_type &val)
+		{
+			MapNode<value_type>*	node;
+			MapNode<value_type>*	parent;
+			bool					go_left;
+
+			parent = 0;
+			go_left = false;
+			node = _root;
+			while (node)
+			{
+				parent = node;
+				if (_key_comp(_key_of(val), _key_of(node->_data)))
+				{
+					go_left = true;
+					node = node->_left;
+				}
+				else if (_key_comp(_key_of(node->_data), _key_of(val)))
+				{
+					go_left = false;
+					node = node->_right;
+				}
+				else
+					return (ft::Pair<iterator, bool>(node, false));
+			}
+			return (ft::Pair<iterator, bool>(attach(parent, go_left, val), true));
+		}
+
+		// 같은 키들의 맨 뒤에 삽입해서 삽입 순서를 유지한다
+		iterator	insert_equal(const value_type &val)
+		{
+			MapNode<value_type>*	node;
+			MapNode<value_type>*	parent;
+			bool					go_left;
+
+			parent = 0;
+			go_left = false;
+			node = _root;
+			while (node)
+			{
+				parent = node;
+				go_left = _key_comp(_key_of(val), _key_of(node->_data));
+				node = go_left ? node->_left : node->_right;
+			}
+			return (attach(parent, go_left, val));
+		}
+
+		// hint 바로 앞(또는 뒤)에 들어갈 자리라면 탐색 없이 붙인다. 정렬된 입력이면 분할상환 O(1)
+		iterator	insert_unique(iterator hint, const value_type &val)
+		{
+			MapNode<value_type>*	node;
+			MapNode<value_type>*	other;
+
+			node = hint._element;
+			if (node == 0)
+			{
+				other = _rightmost;
+				if (other && _key_comp(_key_of(other->_data), _key_of(val)))
+					return (attach(other, false, val));
+				return (insert_unique(val).first);
+			}
+			if (_key_comp(_key_of(val), _key_of(node->_data)))
+			{
+				if (node == _leftmost)
+					return (attach(node, true, val));
+				other = (--hint)._element;
+				if (_key_comp(_key_of(other->_data), _key_of(val)))
+					return (other->_right == 0 ? attach(other, false, val) : attach(node, true, val));
+				return (insert_unique(val).first);
+			}
+			if (_key_comp(_key_of(node->_data), _key_of(val)))
+			{
+				if (node == _rightmost)
+					return (attach(node, false, val));
+				other = (++hint)._element;
+				if (_key_comp(_key_of(val), _key_of(other->_data)))
+					return (node->_right == 0 ? attach(node, false, val) : attach(other, true, val));
+				return (insert_unique(val).first);
+			}
+			return (node);
+		}
+
+		// 같은 키가 있으면 hint에 가장 가까운 쪽에 넣는다
+		iterator	insert_equal(iterator hint, const value_type &val)
+		{
+			MapNode<value_type>*	node;
+			MapNode<value_type>*	other;
+
+			node = hint._element;
+			if (node == 0)
+			{
+				other = _rightmost;
+				if (other && !_key_comp(_key_of(val), _key_of(other->_data)))
+					return (attach(other, false, val));
+				return (insert_equal(val));
+			}
+			if (!_key_comp(_key_of(node->_data), _key_of(val)))
+			{
+				if (node == _leftmost)
+					return (attach(node, true, val));
+				other = (--hint)._element;
+				if (!_key_comp(_key_of(val), _key_of(other->_data)))
+					return (other->_right == 0 ? attach(other, false, val) : attach(node, true, val));
+				return (insert_equal(val));
+			}
+			if (node == _rightmost)
+				return (attach(node, false, val));
+			other = (++hint)._element;
+			if (!_key_comp(_key_of(other->_data), _key_of(val)))
+				return (node->_right == 0 ? attach(node, false, val) : attach(other, true, val));
+			return (insert_equal_lower(val));
+		}
+
+		// 후속 노드의 값을 복사하지 않고 노드 자체를 다시 연결하므로
+		// 지워지는 원소 외의 이터레이터는 모두 유효하다.
+		void		erase(iterator position)
+		{
+			unlink_node(position._element);
+			destroy_node(position._element);
+		}
+
+		// 범위 전체를 먼저 트리에서 떼어낸 뒤 한 번에 해제한다.
+		// 삭제 한 번의 재균형은 분할상환 O(1) 회전이고 다음 원소는 부모/오른쪽으로 몇 칸이라 O(k + log n)
+		// 전체 범위면 clear()로 후위 순회 한 번에 해제한다.
+		size_type	erase(iterator first, iterator last)
+		{
+			MapNode<value_type>*	detached;
+			MapNode<value_type>*	node;
+			size_type				ret;
+
+			if (first == last)
+				return (0);
+			if (last._element == 0 && first == begin())
+			{
+				ret = _size;
+				clear();
+				return (ret);
+			}
+			ret = 0;
+			detached = 0;
+			while (first != last)
+			{
+				node = first._element;
+				++first;
+				unlink_node(node);
+				node->_left = detached;
+				detached = node;
+				++ret;
+			}
+			while (detached)
+			{
+				node = detached;
+				detached = detached->_left;
+				destroy_node(node);
+			}
+			return (ret);
+		}
+
+		// 키가 같은 원소를 모두 지우고 개수를 반환
+		size_type	erase_key(const key_type &k)
+		{
+			return (erase(lower_node(k), upper_node(k)));
+		}
+
+		void		swap(RbTree &x)
+		{
+			ft::swap(_allocator, x._allocator);
+			ft::swap(_node_allocator, x._node_allocator);
+			ft::swap(_key_comp, x._key_comp);
+			ft::swap(_root, x._root);
+			ft::swap(_leftmost, x._leftmost);
+			ft::swap(_rightmost, x._rightmost);
+			ft::swap(_size, x._size);
+		}
+
+		void		clear()
+		{
+			destroy_tree(_root);
+			_root = 0;
+			_leftmost = 0;
+			_rightmost = 0;
+			_size = 0;
+		}
+
+		// 내용을 gen()이 차례로 돌려주는 n개의 값으로 바꾼다. 값은 키 순서로 정렬돼 있어야 한다 (확인하지 않음)
+		// 가운데 원소를 뿌리로 삼아 재귀적으로 쌓으므로 회전이 없고 O(n). 맨 아래 층만 빨강으로 칠한다.
+		// gen()이 예외를 던지면 그때까지 만든 노드를 지우고 빈 트리로 남긴다.
+		template <class Generator>
+		void		build_sorted(size_type n, Generator &gen)
+		{
+			int		red_depth;
+
+			clear();
+			red_depth = 0;
+			for (size_type m = n; m > 1; m >>= 1)
+				++red_depth;
+			try
+			{
+				_root = build_node(n, 0, red_depth, gen);
+			}
+			catch (...)
+			{
+				_size = 0;
+				throw ;
+			}
+			if (_root)
+				_root->_red = false;
+			reset_ends();
+		}
+
+		iterator		find(const key_type &k)
+		{ return (find_node(k)); }
+
+		const_iterator	find(const key_type &k) const
+		{ return (find_node(k)); }
+
+		// 중복 키가 있으면 O(log n + k)
+		size_type		count(const key_type &k) const
+		{
+			iterator	first;
+			iterator	last;
+			size_type	ret;
+
+			ret = 0;
+			first = lower_node(k);
+			last = upper_node(k);
+			while (first != last)
+			{
+				++first;
+				++ret;
+			}
+			return (ret);
+		}
+
+		iterator		lower_bound(const key_type &k)
+		{ return (lower_node(k)); }
+
+		const_iterator	lower_bound(const key_type &k) const
+		{ return (lower_node(k)); }
+
+		iterator		upper_bound(const key_type &k)
+		{ return (upper_node(k)); }
+
+		const_iterator	upper_bound(const key_type &k) const
+		{ return (upper_node(k)); }
+
+		ft::Pair<iterator, iterator>	equal_range(const key_type &k)
+		{ return (ft::Pair<iterator, iterator>(lower_node(k), upper_node(k))); }
+
+		ft::Pair<const_iterator, const_iterator>	equal_range(const key_type &k) const
+		{ return (ft::Pair<const_iterator, const_iterator>(lower_node(k), upper_node(k))); }
+
+	private:
+		// 같은 키들의 맨 앞에 삽입
+		iterator	insert_equal_lower(const value_type &val)
+		{
+			MapNode<value_type>*	node;
+			MapNode<value_type>*	parent;
+			bool					go_left;
+
+			parent = 0;
+			go_left = false;
+			node = _root;
+			while (node)
+			{
+				parent = node;
+				go_left = !_key_comp(_key_of(node->_data), _key_of(val));
+				node = go_left ? node->_left : node->_right;
+			}
+			return (attach(parent, go_left, val));
+		}
+
+		static MapNode<value_type>	*leftmost(MapNode<value_type> *node)
+		{
+			if (node == 0)
+				return (0);
+			while (node->_left)
+				node = node->_left;
+			return (node);
+		}
+
+		static MapNode<value_type>	*rightmost(MapNode<value_type> *node)
+		{
+			if (node == 0)
+				return (0);
+			while (node->_right)
+				node = node->_right;
+			return (node);
+		}
+
+		// 복사나 build_sorted처럼 트리를 통째로 만든 뒤 양 끝을 다시 찾는다
+		void		reset_ends()
+		{
+			_leftmost = leftmost(_root);
+			_rightmost = rightmost(_root);
+		}
+
+		MapNode<value_type>	*attach(MapNode<value_type> *parent, bool go_left, const value_type &val)
+		{
+			MapNode<value_type>*	node;
+
+			node = _node_allocator.allocate(1);
+			_node_allocator.construct(node, MapNode<value_type>(val));
+			node->_parent = parent;
+			if (parent == 0)
+			{
+				_root = node;
+				_leftmost = node;
+				_rightmost = node;
+			}
+			else if (go_left)
+			{
+				parent->_left = node;
+				if (parent == _leftmost)
+					_leftmost = node;
+			}
+			else
+			{
+				parent->_right = node;
+				if (parent == _rightmost)
+					_rightmost = node;
+			}
+			insert_fixup(node);
+			++_size;
+			return (node);
+		}
+
+		// 정렬된 n개로 균형 잡힌 서브트리를 만든다. 중위 순서로 gen()을 부른다
+		template <class Generator>
+		MapNode<value_type>	*build_node(size_type n, int depth, int red_depth, Generator &gen)
+		{
+			MapNode<value_type>*	left;
+			MapNode<value_type>*	node;
+
+			if (n == 0)
+				return (0);
+			left = build_node(n / 2, depth + 1, red_depth, gen);
+			try
+			{
+				node = _node_allocator.allocate(1);
+			}
+			catch (...)
+			{
+				destroy_tree(left);
+				throw ;
+			}
+			try
+			{
+				_node_allocator.construct(node, MapNode<value_type>(gen()));
+			}
+			catch (...)
+			{
+				_node_allocator.deallocate(node, 1);
+				destroy_tree(left);
+				throw ;
+			}
+			++_size;
+			node->_red = (depth == red_depth);
+			node->_left = left;
+			if (left)
+				left->_parent = node;
+			try
+			{
+				node->_right = build_node(n - n / 2 - 1, depth + 1, red_depth, gen);
+			}
+			catch (...)
+			{
+				// 오른쪽은 아직 비어 있으므로 node와 왼쪽 서브트리만 지워진다
+				destroy_tree(node);
+				throw ;
+			}
+			if (node->_right)
+				node->_right->_parent = node;
+			return (node);
+		}
+
+		MapNode<value_type>	*clone(const MapNode<value_type> *node, MapNode<value_type> *parent)
+		{
+			MapNode<value_type>*	ret;
+
+			if (node == 0)
+				return (0);
+			ret = _node_allocator.allocate(1);
+			_node_allocator.construct(ret, *node);
+			ret->_parent = parent;
+			ret->_left = clone(node->_left, ret);
+			ret->_right = clone(node->_right, ret);
+			return (ret);
+		}
+
+		MapNode<value_type>	*find_node(const key_type &k) const
+		{
+			MapNode<value_type>*	node;
+
+			node = lower_node(k);
+			if (node == 0 || _key_comp(k, _key_of(node->_data)))
+				return (0);
+			return (node);
+		}
+
+		// k 이상인 첫 노드
+		MapNode<value_type>	*lower_node(const key_type &k) const
+		{
+			MapNode<value_type>*	node;
+			MapNode<value_type>*	ret;
+
+			ret = 0;
+			node = _root;
+			while (node)
+			{
+				if (!_key_comp(_key_of(node->_data), k))
+				{
+					ret = node;
+					node = node->_left;
+				}
+				else
+					node = node->_right;
+			}
+			return (ret);
+		}
+
+		// k 초과인 첫 노드
+		MapNode<value_type>	*upper_node(const key_type &k) const
+		{
+			MapNode<value_type>*	node;
+			MapNode<value_type>*	ret;
+
+			ret = 0;
+			node = _root;
+			while (node)
+			{
+				if (_key_comp(k, _key_of(node->_data)))
+				{
+					ret = node;
+					node = node->_left;
+				}
+				else
+					node = node->_right;
+			}
+			return (ret);
+		}
+
+		void		destroy_node(MapNode<value_type> *node)
+		{
+			--_size;
+			_node_allocator.destroy(node);
+			_node_allocator.deallocate(node, 1);
+		}
+
+		void		destroy_tree(MapNode<value_type> *node)
+		{
+			MapNode<value_type>*	right;
+
+			while (node)
+			{
+				destroy_tree(node->_left);
+				right = node->_right;
+				destroy_node(node);
+				node = right;
+			}
+		}
+
+		static bool	is_red(MapNode<value_type> *node)
+		{
+			return (node != 0 && node->_red);
+		}
+
+		void		rotate_left(MapNode<value_type> *node)
+		{
+			MapNode<value_type>*	right;
+
+			right = node->_right;
+			node->_right = right->_left;
+			if (right->_left)
+				right->_left->_parent = node;
+			right->_parent = node->_parent;
+			if (node->_parent == 0)
+				_root = right;
+			else if (node == node->_parent->_left)
+				node->_parent->_left = right;
+			else
+				node->_parent->_right = right;
+			right->_left = node;
+			node->_parent = right;
+		}
+
+		void		rotate_right(MapNode<value_type> *node)
+		{
+			MapNode<value_type>*	left;
+
+			left = node->_left;
+			node->_left = left->_right;
+			if (left->_right)
+				left->_right->_parent = node;
+			left->_parent = node->_parent;
+			if (node->_parent == 0)
+				_root = left;
+			else if (node == node->_parent->_right)
+				node->_parent->_right = left;
+			else
+				node->_parent->_left = left;
+			left->_right = node;
+			node->_parent = left;
+		}
+
+		void		insert_fixup(MapNode<value_type> *node)
+		{
+			MapNode<value_type>*	uncle;
+
+			while (is_red(node->_parent))
+			{
+				if (node->_parent == node->_parent->_parent->_left)
+				{
+					uncle = node->_parent->_parent->_right;
+					if (is_red(uncle))
+					{
+						node->_parent->_red = false;
+						uncle->_red = false;
+						node->_parent->_parent->_red = true;
+						node = node->_parent->_parent;
+						continue ;
+					}
+					if (node == node->_parent->_right)
+					{
+						node = node->_parent;
+						rotate_left(node);
+					}
+					node->_parent->_red = false;
+					node->_parent->_parent->_red = true;
+					rotate_right(node->_parent->_parent);
+				}
+				else
+				{
+					uncle = node->_parent->_parent->_left;
+					if (is_red(uncle))
+					{
+						node->_parent->_red = false;
+						uncle->_red = false;
+						node->_parent->_parent->_red = true;
+						node = node->_parent->_parent;
+						continue ;
+					}
+					if (node == node->_parent->_left)
+					{
+						node = node->_parent;
+						rotate_right(node);
+					}
+					node->_parent->_red = false;
+					node->_parent->_parent->_red = true;
+					rotate_left(node->_parent->_parent);
+				}
+			}
+			_root->_red = false;
+		}
+
+		// node 자리에 child 서브트리를 연결
+		void		transplant(MapNode<value_type> *node, MapNode<value_type> *child)
+		{
+			if (node->_parent == 0)
+				_root = child;
+			else if (node == node->_parent->_left)
+				node->_parent->_left = child;
+			else
+				node->_parent->_right = child;
+			if (child)
+				child->_parent = node->_parent;
+		}
+
+		// 노드를 트리에서 떼어낸다. 해제는 호출한 쪽에서
+		void		unlink_node(MapNode<value_type> *node)
+		{
+			MapNode<value_type>*	successor;
+			MapNode<value_type>*	child;
+			MapNode<value_type>*	child_parent;
+			bool					removed_red;
+
+			// 양 끝 노드는 한쪽 자식이 없으므로 다음 끝은 남은 자식 쪽 끝이거나 부모다
+			if (node == _leftmost)
+				_leftmost = node->_right ? leftmost(node->_right) : node->_parent;
+			if (node == _rightmost)
+				_rightmost = node->_left ? rightmost(node->_left) : node->_parent;
+			removed_red = node->_red;
+			if (node->_left == 0)
+			{
+				child = node->_right;
+				child_parent = node->_parent;
+				transplant(node, node->_right);
+			}
+			else if (node->_right == 0)
+			{
+				child = node->_left;
+				child_parent = node->_parent;
+				transplant(node, node->_left);
+			}
+			else
+			{
+				successor = node->_right;
+				while (successor->_left)
+					successor = successor->_left;
+				removed_red = successor->_red;
+				child = successor->_right;
+				if (successor->_parent == node)
+					child_parent = successor;
+				else
+				{
+					child_parent = successor->_parent;
+					transplant(successor, successor->_right);
+					successor->_right = node->_right;
+					successor->_right->_parent = successor;
+				}
+				transplant(node, successor);
+				successor->_left = node->_left;
+				successor->_left->_parent = successor;
+				successor->_red = node->_red;
+			}
+			if (!removed_red)
+				erase_fixup(child, child_parent);
+		}
+
+		void		erase_fixup(MapNode<value_type> *node, MapNode<value_type> *parent)
+		{
+			MapNode<value_type>*	sibling;
+
+			while (node != _root && !is_red(node))
+			{
+				if (node == parent->_left)
+				{
+					sibling = parent->_right;
+					if (is_red(sibling))
+					{
+						sibling->_red = false;
+						parent->_red = true;
+						rotate_left(parent);
+						sibling = parent->_right;
+					}
+					if (!is_red(sibling->_left) && !is_red(sibling->_right))
+					{
+						sibling->_red = true;
+						node = parent;
+						parent = node->_parent;
+						continue ;
+					}
+					if (!is_red(sibling->_right))
+					{
+						sibling->_left->_red = false;
+						sibling->_red = true;
+						rotate_right(sibling);
+						sibling = parent->_right;
+					}
+					sibling->_red = parent->_red;
+					parent->_red = false;
+					sibling->_right->_red = false;
+					rotate_left(parent);
+					node = _root;
+				}
+				else
+				{
+					sibling = parent->_left;
+					if (is_red(sibling))
+					{
+						sibling->_red = false;
+						parent->_red = true;
+						rotate_right(parent);
+						sibling = parent->_left;
+					}
+					if (!is_red(sibling->_left) && !is_red(sibling->_right))
+					{
+						sibling->_red = true;
+						node = parent;
+						parent = node->_parent;
+						continue ;
+					}
+					if (!is_red(sibling->_left))
+					{
+						sibling->_right->_red = false;
+						sibling->_red = true;
+						rotate_left(sibling);
+						sibling = parent->_left;
+					}
+					sibling->_red = parent->_red;
+					parent->_red = false;
+					sibling->_left->_red = false;
+					rotate_right(parent);
+					node = _root;
+				}
+			}
+			if (node)
+				node->_red = false;
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,261 @@
+#ifndef RCU_MAP_HPP
+# define RCU_MAP_HPP
+
+# include <memory>
+# include <pthread.h>
+# include "PersistentMap.hpp"
+# include "Epoch.hpp"
+
+namespace ft
+{
+	// 읽기가 대부분인 Map (read-copy-update)
+	// 현재 버전은 PersistentMap 하나이고, 읽는 쪽은 EpochGuard 안에서 그 포인터를 읽어 잠금 없이 탐색한다.
+	// 읽기 경로에서 쓰는 것은 자기 epoch 슬롯뿐이고 노드의 참조 카운트는 건드리지 않는다.
+	// 쓰는 쪽은 mutex로 줄을 서서 경로를 복사한 새 버전을 만들고 포인터를 바꾼 뒤,
+	// 이전 버전을 EpochDomain에 넘긴다. 이전 버전이 지워질 때 새 버전과 공유하지 않는 노드만 해제된다.
+	template < class Key, class T, class Compare = ft::less<Key>, class Alloc = std::allocator<ft::Pair<Key, T> > >
+	class RcuMap
+	{
+	public:
+		typedef Key												key_type;
+		typedef T												mapped_type;
+		typedef ft::Pair<key_type, mapped_type>					value_type;
+		typedef Compare											key_compare;
+		typedef Alloc											allocator_type;
+		typedef ft::PersistentMap<Key, T, Compare, Alloc>		snapshot_type;
+		typedef size_t											size_type;
+
+	private:
+		typedef typename allocator_type::template
+				rebind<snapshot_type>::other					version_allocator;
+
+		EpochDomain			&_domain;
+		allocator_type		_allocator;
+		version_allocator	_version_allocator;
+		// 쓰는 쪽만 보는 최신 버전
+		snapshot_type		_master;
+		// 읽는 쪽에 공개된 버전
+		snapshot_type		*_current;
+		pthread_mutex_t		_write_lock;
+
+	public:
+		explicit RcuMap(EpochDomain &domain = EpochDomain::global(), const key_compare &comp = key_compare(),
+						const allocator_type &alloc = allocator_type())
+			: _domain(domain), _allocator(alloc), _version_allocator(alloc), _master(comp, alloc)
+		{
+			_current = new_version();
+			pthread_mutex_init(&_write_lock, 0);
+		}
+
+		// 이 맵을 읽는 스레드가 없어야 한다. 넘겨둔 이전 버전이 모두 지워질 때까지 기다린다
+		~RcuMap()
+		{
+			_domain.synchronize();
+			destroy_version(_current, this);
+			pthread_mutex_destroy(&_write_lock);
+		}
+
+		// 읽기: 모두 값을 복사해서 돌려준다
+
+		bool			find(const key_type &k, mapped_type &out) const
+		{
+			EpochGuard						guard(_domain);
+			const snapshot_type				*cur = current();
+			typename snapshot_type::const_iterator	it;
+
+			it = cur->find(k);
+			if (it == cur->end())
+				return (false);
+			out = it->second;
+			return (true);
+		}
+
+		size_type		count(const key_type &k) const
+		{
+			EpochGuard		guard(_domain);
+
+			return (current()->count(k));
+		}
+
+		size_type		size() const
+		{
+			EpochGuard		guard(_domain);
+
+			return (current()->size());
+		}
+
+		bool			empty() const
+		{
+			EpochGuard		guard(_domain);
+
+			return (current()->empty());
+		}
+
+		// k 이상인 첫 원소를 out에 복사, 없으면 false
+		bool			lower_bound(const key_type &k, value_type &out) const
+		{
+			EpochGuard						guard(_domain);
+			const snapshot_type				*cur = current();
+			typename snapshot_type::const_iterator	it;
+
+			it = cur->lower_bound(k);
+			if (it == cur->end())
+				return (false);
+			out = *it;
+			return (true);
+		}
+
+		// k보다 큰 첫 원소를 out에 복사, 없으면 false
+		bool			upper_bound(const key_type &k, value_type &out) const
+		{
+			EpochGuard						guard(_domain);
+			const snapshot_type				*cur = current();
+			typename snapshot_type::const_iterator	it;
+
+			it = cur->upper_bound(k);
+			if (it == cur->end())
+				return (false);
+			out = *it;
+			return (true);
+		}
+
+		// 한 버전을 키 순서대로 f(const value_type &)에 넘긴다. 그동안 일어난 쓰기는 보이지 않는다
+		template <class Function>
+		Function		for_each(Function f) const
+		{
+			EpochGuard		guard(_domain);
+			const snapshot_type	*cur = current();
+
+			for (typename snapshot_type::const_iterator it = cur->begin(); it != cur->end(); ++it)
+				f(*it);
+			return (f);
+		}
+
+		// 현재 버전의 스냅샷, 루트의 참조 카운트를 올리므로 오래 들고 있을 때 쓴다
+		snapshot_type	snapshot() const
+		{
+			EpochGuard		guard(_domain);
+
+			return (*current());
+		}
+
+		// 쓰기
+
+		// 같은 키가 있으면 바꾸지 않고 false
+		bool			insert(const value_type &val)
+		{
+			bool	ret;
+
+			pthread_mutex_lock(&_write_lock);
+			ret = _master.insert(val).second;
+			if (ret)
+				publish();
+			pthread_mutex_unlock(&_write_lock);
+			return (ret);
+		}
+
+		// 있으면 값을 바꾸고, 없으면 넣는다
+		void			assign(const key_type &k, const mapped_type &val)
+		{
+			pthread_mutex_lock(&_write_lock);
+			_master.assign(k, val);
+			publish();
+			pthread_mutex_unlock(&_write_lock);
+		}
+
+		size_type		erase(const key_type &k)
+		{
+			size_type	ret;
+
+			pthread_mutex_lock(&_write_lock);
+			ret = _master.erase(k);
+			if (ret)
+				publish();
+			pthread_mutex_unlock(&_write_lock);
+			return (ret);
+		}
+
+		// 여러 원소를 넣고 한 번만 공개한다. 새로 들어간 개수를 반환
+		template <class InputIterator>
+		size_type		insert(InputIterator first, InputIterator last)
+		{
+			size_type	before;
+			size_type	ret;
+
+			pthread_mutex_lock(&_write_lock);
+			before = _master.size();
+			_master.insert(first, last);
+			ret = _master.size() - before;
+			if (ret)
+				publish();
+			pthread_mutex_unlock(&_write_lock);
+			return (ret);
+		}
+
+		// f(snapshot_type &)로 여러 수정을 한 뒤 한 번에 공개한다. 읽는 쪽은 중간 상태를 보지 못한다
+		template <class Function>
+		Function		update(Function f)
+		{
+			pthread_mutex_lock(&_write_lock);
+			f(_master);
+			publish();
+			pthread_mutex_unlock(&_write_lock);
+			return (f);
+		}
+
+		void			clear()
+		{
+			pthread_mutex_lock(&_write_lock);
+			_master.clear();
+			publish();
+			pthread_mutex_unlock(&_write_lock);
+		}
+
+		key_compare		key_comp() const
+		{ return (_master.key_comp()); }
+
+		allocator_type	get_allocator() const
+		{ return (_allocator); }
+
+		EpochDomain		&domain() const
+		{ return (_domain); }
+
+	private:
+		const snapshot_type	*current() const
+		{
+			return (__atomic_load_n(&_current, __ATOMIC_ACQUIRE));
+		}
+
+		snapshot_type	*new_version()
+		{
+			snapshot_type	*ret;
+
+			ret = _version_allocator.allocate(1);
+			_version_allocator.construct(ret, _master);
+			return (ret);
+		}
+
+		// _write_lock을 잡은 상태에서 호출
+		void			publish()
+		{
+			snapshot_type	*old;
+
+			old = __atomic_exchange_n(&_current, new_version(), __ATOMIC_ACQ_REL);
+			_domain.retire(old, destroy_version, this);
+		}
+
+		static void		destroy_version(void *object, void *context)
+		{
+			RcuMap			*self = static_cast<RcuMap *>(context);
+			snapshot_type	*version = static_cast<snapshot_type *>(object);
+
+			self->_version_allocator.destroy(version);
+			self->_version_allocator.deallocate(version, 1);
+		}
+
+		RcuMap(const RcuMap &);
+		RcuMap	&operator=(const RcuMap &);
+	};
+}
+
+#endif
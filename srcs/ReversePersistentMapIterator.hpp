@@ -0,0 +1,91 @@
+#ifndef REVERSE_PERSISTENT_MAP_ITERATOR_HPP
+# define REVERSE_PERSISTENT_MAP_ITERATOR_HPP
+
+# include "PersistentMapIterator.hpp"
+
+// 정방향 이터레이터를 감싸서 ++, --를 뒤집는다. rend()는 end()와 같은 빈 경로
+template <typename T>
+class ReversePersistentMapIterator
+{
+public:
+	PersistentMapIterator<T>	_base;
+
+public:
+	typedef typename PersistentMapIterator<T>::iterator_category	iterator_category;
+	typedef typename PersistentMapIterator<T>::value_type			value_type;
+	typedef typename PersistentMapIterator<T>::difference_type		difference_type;
+	typedef typename PersistentMapIterator<T>::pointer				pointer;
+	typedef typename PersistentMapIterator<T>::reference			reference;
+
+	ReversePersistentMapIterator()
+	{
+	}
+
+	ReversePersistentMapIterator(const PersistentMapIterator<T> &base) : _base(base)
+	{
+	}
+
+	ReversePersistentMapIterator(const ReversePersistentMapIterator &copy) : _base(copy._base)
+	{
+	}
+
+	ReversePersistentMapIterator&	operator=(const ReversePersistentMapIterator &ref)
+	{
+		_base = ref._base;
+		return (*this);
+	}
+
+	~ReversePersistentMapIterator()
+	{
+	}
+
+	bool				operator==(const ReversePersistentMapIterator &ref) const
+	{
+		return (_base == ref._base);
+	}
+
+	bool				operator!=(const ReversePersistentMapIterator &ref) const
+	{
+		return (_base != ref._base);
+	}
+
+	reference			operator*() const
+	{
+		return (*_base);
+	}
+
+	pointer				operator->() const
+	{
+		return (_base.operator->());
+	}
+
+	ReversePersistentMapIterator	&operator++()
+	{
+		--_base;
+		return (*this);
+	}
+
+	ReversePersistentMapIterator	operator++(int)
+	{
+		ReversePersistentMapIterator	tmp(*this);
+
+		--_base;
+		return (tmp);
+	}
+
+	ReversePersistentMapIterator	&operator--()
+	{
+		++_base;
+		return (*this);
+	}
+
+	ReversePersistentMapIterator	operator--(int)
+	{
+		ReversePersistentMapIterator	tmp(*this);
+
+		++_base;
+		return (tmp);
+	}
+};
+
+#endif
@@ -0,0 +1,668 @@
+#ifndef SERIALIZE_HPP
+# define SERIALIZE_HPP
+
+# include <cstddef>
+# include <cstring>
+# include <cerrno>
+# include <string>
+# include <istream>
+# include <ostream>
+# include <stdexcept>
+# include <unistd.h>
+# include "Vector.hpp"
+# include "List.hpp"
+# include "Map.hpp"
+# include "utils.hpp"
+
+namespace ft
+{
+	// ft 컨테이너의 바이너리 저장 형식
+	//
+	// 헤더: "FTSZ", 버전(u32), 바이트 순서 표시(u32), 컨테이너 종류(u8), 원소를 통째로 옮겼는지(u8),
+	//       원소 크기(u16), 원소 수(u64)
+	// 덩어리: 원소 수(u32), 바이트 수(u32), 체크섬(u64), 내용. 원소 하나가 두 덩어리에 걸치지 않는다
+	// 끝: 원소 수와 바이트 수가 0인 덩어리
+	//
+	// 원소는 Codec<T>로 바이트로 바꾼다. Codec<T>::trivial이 참인 타입(정수, 실수와 그 Pair)의
+	// Vector는 원소를 메모리 그대로 덩어리 단위로 한 번에 write/read하고, 나머지는 CHUNK_BYTES 크기의
+	// 버퍼에 모아서 쓰므로 컨테이너가 아무리 커도 추가 메모리는 덩어리 하나다.
+	// Vector<bool>은 비트를 담은 워드 배열을 통째로 쓰고 헤더의 원소 수에 비트 수를 적는다.
+	// 기계의 바이트 순서를 그대로 쓰고, 순서가 다른 기계에서 읽으면 serialize_error를 던진다.
+	class serialize_error : public std::runtime_error
+	{
+	public:
+		explicit serialize_error(const std::string &what) : std::runtime_error("ft::serialize: " + what)
+		{
+		}
+	};
+
+	enum
+	{
+		SERIALIZE_VERSION = 1,
+		SERIALIZE_CHUNK_BYTES = 1 << 20,
+		// 통째로 옮기는 Vector의 덩어리 하나, 대부분은 write 한 번에 끝난다
+		SERIALIZE_RAW_CHUNK_BYTES = 1 << 26
+	};
+
+	// 저장할 곳: 파일 디스크립터나 ostream
+	class OutputSink
+	{
+	private:
+		int				_fd;
+		std::ostream	*_os;
+
+	public:
+		OutputSink(int fd) : _fd(fd), _os(0)
+		{
+		}
+
+		OutputSink(std::ostream &os) : _fd(-1), _os(&os)
+		{
+		}
+
+		void	write(const void *data, size_t len)
+		{
+			const char	*p = static_cast<const char *>(data);
+			ssize_t		ret;
+
+			if (_os)
+			{
+				_os->write(p, len);
+				if (!*_os)
+					throw serialize_error("stream write failed");
+				return ;
+			}
+			while (len > 0)
+			{
+				ret = ::write(_fd, p, len);
+				if (ret < 0 && errno == EINTR)
+					continue ;
+				if (ret <= 0)
+					throw serialize_error(std::string("write: ") + std::strerror(errno));
+				p += ret;
+				len -= ret;
+			}
+		}
+	};
+
+	// 읽을 곳: 파일 디스크립터나 istream
+	class InputSource
+	{
+	private:
+		int				_fd;
+		std::istream	*_is;
+
+	public:
+		InputSource(int fd) : _fd(fd), _is(0)
+		{
+		}
+
+		InputSource(std::istream &is) : _fd(-1), _is(&is)
+		{
+		}
+
+		// len 바이트를 모두 읽지 못하면 던진다
+		void	read(void *data, size_t len)
+		{
+			char		*p = static_cast<char *>(data);
+			ssize_t		ret;
+
+			if (_is)
+			{
+				_is->read(p, len);
+				if (static_cast<size_t>(_is->gcount()) != len)
+					throw serialize_error("unexpected end of stream");
+				return ;
+			}
+			while (len > 0)
+			{
+				ret = ::read(_fd, p, len);
+				if (ret < 0 && errno == EINTR)
+					continue ;
+				if (ret < 0)
+					throw serialize_error(std::string("read: ") + std::strerror(errno));
+				if (ret == 0)
+					throw serialize_error("unexpected end of file");
+				p += ret;
+				len -= ret;
+			}
+		}
+	};
+
+	namespace detail
+	{
+		enum
+		{
+			CONTAINER_VECTOR = 1,
+			CONTAINER_LIST = 2,
+			CONTAINER_MAP = 3,
+			CONTAINER_BIT_VECTOR = 4,
+			BYTE_ORDER_MARK = 0x01020304
+		};
+
+		// 4바이트 단어의 두 누적합 (Fletcher 방식), 바이트 단위 해시보다 훨씬 빠르다
+		inline unsigned long long	checksum(const void *data, size_t len)
+		{
+			const unsigned char		*p = static_cast<const unsigned char *>(data);
+			unsigned long long		a = 1;
+			unsigned long long		b = 0;
+			unsigned int			word;
+			size_t					i;
+
+			for (i = 0; i + 4 <= len; i += 4)
+			{
+				std::memcpy(&word, p + i, 4);
+				a += word;
+				b += a;
+			}
+			word = 0;
+			if (i < len)
+				std::memcpy(&word, p + i, len - i);
+			a += word + len;
+			b += a;
+			return ((b << 32) ^ a);
+		}
+
+		struct Header
+		{
+			char				magic[4];
+			unsigned int		version;
+			unsigned int		byte_order;
+			unsigned char		container;
+			unsigned char		trivial;
+			unsigned short		element_size;
+			unsigned long long	count;
+		};
+
+		struct ChunkHeader
+		{
+			unsigned int		count;
+			unsigned int		bytes;
+			unsigned long long	checksum;
+		};
+
+		inline void		write_header(OutputSink &out, int container, bool trivial, size_t element_size,
+									size_t count)
+		{
+			Header	h;
+
+			std::memset(&h, 0, sizeof(h));
+			std::memcpy(h.magic, "FTSZ", 4);
+			h.version = SERIALIZE_VERSION;
+			h.byte_order = BYTE_ORDER_MARK;
+			h.container = static_cast<unsigned char>(container);
+			h.trivial = trivial;
+			h.element_size = static_cast<unsigned short>(element_size);
+			h.count = count;
+			out.write(&h, sizeof(h));
+		}
+
+		// 헤더를 읽어 확인하고 원소 수를 반환
+		inline size_t	read_header(InputSource &in, int container, bool trivial, size_t element_size)
+		{
+			Header	h;
+
+			in.read(&h, sizeof(h));
+			if (std::memcmp(h.magic, "FTSZ", 4) != 0)
+				throw serialize_error("bad magic");
+			if (h.byte_order != BYTE_ORDER_MARK)
+				throw serialize_error("written on a machine with a different byte order");
+			if (h.version != SERIALIZE_VERSION)
+				throw serialize_error("unsupported version");
+			if (h.container != container)
+				throw serialize_error("container type mismatch");
+			if (h.trivial != trivial || (trivial && h.element_size != element_size))
+				throw serialize_error("element type mismatch");
+			return (static_cast<size_t>(h.count));
+		}
+
+		inline void		write_chunk(OutputSink &out, const void *data, size_t bytes, size_t count)
+		{
+			ChunkHeader	c;
+
+			c.count = static_cast<unsigned int>(count);
+			c.bytes = static_cast<unsigned int>(bytes);
+			c.checksum = checksum(data, bytes);
+			out.write(&c, sizeof(c));
+			if (bytes)
+				out.write(data, bytes);
+		}
+
+		inline ChunkHeader	read_chunk_header(InputSource &in)
+		{
+			ChunkHeader	c;
+
+			in.read(&c, sizeof(c));
+			return (c);
+		}
+
+		inline void		check_chunk(const ChunkHeader &c, const void *data)
+		{
+			if (checksum(data, c.bytes) != c.checksum)
+				throw serialize_error("checksum mismatch");
+		}
+	}
+
+	// 원소를 덩어리 버퍼에 모아 쓴다
+	class ChunkWriter
+	{
+	private:
+		OutputSink			_out;
+		std::string			_buffer;
+		size_t				_count;
+
+	public:
+		explicit ChunkWriter(const OutputSink &out) : _out(out), _count(0)
+		{
+			_buffer.reserve(SERIALIZE_CHUNK_BYTES);
+		}
+
+		void	put(const void *data, size_t len)
+		{
+			_buffer.append(static_cast<const char *>(data), len);
+		}
+
+		// 원소 하나를 다 썼을 때 부른다. 버퍼가 차면 내보낸다
+		void	end_element()
+		{
+			++_count;
+			if (_buffer.size() >= SERIALIZE_CHUNK_BYTES)
+				flush();
+		}
+
+		void	flush()
+		{
+			if (_count == 0)
+				return ;
+			detail::write_chunk(_out, _buffer.data(), _buffer.size(), _count);
+			_buffer.clear();
+			_count = 0;
+		}
+
+		// 남은 것을 내보내고 끝 표시를 쓴다
+		void	finish()
+		{
+			flush();
+			detail::write_chunk(_out, 0, 0, 0);
+		}
+	};
+
+	// 덩어리를 하나씩 읽어 확인한 뒤 원소 단위로 꺼내 준다
+	class ChunkReader
+	{
+	private:
+		InputSource			_in;
+		std::string			_buffer;
+		size_t				_pos;
+		size_t				_left;
+
+	public:
+		explicit ChunkReader(const InputSource &in) : _in(in), _pos(0), _left(0)
+		{
+		}
+
+		void	get(void *data, size_t len)
+		{
+			if (len > _buffer.size() - _pos)
+				throw serialize_error("element crosses chunk boundary");
+			std::memcpy(data, _buffer.data() + _pos, len);
+			_pos += len;
+		}
+
+		// 원소 하나를 읽기 전에 부른다. 현재 덩어리가 끝났으면 다음 덩어리를 읽는다
+		void	begin_element()
+		{
+			detail::ChunkHeader	c;
+
+			if (_left > 0)
+			{
+				--_left;
+				return ;
+			}
+			if (_pos != _buffer.size())
+				throw serialize_error("chunk has trailing bytes");
+			c = detail::read_chunk_header(_in);
+			if (c.count == 0)
+				throw serialize_error("fewer elements than the header says");
+			_buffer.resize(c.bytes);
+			if (c.bytes)
+				_in.read(&_buffer[0], c.bytes);
+			detail::check_chunk(c, _buffer.data());
+			_pos = 0;
+			_left = c.count - 1;
+		}
+
+		// 모든 원소를 읽은 뒤 끝 표시를 확인한다
+		void	finish()
+		{
+			detail::ChunkHeader	c;
+
+			if (_left > 0 || _pos != _buffer.size())
+				throw serialize_error("more elements than the header says");
+			c = detail::read_chunk_header(_in);
+			if (c.count != 0 || c.bytes != 0)
+				throw serialize_error("missing end marker");
+		}
+	};
+
+	// 원소를 바이트로 바꾸는 방법. 직접 만든 타입은 이 템플릿을 특수화한다
+	// trivial이 참이면 메모리를 그대로 복사해도 되는 타입이다
+	template <typename T>
+	struct Codec;
+
+	template <typename T>
+	struct TrivialCodec
+	{
+		enum { trivial = 1 };
+
+		static void	write(ChunkWriter &out, const T &x)
+		{ out.put(&x, sizeof(T)); }
+
+		static void	read(ChunkReader &in, T &x)
+		{ in.get(&x, sizeof(T)); }
+	};
+
+	template <> struct Codec<bool> : TrivialCodec<bool> {};
+	template <> struct Codec<char> : TrivialCodec<char> {};
+	template <> struct Codec<signed char> : TrivialCodec<signed char> {};
+	template <> struct Codec<unsigned char> : TrivialCodec<unsigned char> {};
+	template <> struct Codec<short> : TrivialCodec<short> {};
+	template <> struct Codec<unsigned short> : TrivialCodec<unsigned short> {};
+	template <> struct Codec<int> : TrivialCodec<int> {};
+	template <> struct Codec<unsigned int> : TrivialCodec<unsigned int> {};
+	template <> struct Codec<long> : TrivialCodec<long> {};
+	template <> struct Codec<unsigned long> : TrivialCodec<unsigned long> {};
+	template <> struct Codec<long long> : TrivialCodec<long long> {};
+	template <> struct Codec<unsigned long long> : TrivialCodec<unsigned long long> {};
+	template <> struct Codec<float> : TrivialCodec<float> {};
+	template <> struct Codec<double> : TrivialCodec<double> {};
+
+	// 길이(u64) 뒤에 바이트
+	template <>
+	struct Codec<std::string>
+	{
+		enum { trivial = 0 };
+
+		static void	write(ChunkWriter &out, const std::string &x)
+		{
+			unsigned long long	len = x.size();
+
+			out.put(&len, sizeof(len));
+			out.put(x.data(), x.size());
+		}
+
+		static void	read(ChunkReader &in, std::string &x)
+		{
+			unsigned long long	len;
+
+			in.get(&len, sizeof(len));
+			x.resize(static_cast<size_t>(len));
+			if (len)
+				in.get(&x[0], static_cast<size_t>(len));
+		}
+	};
+
+	// 두 값을 차례로 쓴다. 둘 다 trivial이고 사이에 빈 바이트가 없으면 Pair도 trivial
+	template <typename T1, typename T2>
+	struct Codec< ft::Pair<T1, T2> >
+	{
+		enum { trivial = Codec<T1>::trivial && Codec<T2>::trivial
+				&& sizeof(ft::Pair<T1, T2>) == sizeof(T1) + sizeof(T2) };
+
+		static void	write(ChunkWriter &out, const ft::Pair<T1, T2> &x)
+		{
+			Codec<T1>::write(out, x.first);
+			Codec<T2>::write(out, x.second);
+		}
+
+		static void	read(ChunkReader &in, ft::Pair<T1, T2> &x)
+		{
+			Codec<T1>::read(in, x.first);
+			Codec<T2>::read(in, x.second);
+		}
+	};
+
+	namespace detail
+	{
+		template <class InputIterator>
+		void	write_elements(OutputSink &out, InputIterator first, InputIterator last)
+		{
+			typedef typename InputIterator::value_type	T;
+			ChunkWriter		writer(out);
+
+			for (; first != last; ++first)
+			{
+				Codec<T>::write(writer, *first);
+				writer.end_element();
+			}
+			writer.finish();
+		}
+
+		// Vector의 메모리를 덩어리째로 쓴다
+		template <class T>
+		void	write_raw(OutputSink &out, const T *data, size_t n)
+		{
+			size_t	per_chunk = SERIALIZE_RAW_CHUNK_BYTES / sizeof(T);
+			size_t	count;
+
+			for (size_t i = 0; i < n; i += count)
+			{
+				count = n - i < per_chunk ? n - i : per_chunk;
+				write_chunk(out, data + i, count * sizeof(T), count);
+			}
+			write_chunk(out, 0, 0, 0);
+		}
+
+		// 통째로 쓴 덩어리의 헤더를 읽어 확인한다. left는 아직 읽지 않은 원소 수
+		inline ChunkHeader	read_raw_chunk_header(InputSource &in, size_t left, size_t element_size)
+		{
+			ChunkHeader	c;
+
+			c = read_chunk_header(in);
+			if (c.count == 0 || c.count > left || c.bytes != c.count * element_size)
+				throw serialize_error("bad chunk");
+			return (c);
+		}
+
+		inline void		read_end_marker(InputSource &in)
+		{
+			ChunkHeader	c;
+
+			c = read_chunk_header(in);
+			if (c.count != 0 || c.bytes != 0)
+				throw serialize_error("missing end marker");
+		}
+
+		// 헤더의 원소 수는 믿지 않고, 확인한 덩어리만큼만 늘려 가며 읽는다
+		template <class T, class Alloc>
+		void	read_raw(InputSource &in, ft::Vector<T, Alloc> &v, size_t n)
+		{
+			ChunkHeader	c;
+
+			for (size_t i = 0; i < n; i += c.count)
+			{
+				c = read_raw_chunk_header(in, n - i, sizeof(T));
+				v.reserve(i + c.count);
+				v.resize(i + c.count);
+				in.read(&v[i], c.bytes);
+				check_chunk(c, &v[i]);
+			}
+			read_end_marker(in);
+		}
+
+		// Vector<bool>의 워드 배열을 읽는다. bits는 헤더의 비트 수이고 워드도 확인한 덩어리만큼만 늘린다
+		template <class Alloc>
+		void	read_raw(InputSource &in, ft::Vector<bool, Alloc> &v, size_t bits)
+		{
+			typedef typename ft::Vector<bool, Alloc>::word_type	word_type;
+			size_t		n = words_for(bits);
+			size_t		end;
+			ChunkHeader	c;
+
+			for (size_t i = 0; i < n; i += c.count)
+			{
+				c = read_raw_chunk_header(in, n - i, sizeof(word_type));
+				end = (i + c.count) * WORD_BITS;
+				v.resize(end < bits ? end : bits);
+				in.read(v.words() + i, c.bytes);
+				check_chunk(c, v.words() + i);
+			}
+			if (n && (v.words()[n - 1] & ~tail_mask(bits)))
+				throw serialize_error("bits set past the end");
+			read_end_marker(in);
+		}
+
+		// Map::assign_sorted에 원소를 하나씩 넘기며 키가 증가하는지 확인한다
+		template <class Map>
+		class SortedMapReader
+		{
+		private:
+			typedef typename Map::value_type	value_type;
+			typedef typename Map::key_type		key_type;
+
+			ChunkReader					&_reader;
+			typename Map::key_compare	_comp;
+			key_type					_last;
+			bool						_first;
+
+		public:
+			SortedMapReader(ChunkReader &reader, const typename Map::key_compare &comp)
+				: _reader(reader), _comp(comp), _last(), _first(true)
+			{
+			}
+
+			value_type	operator() ()
+			{
+				value_type	x;
+
+				_reader.begin_element();
+				Codec<value_type>::read(_reader, x);
+				if (!_first && !_comp(_last, x.first))
+					throw serialize_error("map keys are not sorted");
+				_last = x.first;
+				_first = false;
+				return (x);
+			}
+		};
+	}
+
+	// Vector, List, Map을 OutputSink(fd나 ostream)에 쓴다
+	// 실패하면 serialize_error를 던진다. 그때까지 쓴 내용은 남는다
+
+	template <class T, class Alloc>
+	void	serialize(const ft::Vector<T, Alloc> &v, OutputSink out)
+	{
+		detail::write_header(out, detail::CONTAINER_VECTOR, Codec<T>::trivial, sizeof(T), v.size());
+		if (Codec<T>::trivial)
+			detail::write_raw(out, v.empty() ? 0 : &v[0], v.size());
+		else
+			detail::write_elements(out, v.begin(), v.end());
+	}
+
+	// 비트를 담은 워드 배열을 그대로 쓴다. 헤더의 원소 수는 비트 수다
+	template <class Alloc>
+	void	serialize(const ft::Vector<bool, Alloc> &v, OutputSink out)
+	{
+		typedef typename ft::Vector<bool, Alloc>::word_type	word_type;
+
+		detail::write_header(out, detail::CONTAINER_BIT_VECTOR, true, sizeof(word_type), v.size());
+		detail::write_raw(out, v.words(), v.word_size());
+	}
+
+	template <class T, class Alloc>
+	void	serialize(const ft::List<T, Alloc> &l, OutputSink out)
+	{
+		detail::write_header(out, detail::CONTAINER_LIST, Codec<T>::trivial, sizeof(T), l.size());
+		detail::write_elements(out, l.begin(), l.end());
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	void	serialize(const ft::Map<Key, T, Compare, Alloc> &m, OutputSink out)
+	{
+		typedef typename ft::Map<Key, T, Compare, Alloc>::value_type	value_type;
+
+		detail::write_header(out, detail::CONTAINER_MAP, Codec<value_type>::trivial, sizeof(value_type), m.size());
+		detail::write_elements(out, m.begin(), m.end());
+	}
+
+	// serialize로 쓴 내용을 읽어 컨테이너의 내용을 바꾼다
+	// 임시 컨테이너에 다 읽은 뒤 swap하므로, 형식이 맞지 않거나 체크섬이 틀려 serialize_error를
+	// 던지면 컨테이너는 그대로다
+
+	template <class T, class Alloc>
+	void	deserialize(ft::Vector<T, Alloc> &v, InputSource in)
+	{
+		ft::Vector<T, Alloc>	tmp;
+		size_t					n;
+
+		n = detail::read_header(in, detail::CONTAINER_VECTOR, Codec<T>::trivial, sizeof(T));
+		if (Codec<T>::trivial)
+			detail::read_raw(in, tmp, n);
+		else
+		{
+			ChunkReader	reader(in);
+			T			x;
+
+			for (size_t i = 0; i < n; ++i)
+			{
+				reader.begin_element();
+				Codec<T>::read(reader, x);
+				tmp.push_back(x);
+			}
+			reader.finish();
+		}
+		v.swap(tmp);
+	}
+
+	template <class Alloc>
+	void	deserialize(ft::Vector<bool, Alloc> &v, InputSource in)
+	{
+		typedef typename ft::Vector<bool, Alloc>::word_type	word_type;
+		ft::Vector<bool, Alloc>	tmp;
+		size_t					n;
+
+		n = detail::read_header(in, detail::CONTAINER_BIT_VECTOR, true, sizeof(word_type));
+		detail::read_raw(in, tmp, n);
+		v.swap(tmp);
+	}
+
+	template <class T, class Alloc>
+	void	deserialize(ft::List<T, Alloc> &l, InputSource in)
+	{
+		ft::List<T, Alloc>	tmp(l.get_allocator());
+		size_t				n;
+
+		n = detail::read_header(in, detail::CONTAINER_LIST, Codec<T>::trivial, sizeof(T));
+		ChunkReader	reader(in);
+		T			x;
+
+		for (size_t i = 0; i < n; ++i)
+		{
+			reader.begin_element();
+			Codec<T>::read(reader, x);
+			tmp.push_back(x);
+		}
+		reader.finish();
+		l.swap(tmp);
+	}
+
+	// 정렬된 순서로 저장돼 있으므로 삽입 대신 Map::assign_sorted로 O(n)에 쌓는다
+	template <class Key, class T, class Compare, class Alloc>
+	void	deserialize(ft::Map<Key, T, Compare, Alloc> &m, InputSource in)
+	{
+		typedef ft::Map<Key, T, Compare, Alloc>		map_type;
+		typedef typename map_type::value_type		value_type;
+		map_type	tmp(m.key_comp(), m.get_allocator());
+		size_t		n;
+
+		n = detail::read_header(in, detail::CONTAINER_MAP, Codec<value_type>::trivial, sizeof(value_type));
+		ChunkReader								reader(in);
+		detail::SortedMapReader<map_type>		gen(reader, tmp.key_comp());
+
+		tmp.assign_sorted(n, gen);
+		reader.finish();
+		m.swap(tmp);
+	}
+}
+
+#endif
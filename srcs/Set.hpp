@@ -0,0 +1,188 @@
+#ifndef SET_HPP
+# define SET_HPP
+
+# include <memory>
+# include "RbTree.hpp"
+# include "utils.hpp"
+
+namespace ft
+{
+	// 키가 곧 값인 정렬된 집합, RbTree 위에 만든다.
+	template < class T, class Compare = ft::less<T>, class Alloc = std::allocator<T> >
+	class Set
+	{
+	public:
+		typedef T											key_type;
+		typedef T											value_type;
+		typedef Compare										key_compare;
+		typedef Compare										value_compare;
+
+		typedef Alloc										allocator_type;
+		typedef typename allocator_type::reference			reference;
+		typedef typename allocator_type::const_reference	const_reference;
+		typedef typename allocator_type::pointer			pointer;
+		typedef typename allocator_type::const_pointer		const_pointer;
+		typedef MapIterator<value_type>						iterator;
+		typedef const MapIterator<value_type>				const_iterator;
+		typedef ReverseMapIterator<value_type>				reverse_iterator;
+		typedef const ReverseMapIterator<value_type>		const_reverse_iterator;
+		typedef ptrdiff_t									difference_type;
+		typedef size_t										size_type;
+
+	private:
+		typedef ft::RbTree<key_type, value_type, ft::Identity<value_type>, key_compare, allocator_type>	tree_type;
+
+		tree_type				_tree;
+
+	public:
+		explicit Set(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type())
+			: _tree(comp, alloc)
+		{
+		}
+
+		template <class InputIterator>
+		Set(InputIterator first, InputIterator last, const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type())
+			: _tree(comp, alloc)
+		{
+			insert(first, last);
+		}
+
+		Set(const Set &copy) : _tree(copy._tree)
+		{
+		}
+
+		~Set()
+		{
+		}
+
+		Set	&operator=(const Set &x)
+		{
+			_tree = x._tree;
+			return (*this);
+		}
+
+		iterator				begin()
+		{ return (_tree.begin()); }
+
+		const_iterator			begin() const
+		{ return (_tree.begin()); }
+
+		iterator				end()
+		{ return (_tree.end()); }
+
+		const_iterator			end() const
+		{ return (_tree.end()); }
+
+		reverse_iterator		rbegin()
+		{ return (_tree.rbegin()); }
+
+		const_reverse_iterator	rbegin() const
+		{ return (_tree.rbegin()); }
+
+		reverse_iterator		rend()
+		{ return (_tree.rend()); }
+
+		const_reverse_iterator	rend() const
+		{ return (_tree.rend()); }
+
+		bool		empty() const
+		{ return (_tree.empty()); }
+
+		size_type	size() const
+		{ return (_tree.size()); }
+
+		size_type	max_size() const
+		{ return (_tree.max_size()); }
+
+		ft::Pair<iterator, bool>	insert(const value_type &val)
+		{
+			return (_tree.insert_unique(val));
+		}
+
+		iterator	insert(iterator position, const value_type &val)
+		{
+			return (_tree.insert_unique(position, val));
+		}
+
+		template <class InputIterator>
+		void		insert(InputIterator first, InputIterator last)
+		{
+			while (first != last)
+			{
+				_tree.insert_unique(*first);
+				++first;
+			}
+		}
+
+		void		erase(iterator position)
+		{
+			_tree.erase(position);
+		}
+
+		size_type	erase(const key_type &k)
+		{
+			return (_tree.erase_key(k));
+		}
+
+		void		erase(iterator first, iterator last)
+		{
+			_tree.erase(first, last);
+		}
+
+		void		swap(Set &x)
+		{
+			_tree.swap(x._tree);
+		}
+
+		void		clear()
+		{
+			_tree.clear();
+		}
+
+		key_compare		key_comp() const
+		{
+			return (_tree.key_comp());
+		}
+
+		value_compare value_comp() const
+		{
+			return (_tree.key_comp());
+		}
+
+		iterator		find(const key_type &k)
+		{ return (_tree.find(k)); }
+
+		const_iterator	find(const key_type &k) const
+		{ return (_tree.find(k)); }
+
+		size_type		count(const key_type &k) const
+		{
+			return (_tree.find(k)._element != 0 ? 1 : 0);
+		}
+
+		iterator		lower_bound(const key_type &k)
+		{ return (_tree.lower_bound(k)); }
+
+		const_iterator	lower_bound(const key_type &k) const
+		{ return (_tree.lower_bound(k)); }
+
+		iterator		upper_bound(const key_type &k)
+		{ return (_tree.upper_bound(k)); }
+
+		const_iterator	upper_bound(const key_type &k) const
+		{ return (_tree.upper_bound(k)); }
+
+		ft::Pair<iterator, iterator>				equal_range(const key_type &k)
+		{ return (_tree.equal_range(k)); }
+
+		ft::Pair<const_iterator, const_iterator>	equal_range(const key_type &k) const
+		{ return (_tree.equal_range(k)); }
+
+		allocator_type	get_allocator() const
+		{
+			return (_tree.get_allocator());
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,514 @@
+#ifndef SKIP_LIST_MAP_HPP
+# define SKIP_LIST_MAP_HPP
+
+# include <memory>
+# include <cstddef>
+# include "Epoch.hpp"
+# include "Iterator.hpp"
+# include "utils.hpp"
+
+namespace ft
+{
+	// 잠금 없는 스킵 리스트 맵
+	// 여러 스레드가 동시에 넣고 지우고 찾을 수 있다. 넣기와 지우기는 CAS로만 노드를 잇고 떼며,
+	// 찾기와 순회는 아무것도 쓰지 않고 포인터만 따라간다.
+	//
+	// 지우기는 두 단계다. 먼저 노드의 next 포인터 맨 아래 비트를 세워(위 레벨부터 0레벨까지) 논리적으로
+	// 지우고, 그다음 탐색이 지나가다 표시된 노드를 앞 노드에서 떼어낸다. 표시된 next는 CAS로 바꿀 수
+	// 없으므로 지워지는 노드 뒤에 새 노드가 붙지 않는다. 떼어낸 노드는 EpochDomain에 넘겨서 그 노드를
+	// 보고 있을 수 있는 읽기 구간이 모두 끝난 뒤에 해제한다.
+	//
+	// 값은 넣은 뒤 바꾸지 않는다(바꾸려면 지우고 다시 넣는다). 순회는 약한 일관성을 가진다:
+	// 순회를 시작할 때부터 끝날 때까지 있던 원소는 모두 키 순서대로 한 번씩 보이고, 그사이 넣거나
+	// 지운 원소는 보일 수도 안 보일 수도 있다.
+	template < class Key, class T, class Compare = ft::less<Key>, class Alloc = std::allocator<ft::Pair<Key, T> > >
+	class SkipListMap
+	{
+	public:
+		typedef Key												key_type;
+		typedef T												mapped_type;
+		typedef ft::Pair<key_type, mapped_type>					value_type;
+		typedef Compare											key_compare;
+		typedef Alloc											allocator_type;
+		typedef size_t											size_type;
+
+		// 레벨이 하나 오를 때마다 노드 수가 1/4로 준다. 16레벨이면 40억 개까지 O(log n)
+		enum { MAX_LEVEL = 16 };
+
+	private:
+		struct Node
+		{
+			value_type	val;
+			int			height;
+			// 아직 이 노드를 다루는 쪽(넣는 스레드, 지우는 스레드) 수, 0이 되면 회수한다
+			int			owners;
+			// height개, 맨 아래 비트는 지워짐 표시
+			Node		*next[1];
+		};
+
+		typedef typename allocator_type::template rebind<char>::other		byte_allocator;
+
+	public:
+		// 전진만 하는 이터레이터. 살아 있는 동안 만든 스레드의 읽기 구간을 열어 두므로
+		// 다른 스레드로 넘기지 않는다. 오래 들고 있으면 그동안 지운 노드가 회수되지 않는다
+		class iterator
+		{
+		public:
+			typedef forward_iterator_tag				iterator_category;
+			typedef typename SkipListMap::value_type	value_type;
+			typedef ptrdiff_t							difference_type;
+			typedef const value_type*					pointer;
+			typedef const value_type&					reference;
+
+		private:
+			Node			*_node;
+			EpochDomain		*_domain;
+
+		public:
+			iterator() : _node(0), _domain(0) {}
+
+			iterator(Node *node, EpochDomain *domain) : _node(node), _domain(domain)
+			{
+				if (_node)
+					_domain->enter();
+			}
+
+			iterator(const iterator &x) : _node(x._node), _domain(x._domain)
+			{
+				if (_node)
+					_domain->enter();
+			}
+
+			~iterator()
+			{
+				if (_node)
+					_domain->exit();
+			}
+
+			iterator	&operator= (const iterator &x)
+			{
+				if (x._node)
+					x._domain->enter();
+				if (_node)
+					_domain->exit();
+				_node = x._node;
+				_domain = x._domain;
+				return (*this);
+			}
+
+			reference	operator* () const
+			{ return (_node->val); }
+
+			pointer		operator-> () const
+			{ return (&_node->val); }
+
+			iterator	&operator++ ()
+			{
+				_node = next_live(_node);
+				if (!_node)
+					_domain->exit();
+				return (*this);
+			}
+
+			iterator	operator++ (int)
+			{ iterator	tmp(*this); ++*this; return (tmp); }
+
+			bool		operator== (const iterator &x) const
+			{ return (_node == x._node); }
+			bool		operator!= (const iterator &x) const
+			{ return (_node != x._node); }
+		};
+
+		typedef iterator										const_iterator;
+
+	private:
+		EpochDomain			&_domain;
+		key_compare			_comp;
+		allocator_type		_allocator;
+		byte_allocator		_bytes;
+		Node				*_head;
+		size_type			_size;
+		unsigned long		_seed;
+
+	public:
+		explicit SkipListMap(EpochDomain &domain = EpochDomain::global(), const key_compare &comp = key_compare(),
+							const allocator_type &alloc = allocator_type())
+			: _domain(domain), _comp(comp), _allocator(alloc), _bytes(alloc), _size(0), _seed(0)
+		{
+			// 머리 노드의 val은 만들지 않는다
+			_head = reinterpret_cast<Node *>(_bytes.allocate(node_bytes(MAX_LEVEL)));
+			_head->height = MAX_LEVEL;
+			for (int i = 0; i < MAX_LEVEL; ++i)
+				_head->next[i] = 0;
+		}
+
+		// 이 맵을 쓰는 스레드가 없어야 한다. 넘겨둔 노드가 모두 지워질 때까지 기다린다
+		~SkipListMap()
+		{
+			Node	*node;
+			Node	*next;
+
+			_domain.synchronize();
+			node = _head->next[0];
+			while (node)
+			{
+				next = unmarked(node->next[0]);
+				free_node(node);
+				node = next;
+			}
+			_bytes.deallocate(reinterpret_cast<char *>(_head), node_bytes(MAX_LEVEL));
+		}
+
+		iterator		begin() const
+		{
+			EpochGuard	guard(_domain);
+
+			return (iterator(next_live(_head), &_domain));
+		}
+
+		iterator		end() const
+		{ return (iterator()); }
+
+		// 동시에 넣고 지우는 중이면 그 순간의 근삿값
+		size_type		size() const
+		{ return (__atomic_load_n(&_size, __ATOMIC_RELAXED)); }
+
+		bool			empty() const
+		{ return (size() == 0); }
+
+		size_type		max_size() const
+		{ return (_bytes.max_size() / node_bytes(MAX_LEVEL)); }
+
+		// 같은 키가 있으면 넣지 않고 그 원소와 false를 반환
+		ft::Pair<iterator, bool>	insert(const value_type &val)
+		{
+			EpochGuard	guard(_domain);
+			Node		*preds[MAX_LEVEL];
+			Node		*succs[MAX_LEVEL];
+			Node		*node = 0;
+
+			while (true)
+			{
+				if (search(val.first, preds, succs))
+				{
+					if (node)
+						free_node(node);
+					return (ft::Pair<iterator, bool>(iterator(succs[0], &_domain), false));
+				}
+				if (!node)
+					node = new_node(val, random_height());
+				for (int i = 0; i < node->height; ++i)
+					node->next[i] = succs[i];
+				// 0레벨에 붙는 순간 원소가 보이기 시작한다
+				if (cas(&preds[0]->next[0], succs[0], node))
+					break ;
+			}
+			__atomic_add_fetch(&_size, 1, __ATOMIC_RELAXED);
+			link_upper(node, preds, succs);
+
+			ft::Pair<iterator, bool>	ret(iterator(node, &_domain), true);
+
+			release(node);
+			return (ret);
+		}
+
+		template <class InputIterator>
+		void			insert(InputIterator first, InputIterator last)
+		{
+			for (; first != last; ++first)
+				insert(*first);
+		}
+
+		// 0레벨에 표시를 세운 스레드 하나만 1을 반환한다
+		size_type		erase(const key_type &k)
+		{
+			EpochGuard	guard(_domain);
+			Node		*preds[MAX_LEVEL];
+			Node		*succs[MAX_LEVEL];
+			Node		*node;
+			Node		*succ;
+
+			if (!search(k, preds, succs))
+				return (0);
+			node = succs[0];
+			for (int level = node->height - 1; level > 0; --level)
+			{
+				succ = load(&node->next[level]);
+				while (!is_marked(succ))
+				{
+					cas(&node->next[level], succ, marked(succ));
+					succ = load(&node->next[level]);
+				}
+			}
+			succ = load(&node->next[0]);
+			while (true)
+			{
+				if (is_marked(succ))
+					return (0);
+				if (cas(&node->next[0], succ, marked(succ)))
+					break ;
+				succ = load(&node->next[0]);
+			}
+			__atomic_sub_fetch(&_size, 1, __ATOMIC_RELAXED);
+			release(node);
+			return (1);
+		}
+
+		// 지금 보이는 원소를 하나씩 지운다. 그사이 들어온 원소는 남을 수 있다
+		void			clear()
+		{
+			EpochGuard	guard(_domain);
+
+			for (Node *node = next_live(_head); node; node = next_live(node))
+				erase(node->val.first);
+		}
+
+		iterator		find(const key_type &k) const
+		{
+			EpochGuard	guard(_domain);
+			Node		*node = lower_node(k);
+
+			if (!node || _comp(k, node->val.first))
+				return (end());
+			return (iterator(node, &_domain));
+		}
+
+		size_type		count(const key_type &k) const
+		{
+			EpochGuard	guard(_domain);
+			Node		*node = lower_node(k);
+
+			return (node && !_comp(k, node->val.first));
+		}
+
+		// k 이상인 첫 원소
+		iterator		lower_bound(const key_type &k) const
+		{
+			EpochGuard	guard(_domain);
+
+			return (iterator(lower_node(k), &_domain));
+		}
+
+		// k보다 큰 첫 원소
+		iterator		upper_bound(const key_type &k) const
+		{
+			EpochGuard	guard(_domain);
+
+			return (iterator(upper_node(k), &_domain));
+		}
+
+		ft::Pair<iterator, iterator>	equal_range(const key_type &k) const
+		{
+			return (ft::Pair<iterator, iterator>(lower_bound(k), upper_bound(k)));
+		}
+
+		key_compare		key_comp() const
+		{ return (_comp); }
+
+		allocator_type	get_allocator() const
+		{ return (_allocator); }
+
+		EpochDomain		&domain() const
+		{ return (_domain); }
+
+	private:
+		static bool		is_marked(Node *p)
+		{ return (reinterpret_cast<size_t>(p) & 1); }
+
+		static Node		*marked(Node *p)
+		{ return (reinterpret_cast<Node *>(reinterpret_cast<size_t>(p) | 1)); }
+
+		static Node		*unmarked(Node *p)
+		{ return (reinterpret_cast<Node *>(reinterpret_cast<size_t>(p) & ~static_cast<size_t>(1))); }
+
+		static Node		*load(Node *const *p)
+		{ return (__atomic_load_n(p, __ATOMIC_ACQUIRE)); }
+
+		static bool		cas(Node **p, Node *expected, Node *desired)
+		{
+			return (__atomic_compare_exchange_n(p, &expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_ACQUIRE));
+		}
+
+		// node 다음의 지워지지 않은 노드, 없으면 0
+		static Node		*next_live(Node *node)
+		{
+			node = unmarked(load(&node->next[0]));
+			while (node && is_marked(load(&node->next[0])))
+				node = unmarked(load(&node->next[0]));
+			return (node);
+		}
+
+		static size_t	node_bytes(int height)
+		{ return (sizeof(Node) + (height - 1) * sizeof(Node *)); }
+
+		Node			*new_node(const value_type &val, int height)
+		{
+			Node	*node = reinterpret_cast<Node *>(_bytes.allocate(node_bytes(height)));
+
+			try
+			{
+				_allocator.construct(&node->val, val);
+			}
+			catch (...)
+			{
+				_bytes.deallocate(reinterpret_cast<char *>(node), node_bytes(height));
+				throw ;
+			}
+			node->height = height;
+			node->owners = 2;
+			return (node);
+		}
+
+		void			free_node(Node *node)
+		{
+			_allocator.destroy(&node->val);
+			_bytes.deallocate(reinterpret_cast<char *>(node), node_bytes(node->height));
+		}
+
+		static void		retire_node(void *object, void *context)
+		{
+			static_cast<SkipListMap *>(context)->free_node(static_cast<Node *>(object));
+		}
+
+		// 레벨마다 1/4 확률로 한 층 더 올린다. 스레드마다 다른 값이 나오도록 공유 카운터를 섞는다
+		int				random_height()
+		{
+			unsigned long	x = __atomic_add_fetch(&_seed, 0x9e3779b97f4a7c15UL, __ATOMIC_RELAXED);
+			int				height = 1;
+
+			x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9UL;
+			x = (x ^ (x >> 27)) * 0x94d049bb133111ebUL;
+			x ^= x >> 31;
+			while (height < MAX_LEVEL && (x & 3) == 0)
+			{
+				++height;
+				x >>= 2;
+			}
+			return (height);
+		}
+
+		// 레벨마다 k 바로 앞 노드(preds)와 k 이상인 첫 노드(succs)를 구한다. 지나가며 표시된 노드를 떼어낸다
+		// succs[0]의 키가 k이면 true. 읽기 구간 안에서 부른다
+		bool			search(const key_type &k, Node **preds, Node **succs)
+		{
+			while (!try_search(k, preds, succs))
+				;
+			return (succs[0] && !_comp(k, succs[0]->val.first));
+		}
+
+		// 앞 노드도 지워지는 중이어서 떼어내기에 실패하면 false, 처음부터 다시 찾는다
+		bool			try_search(const key_type &k, Node **preds, Node **succs)
+		{
+			Node	*pred = _head;
+			Node	*curr;
+			Node	*succ;
+
+			for (int level = MAX_LEVEL - 1; level >= 0; --level)
+			{
+				curr = unmarked(load(&pred->next[level]));
+				while (curr)
+				{
+					succ = load(&curr->next[level]);
+					if (is_marked(succ))
+					{
+						if (!cas(&pred->next[level], curr, unmarked(succ)))
+							return (false);
+						curr = unmarked(succ);
+						continue ;
+					}
+					if (!_comp(curr->val.first, k))
+						break ;
+					pred = curr;
+					curr = succ;
+				}
+				preds[level] = pred;
+				succs[level] = curr;
+			}
+			return (true);
+		}
+
+		// 0레벨에 붙은 node를 위 레벨에도 잇는다. 그사이 지워지기 시작하면 그만둔다
+		void			link_upper(Node *node, Node **preds, Node **succs)
+		{
+			Node	*old;
+
+			for (int level = 1; level < node->height; ++level)
+			{
+				while (true)
+				{
+					old = load(&node->next[level]);
+					if (is_marked(old))
+						return ;
+					// 자기 next도 CAS로 바꿔야 지우는 쪽이 세운 표시를 덮어쓰지 않는다
+					if (old != succs[level] && !cas(&node->next[level], old, succs[level]))
+						continue ;
+					if (cas(&preds[level]->next[level], succs[level], node))
+						break ;
+					search(node->val.first, preds, succs);
+					if (succs[0] != node)
+						return ;
+				}
+			}
+		}
+
+		// 넣는 쪽과 지우는 쪽이 각각 일을 마치고 부른다. 노드가 지워졌으면 다시 찾아서 모든 레벨에서
+		// 떼어낸다. 넣는 쪽이 표시 뒤에 위 레벨에 이었더라도 여기서 떼므로, 둘 다 부른 뒤에는
+		// 노드가 어디에도 이어져 있지 않다
+		void			release(Node *node)
+		{
+			Node	*preds[MAX_LEVEL];
+			Node	*succs[MAX_LEVEL];
+
+			__atomic_thread_fence(__ATOMIC_SEQ_CST);
+			if (is_marked(load(&node->next[0])))
+				search(node->val.first, preds, succs);
+			if (__atomic_sub_fetch(&node->owners, 1, __ATOMIC_ACQ_REL) == 0)
+				_domain.retire(node, retire_node, this);
+		}
+
+		// k 이상인 첫 살아 있는 노드. 아무것도 쓰지 않고 지워진 노드도 그대로 지나간다
+		Node			*lower_node(const key_type &k) const
+		{
+			Node	*pred = _head;
+			Node	*curr = 0;
+
+			for (int level = MAX_LEVEL - 1; level >= 0; --level)
+			{
+				curr = unmarked(load(&pred->next[level]));
+				while (curr && _comp(curr->val.first, k))
+				{
+					pred = curr;
+					curr = unmarked(load(&curr->next[level]));
+				}
+			}
+			while (curr && is_marked(load(&curr->next[0])))
+				curr = unmarked(load(&curr->next[0]));
+			return (curr);
+		}
+
+		// k보다 큰 첫 살아 있는 노드
+		Node			*upper_node(const key_type &k) const
+		{
+			Node	*pred = _head;
+			Node	*curr = 0;
+
+			for (int level = MAX_LEVEL - 1; level >= 0; --level)
+			{
+				curr = unmarked(load(&pred->next[level]));
+				while (curr && !_comp(k, curr->val.first))
+				{
+					pred = curr;
+					curr = unmarked(load(&curr->next[level]));
+				}
+			}
+			while (curr && is_marked(load(&curr->next[0])))
+				curr = unmarked(load(&curr->next[0]));
+			return (curr);
+		}
+
+		SkipListMap(const SkipListMap &);
+		SkipListMap	&operator=(const SkipListMap &);
+	};
+}
+
+#endif
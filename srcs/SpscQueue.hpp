@@ -0,0 +1,201 @@
+#ifndef SPSC_QUEUE_HPP
+# define SPSC_QUEUE_HPP
+
+# include <memory>
+# include <cstddef>
+# include <sched.h>
+
+namespace ft
+{
+	// 생산자 하나, 소비자 하나 사이의 lock-free 링 버퍼 큐
+	// push 계열은 생산자 스레드만, front/pop 계열은 소비자 스레드만 호출해야 한다.
+	// 용량은 2의 거듭제곱으로 올림하고, 인덱스는 계속 증가시키면서 (index & _mask)로 칸을 찾는다.
+	// _head는 소비자만, _tail은 생산자만 쓰고 서로의 값은 acquire로 읽는다.
+	// 두 인덱스가 같은 캐시 라인에 있으면 한쪽이 쓸 때마다 다른 쪽 캐시가 무효화되므로 캐시 라인 단위로 떨어뜨린다.
+	// 객체가 캐시 라인에 맞춰 놓인다는 보장이 없으므로 (new는 16바이트 정렬) 각 쌍의 앞뒤에 라인 하나씩을 통째로 비운다.
+	template <class T, class Alloc = std::allocator<T> >
+	class SpscQueue
+	{
+	public:
+		typedef T								value_type;
+		typedef Alloc							allocator_type;
+		typedef size_t							size_type;
+
+		enum { CACHE_LINE = 64 };
+
+	private:
+		// 객체 앞에 있는 다른 데이터와 떨어뜨린다
+		char			_pad0[CACHE_LINE];
+		// 생산자 쪽: _tail과 생산자가 마지막으로 본 _head
+		size_type		_tail;
+		size_type		_cached_head;
+		char			_pad1[CACHE_LINE];
+		// 소비자 쪽: _head와 소비자가 마지막으로 본 _tail
+		size_type		_head;
+		size_type		_cached_tail;
+		char			_pad2[CACHE_LINE];
+		// 둘 다 읽기만 하는 값
+		allocator_type	_allocator;
+		T*				_buffer;
+		size_type		_capacity;
+		size_type		_mask;
+
+	public:
+		explicit SpscQueue(size_type capacity, const allocator_type &alloc = allocator_type())
+			: _tail(0), _cached_head(0), _head(0), _cached_tail(0), _allocator(alloc)
+		{
+			_capacity = 1;
+			while (_capacity < capacity)
+				_capacity <<= 1;
+			_mask = _capacity - 1;
+			_buffer = _allocator.allocate(_capacity);
+		}
+
+		~SpscQueue()
+		{
+			while (!empty())
+				pop();
+			_allocator.deallocate(_buffer, _capacity);
+		}
+
+		size_type		capacity() const
+		{
+			return (_capacity);
+		}
+
+		// 다른 스레드가 동시에 바꾸고 있으면 근삿값
+		size_type		size() const
+		{
+			size_type	tail;
+			size_type	head;
+
+			tail = __atomic_load_n(&_tail, __ATOMIC_ACQUIRE);
+			head = __atomic_load_n(&_head, __ATOMIC_ACQUIRE);
+			return (tail - head);
+		}
+
+		bool			empty() const
+		{
+			return (size() == 0);
+		}
+
+		// 가득 차 있으면 false
+		bool			try_push(const value_type &val)
+		{
+			size_type	tail;
+
+			tail = _tail;
+			if (tail - _cached_head == _capacity)
+			{
+				_cached_head = __atomic_load_n(&_head, __ATOMIC_ACQUIRE);
+				if (tail - _cached_head == _capacity)
+					return (false);
+			}
+			_allocator.construct(_buffer + (tail & _mask), val);
+			__atomic_store_n(&_tail, tail + 1, __ATOMIC_RELEASE);
+			return (true);
+		}
+
+		// 자리가 날 때까지 기다린다
+		void			push(const value_type &val)
+		{
+			while (!try_push(val))
+				sched_yield();
+		}
+
+		// 들어간 만큼만 넣고 그 개수를 반환, 꼬리는 마지막에 한 번만 발행한다
+		size_type		push_n(const value_type *vals, size_type n)
+		{
+			size_type	tail;
+			size_type	room;
+
+			tail = _tail;
+			room = _capacity - (tail - _cached_head);
+			if (room < n)
+			{
+				_cached_head = __atomic_load_n(&_head, __ATOMIC_ACQUIRE);
+				room = _capacity - (tail - _cached_head);
+			}
+			if (n > room)
+				n = room;
+			for (size_type i = 0; i < n; ++i)
+				_allocator.construct(_buffer + ((tail + i) & _mask), vals[i]);
+			if (n)
+				__atomic_store_n(&_tail, tail + n, __ATOMIC_RELEASE);
+			return (n);
+		}
+
+		// empty()로 비어 있지 않은 것을 확인한 뒤에만 호출 (empty()의 acquire가 원소를 보이게 한다)
+		value_type		&front()
+		{
+			return (_buffer[_head & _mask]);
+		}
+
+		const value_type	&front() const
+		{
+			return (_buffer[_head & _mask]);
+		}
+
+		// 비어 있지 않을 때만 호출
+		void			pop()
+		{
+			size_type	head;
+
+			head = _head;
+			// try_pop/pop_n이 쓰는 _cached_tail이 _head보다 뒤처지지 않게 한다
+			if (head == _cached_tail)
+				_cached_tail = __atomic_load_n(&_tail, __ATOMIC_ACQUIRE);
+			_allocator.destroy(_buffer + (head & _mask));
+			__atomic_store_n(&_head, head + 1, __ATOMIC_RELEASE);
+		}
+
+		// 비어 있으면 false
+		bool			try_pop(value_type &out)
+		{
+			size_type	head;
+
+			head = _head;
+			if (head == _cached_tail)
+			{
+				_cached_tail = __atomic_load_n(&_tail, __ATOMIC_ACQUIRE);
+				if (head == _cached_tail)
+					return (false);
+			}
+			out = _buffer[head & _mask];
+			_allocator.destroy(_buffer + (head & _mask));
+			__atomic_store_n(&_head, head + 1, __ATOMIC_RELEASE);
+			return (true);
+		}
+
+		// 꺼낸 만큼의 개수를 반환
+		size_type		pop_n(value_type *out, size_type n)
+		{
+			size_type	head;
+			size_type	avail;
+
+			head = _head;
+			avail = _cached_tail - head;
+			if (avail < n)
+			{
+				_cached_tail = __atomic_load_n(&_tail, __ATOMIC_ACQUIRE);
+				avail = _cached_tail - head;
+			}
+			if (n > avail)
+				n = avail;
+			for (size_type i = 0; i < n; ++i)
+			{
+				out[i] = _buffer[(head + i) & _mask];
+				_allocator.destroy(_buffer + ((head + i) & _mask));
+			}
+			if (n)
+				__atomic_store_n(&_head, head + n, __ATOMIC_RELEASE);
+			return (n);
+		}
+
+	private:
+		SpscQueue(const SpscQueue &);
+		SpscQueue	&operator=(const SpscQueue &);
+	};
+}
+
+#endif
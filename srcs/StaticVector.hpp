@@ -0,0 +1,417 @@
+#ifndef STATIC_VECTOR_HPP
+# define STATIC_VECTOR_HPP
+
+# include <cstddef>
+# include <new>
+# include <stdexcept>
+# include "utils.hpp"
+# include "VectorIterator.hpp"
+# include "ReverseVectorIterator.hpp"
+
+namespace ft
+{
+	namespace detail
+	{
+		// 원소 수를 담을 가장 작은 부호 없는 타입
+		template <size_t N, bool Byte = (N < 256), bool Short = (N < 65536)>
+		struct static_vector_count
+		{ typedef size_t type; };
+
+		template <size_t N>
+		struct static_vector_count<N, true, true>
+		{ typedef unsigned char type; };
+
+		template <size_t N>
+		struct static_vector_count<N, false, true>
+		{ typedef unsigned short type; };
+	}
+
+	// 원소를 N개까지 객체 안에 담는 Vector. 힙을 쓰지 않으므로 지역 변수로 두면 통째로 스택에 있다
+	// 용량은 언제나 N이고 넘치게 넣으려 하면 아무것도 바꾸지 않고 std::length_error를 던진다.
+	// 원소 수는 N에 맞는 가장 작은 타입(N < 256이면 unsigned char)에 담는다.
+	//
+	// 이터레이터와 참조는 그 자리 뒤로 원소가 밀리거나 당겨질 때만 무효가 된다 (재할당이 없다).
+	// swap과 복사는 원소를 하나씩 옮기므로 O(N)이다.
+	// Stack, Queue의 Container로 쓸 수 있다. Queue::pop은 erase(begin())이라 원소를 당기지만
+	// N이 작으면 할당 한 번보다 싸다.
+	template <typename T, size_t N>
+	class StaticVector
+	{
+	public:
+		typedef T									value_type;
+		typedef T&									reference;
+		typedef const T&							const_reference;
+		typedef T*									pointer;
+		typedef const T*							const_pointer;
+		typedef VectorIterator<T>					iterator;
+		typedef const VectorIterator<T>				const_iterator;
+		typedef ReverseVectorIterator<T>			reverse_iterator;
+		typedef const ReverseVectorIterator<T>		const_reverse_iterator;
+		typedef ptrdiff_t							difference_type;
+		typedef size_t								size_type;
+
+		static const size_type	static_capacity = N;
+
+	private:
+		typedef char	capacity_must_be_positive[N > 0 ? 1 : -1];
+
+		union Storage
+		{
+			char		bytes[N * sizeof(T)];
+			long double	ld;
+			void		*p;
+			long long	ll;
+		};
+
+		Storage										_storage;
+		typename detail::static_vector_count<N>::type	_size;
+
+	public:
+		StaticVector() : _size(0)
+		{
+		}
+
+		explicit StaticVector(size_type n, const value_type &val = value_type()) : _size(0)
+		{
+			assign(n, val);
+		}
+
+		template <typename InputIterator>
+		StaticVector(InputIterator first, InputIterator last) : _size(0)
+		{
+			assign(first, last);
+		}
+
+		StaticVector(const StaticVector &copy) : _size(0)
+		{
+			for (size_type i = 0; i < copy.size(); ++i)
+				push_back(copy[i]);
+		}
+
+		~StaticVector()
+		{
+			clear();
+		}
+
+		StaticVector		&operator=(const StaticVector &copy)
+		{
+			size_type	common = size() < copy.size() ? size() : copy.size();
+
+			if (this == &copy)
+				return (*this);
+			for (size_type i = 0; i < common; ++i)
+				at_(i) = copy[i];
+			while (size() > copy.size())
+				pop_back();
+			for (size_type i = common; i < copy.size(); ++i)
+				push_back(copy[i]);
+			return (*this);
+		}
+
+		iterator			begin()
+		{ return (ptr()); }
+		const_iterator		begin() const
+		{ return (ptr()); }
+		iterator			end()
+		{ return (ptr() + _size); }
+		const_iterator		end() const
+		{ return (ptr() + _size); }
+		reverse_iterator	rbegin()
+		{ return (ptr() + _size - 1); }
+		const_reverse_iterator rbegin() const
+		{ return (ptr() + _size - 1); }
+		reverse_iterator	rend()
+		{ return (ptr() - 1); }
+		const_reverse_iterator rend() const
+		{ return (ptr() - 1); }
+
+		size_type			size() const
+		{ return (_size); }
+
+		size_type			max_size() const
+		{ return (N); }
+
+		size_type			capacity() const
+		{ return (N); }
+
+		bool				empty() const
+		{ return (_size == 0); }
+
+		bool				full() const
+		{ return (_size == N); }
+
+		// 용량이 바뀌지 않으므로 n이 N보다 큰지만 본다
+		void				reserve(size_type n)
+		{
+			check(n);
+		}
+
+		void				resize(size_type n, value_type val = value_type())
+		{
+			check(n);
+			while (_size > n)
+				pop_back();
+			while (_size < n)
+				push_back(val);
+		}
+
+		reference			operator[](size_type n)
+		{ return (at_(n)); }
+		const_reference		operator[](size_type n) const
+		{ return (ptr()[n]); }
+
+		reference			at(size_type n)
+		{
+			if (n >= _size)
+				throw (std::out_of_range("_M_range_check"));
+			return (at_(n));
+		}
+
+		const_reference		at(size_type n) const
+		{
+			if (n >= _size)
+				throw (std::out_of_range("_M_range_check"));
+			return (ptr()[n]);
+		}
+
+		reference			front()
+		{
+			if (empty())
+				throw (std::out_of_range("empty"));
+			return (at_(0));
+		}
+
+		const_reference		front() const
+		{
+			if (empty())
+				throw (std::out_of_range("empty"));
+			return (ptr()[0]);
+		}
+
+		reference			back()
+		{
+			if (empty())
+				throw (std::out_of_range("empty"));
+			return (at_(_size - 1));
+		}
+
+		const_reference		back() const
+		{
+			if (empty())
+				throw (std::out_of_range("empty"));
+			return (ptr()[_size - 1]);
+		}
+
+		pointer				data()
+		{ return (ptr()); }
+		const_pointer		data() const
+		{ return (ptr()); }
+
+		// 구간을 먼저 다른 StaticVector에 받아 두므로 넘쳐서 던질 때 내용이 그대로다
+		template <typename InputIterator>
+		void				assign(InputIterator first, InputIterator last)
+		{
+			StaticVector	staged;
+
+			staged.insert_range(staged.end(), first, last);
+			*this = staged;
+		}
+
+		void				assign(size_type n, const value_type &val)
+		{
+			value_type	copy = val;
+
+			check(n);
+			clear();
+			while (_size < n)
+				push_back(copy);
+		}
+
+		void				push_back(const value_type &value)
+		{
+			check(_size + 1);
+			construct(_size, value);
+			++_size;
+		}
+
+		void				pop_back()
+		{
+			if (_size > 0)
+			{
+				at_(_size - 1).~T();
+				--_size;
+			}
+		}
+
+		iterator			insert(iterator position, const value_type &val)
+		{
+			size_type	pos = position - begin();
+
+			open_gap(pos, 1, val);
+			return (ptr() + pos);
+		}
+
+		void				insert(iterator position, size_type n, const value_type &val)
+		{
+			open_gap(position - begin(), n, val);
+		}
+
+		template <class InputIterator>
+		void				insert(iterator position, InputIterator first, InputIterator last)
+		{
+			insert_range(position, first, last);
+		}
+
+		iterator			erase(iterator position)
+		{
+			return (erase(position, position + 1));
+		}
+
+		iterator			erase(iterator first, iterator last)
+		{
+			size_type	lo = first - begin();
+			size_type	hi = last - begin();
+			size_type	n = _size;
+
+			for (size_type i = hi; i < n; ++i)
+				at_(lo + i - hi) = at_(i);
+			while (_size > n - (hi - lo))
+				pop_back();
+			return (ptr() + lo);
+		}
+
+		void				clear()
+		{
+			while (_size)
+				pop_back();
+		}
+
+		void				swap(StaticVector &x)
+		{
+			StaticVector	&shorter = _size < x._size ? *this : x;
+			StaticVector	&longer = _size < x._size ? x : *this;
+			size_type		common = shorter._size;
+
+			for (size_type i = 0; i < common; ++i)
+				ft::swap(shorter.at_(i), longer.at_(i));
+			for (size_type i = common; i < longer._size; ++i)
+				shorter.push_back(longer.at_(i));
+			while (longer._size > common)
+				longer.pop_back();
+		}
+
+		friend bool operator==(const StaticVector &lhs, const StaticVector &rhs)
+		{
+			if (lhs.size() == rhs.size())
+				return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+			else
+				return (false);
+		}
+
+		friend bool operator!=(const StaticVector &lhs, const StaticVector &rhs)
+		{ return (!(lhs == rhs)); }
+
+		friend bool operator<(const StaticVector &lhs, const StaticVector &rhs)
+		{ return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end())); }
+
+		friend bool operator<=(const StaticVector &lhs, const StaticVector &rhs)
+		{ return (!(rhs < lhs)); }
+
+		friend bool operator>(const StaticVector &lhs, const StaticVector &rhs)
+		{ return (rhs < lhs); }
+
+		friend bool operator>=(const StaticVector &lhs, const StaticVector &rhs)
+		{ return (!(lhs < rhs)); }
+
+	private:
+		// VectorIterator는 T*로만 만들 수 있어서 const 함수에서도 T*를 돌려준다
+		pointer				ptr() const
+		{ return (reinterpret_cast<pointer>(const_cast<char *>(_storage.bytes))); }
+
+		reference			at_(size_type i)
+		{ return (ptr()[i]); }
+
+		void				check(size_type n) const
+		{
+			if (n > N)
+				throw (std::length_error("ft::StaticVector: capacity exceeded"));
+		}
+
+		// 원소 수는 부르는 쪽이 고친다
+		void				construct(size_type i, const value_type &val)
+		{
+			new (static_cast<void *>(ptr() + i)) T(val);
+		}
+
+		// [pos, pos + n)을 비우고 val로 채운다. val이 벡터 안의 원소여도 된다
+		void				open_gap(size_type pos, size_type n, const value_type &val)
+		{
+			value_type	copy = val;
+			size_type	old = _size;
+
+			check(old + n);
+			if (n == 0)
+				return ;
+			shift_tail(pos, n);
+			for (size_type i = 0; i < n; ++i)
+				put(pos + i, old, copy);
+			_size = old + n;
+		}
+
+		// pos부터 끝까지를 n칸 뒤로 민다. 끝을 넘어가는 자리에는 복사해서 만들고, 원래 있던 자리에는 대입한다
+		void				shift_tail(size_type pos, size_type n)
+		{
+			size_type	old = _size;
+
+			for (size_type i = old; i > pos; --i)
+			{
+				if (i - 1 + n >= old)
+					construct(i - 1 + n, at_(i - 1));
+				else
+					at_(i - 1 + n) = at_(i - 1);
+			}
+		}
+
+		// shift_tail로 비운 자리 i에 val을 둔다. old는 밀기 전의 원소 수
+		void				put(size_type i, size_type old, const value_type &val)
+		{
+			if (i < old)
+				at_(i) = val;
+			else
+				construct(i, val);
+		}
+
+		// StaticVector<int, 8>(...).insert(pos, 10, 30)이 이터레이터 구간으로 들어오지 않게 한다
+		void				insert_range(iterator position, int n, int val)
+		{
+			open_gap(position - begin(), n, static_cast<value_type>(val));
+		}
+
+		// 입력 이터레이터는 길이를 미리 알 수 없으므로 구간을 먼저 staged에 받는다. 넘치면 아무것도
+		// 바꾸지 않고 던지고, 구간이 이 벡터 안을 가리켜도 된다. 원소는 한 번씩만 민다
+		template <typename InputIterator>
+		void				insert_range(iterator position, InputIterator first, InputIterator last)
+		{
+			size_type		pos = position - begin();
+			size_type		old = _size;
+			StaticVector	staged;
+
+			for (; first != last; ++first)
+			{
+				check(old + staged._size + 1);
+				staged.push_back(*first);
+			}
+			if (staged.empty())
+				return ;
+			shift_tail(pos, staged._size);
+			for (size_type i = 0; i < staged._size; ++i)
+				put(pos + i, old, staged.at_(i));
+			_size = old + staged._size;
+		}
+	};
+
+	template <typename T, size_t N>
+	const typename StaticVector<T, N>::size_type	StaticVector<T, N>::static_capacity;
+}
+
+#endif
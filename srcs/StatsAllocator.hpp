@@ -0,0 +1,251 @@
+#ifndef STATS_ALLOCATOR_HPP
+# define STATS_ALLOCATOR_HPP
+
+# include <memory>
+# include <cstddef>
+# include <ostream>
+
+namespace ft
+{
+	// 할당 통계
+	// StatsAllocator 하나와 그 할당자에서 rebind된 할당자들(Node<T>, MapNode<T>)이 같은 AllocStats를 공유한다.
+	// 모든 기록은 AllocStats::global()에도 합산된다.
+	// 여러 스레드에서 같이 기록해도 된다. 칸마다 따로 relaxed atomic으로 더하므로
+	// 기록 중에 읽으면 칸끼리는 잠깐 맞지 않을 수 있다.
+	class AllocStats
+	{
+	public:
+		// histogram[i]: [2^i, 2^(i+1)) 바이트 크기의 할당 횟수, 마지막 칸은 그 이상 전부
+		enum { HISTOGRAM_SIZE = 32 };
+
+		size_t		allocations;
+		size_t		deallocations;
+		size_t		bytes_live;
+		size_t		peak_bytes;
+		size_t		bytes_total;
+		size_t		histogram[HISTOGRAM_SIZE];
+
+	public:
+		AllocStats()
+		{
+			reset();
+		}
+
+		void		reset()
+		{
+			allocations = 0;
+			deallocations = 0;
+			bytes_live = 0;
+			peak_bytes = 0;
+			bytes_total = 0;
+			for (size_t i = 0; i < HISTOGRAM_SIZE; ++i)
+				histogram[i] = 0;
+		}
+
+		size_t		live_allocations() const
+		{
+			return (allocations - deallocations);
+		}
+
+		void		record_allocate(size_t bytes)
+		{
+			add_allocate(bytes);
+			if (this != &global())
+				global().add_allocate(bytes);
+		}
+
+		void		record_deallocate(size_t bytes)
+		{
+			add_deallocate(bytes);
+			if (this != &global())
+				global().add_deallocate(bytes);
+		}
+
+		static size_t	bucket(size_t bytes)
+		{
+			size_t		i;
+
+			i = 0;
+			while (bytes > 1 && i < HISTOGRAM_SIZE - 1)
+			{
+				bytes >>= 1;
+				++i;
+			}
+			return (i);
+		}
+
+		// 모든 StatsAllocator의 합계
+		static AllocStats	&global()
+		{
+			static AllocStats	stats;
+
+			return (stats);
+		}
+
+	private:
+		void		add_allocate(size_t bytes)
+		{
+			size_t	live;
+			size_t	peak;
+
+			__atomic_add_fetch(&allocations, 1, __ATOMIC_RELAXED);
+			live = __atomic_add_fetch(&bytes_live, bytes, __ATOMIC_RELAXED);
+			__atomic_add_fetch(&bytes_total, bytes, __ATOMIC_RELAXED);
+			// 다른 스레드가 더 큰 값을 먼저 넣었으면 그만둔다
+			peak = __atomic_load_n(&peak_bytes, __ATOMIC_RELAXED);
+			while (live > peak
+				&& !__atomic_compare_exchange_n(&peak_bytes, &peak, live, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+				;
+			__atomic_add_fetch(&histogram[bucket(bytes)], 1, __ATOMIC_RELAXED);
+		}
+
+		void		add_deallocate(size_t bytes)
+		{
+			__atomic_add_fetch(&deallocations, 1, __ATOMIC_RELAXED);
+			__atomic_sub_fetch(&bytes_live, bytes, __ATOMIC_RELAXED);
+		}
+	};
+
+	// Base 할당자를 감싸서 allocate/deallocate를 AllocStats에 기록하는 할당자
+	// 기본 생성자로 만들면 global()에만 기록되고, AllocStats를 넘겨주면 그 인스턴스에 따로 기록된다.
+	template <typename T, typename Base = std::allocator<T> >
+	class StatsAllocator
+	{
+	public:
+		typedef T										value_type;
+		typedef typename Base::pointer					pointer;
+		typedef typename Base::const_pointer			const_pointer;
+		typedef typename Base::reference				reference;
+		typedef typename Base::const_reference			const_reference;
+		typedef typename Base::size_type				size_type;
+		typedef typename Base::difference_type			difference_type;
+		typedef Base									base_type;
+
+		template <typename U>
+		struct rebind
+		{
+			typedef StatsAllocator<U, typename Base::template rebind<U>::other>	other;
+		};
+
+	private:
+		Base			_base;
+		AllocStats*		_stats;
+
+	public:
+		StatsAllocator() : _base(), _stats(&AllocStats::global())
+		{
+		}
+
+		explicit StatsAllocator(AllocStats &stats, const Base &base = Base()) : _base(base), _stats(&stats)
+		{
+		}
+
+		StatsAllocator(const StatsAllocator &copy) : _base(copy._base), _stats(copy._stats)
+		{
+		}
+
+		// rebind된 할당자도 같은 통계를 가리킨다
+		template <typename U, typename B>
+		StatsAllocator(const StatsAllocator<U, B> &copy) : _base(copy.base()), _stats(&copy.stats())
+		{
+		}
+
+		StatsAllocator	&operator=(const StatsAllocator &ref)
+		{
+			_base = ref._base;
+			_stats = ref._stats;
+			return (*this);
+		}
+
+		~StatsAllocator()
+		{
+		}
+
+		pointer			address(reference x) const
+		{
+			return (_base.address(x));
+		}
+
+		const_pointer	address(const_reference x) const
+		{
+			return (_base.address(x));
+		}
+
+		// 0개 할당(Vector 기본 생성자)은 메모리 예산과 상관없으므로 기록하지 않는다
+		pointer			allocate(size_type n, const void *hint = 0)
+		{
+			pointer		ret;
+
+			(void)hint;
+			ret = _base.allocate(n);
+			if (n != 0)
+				_stats->record_allocate(n * sizeof(T));
+			return (ret);
+		}
+
+		void			deallocate(pointer p, size_type n)
+		{
+			if (n != 0)
+				_stats->record_deallocate(n * sizeof(T));
+			_base.deallocate(p, n);
+		}
+
+		size_type		max_size() const
+		{
+			return (_base.max_size());
+		}
+
+		void			construct(pointer p, const value_type &val)
+		{
+			_base.construct(p, val);
+		}
+
+		void			destroy(pointer p)
+		{
+			_base.destroy(p);
+		}
+
+		AllocStats		&stats() const
+		{
+			return (*_stats);
+		}
+
+		const Base		&base() const
+		{
+			return (_base);
+		}
+
+		friend bool operator==(const StatsAllocator &lhs, const StatsAllocator &rhs)
+		{
+			return (lhs._stats == rhs._stats && lhs._base == rhs._base);
+		}
+
+		friend bool operator!=(const StatsAllocator &lhs, const StatsAllocator &rhs)
+		{
+			return (!(lhs == rhs));
+		}
+	};
+
+	// 통계 출력, 비어있는 히스토그램 칸은 생략
+	inline void		print_alloc_stats(std::ostream &os, const AllocStats &stats, const char *name = "total")
+	{
+		os << '[' << name << "] allocs: " << stats.allocations
+			<< ", frees: " << stats.deallocations
+			<< ", live: " << stats.bytes_live << " bytes in " << stats.live_allocations() << " blocks"
+			<< ", peak: " << stats.peak_bytes << " bytes"
+			<< ", total: " << stats.bytes_total << " bytes" << '\n';
+		for (size_t i = 0; i < AllocStats::HISTOGRAM_SIZE; ++i)
+		{
+			if (stats.histogram[i] == 0)
+				continue ;
+			os << "    [" << (static_cast<size_t>(1) << i) << ", ";
+			if (i == AllocStats::HISTOGRAM_SIZE - 1)
+				os << "inf";
+			else
+				os << (static_cast<size_t>(1) << (i + 1));
+			os << ") bytes: " << stats.histogram[i] << '\n';
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,457 @@
+#ifndef THREAD_POOL_HPP
+# define THREAD_POOL_HPP
+
+# include <cstddef>
+# include <pthread.h>
+# include <sched.h>
+# include <unistd.h>
+# include "WorkStealingDeque.hpp"
+# include "MpmcQueue.hpp"
+
+namespace ft
+{
+	class ThreadPool;
+
+	// 풀에 넣는 작업 하나
+	// 풀과 TaskHandle이 참조를 하나씩 들고, 마지막 참조가 놓이면 지워진다.
+	// 작업 안에서 예외를 던지면 안 된다.
+	class PoolTask
+	{
+	private:
+		long	_refs;
+		int		_done;
+
+	public:
+		explicit PoolTask(long refs) : _refs(refs), _done(0)
+		{
+		}
+
+		virtual ~PoolTask()
+		{
+		}
+
+		virtual void	run() = 0;
+
+		void			execute()
+		{
+			run();
+			__atomic_store_n(&_done, 1, __ATOMIC_RELEASE);
+			release();
+		}
+
+		bool			done() const
+		{
+			return (__atomic_load_n(&_done, __ATOMIC_ACQUIRE) != 0);
+		}
+
+		void			retain()
+		{
+			__sync_add_and_fetch(&_refs, 1);
+		}
+
+		void			release()
+		{
+			if (__sync_sub_and_fetch(&_refs, 1) == 0)
+				delete this;
+		}
+
+	private:
+		PoolTask(const PoolTask &);
+		PoolTask	&operator=(const PoolTask &);
+	};
+
+	// 함수 객체 f를 복사해 두었다가 f()를 부른다. 반환값은 버린다 (결과는 f가 가리키는 곳에 쓸 것)
+	template <class Function>
+	class FunctionTask : public PoolTask
+	{
+	private:
+		Function	_f;
+
+	public:
+		explicit FunctionTask(const Function &f) : PoolTask(2), _f(f)
+		{
+		}
+
+		virtual void	run()
+		{
+			_f();
+		}
+	};
+
+	// submit()이 돌려주는 핸들. wait()는 기다리는 동안 풀의 다른 작업을 대신 실행한다
+	class TaskHandle
+	{
+	private:
+		ThreadPool	*_pool;
+		PoolTask	*_task;
+
+	public:
+		TaskHandle() : _pool(0), _task(0)
+		{
+		}
+
+		TaskHandle(ThreadPool *pool, PoolTask *task) : _pool(pool), _task(task)
+		{
+		}
+
+		TaskHandle(const TaskHandle &copy) : _pool(copy._pool), _task(copy._task)
+		{
+			if (_task)
+				_task->retain();
+		}
+
+		TaskHandle	&operator=(const TaskHandle &ref)
+		{
+			if (ref._task)
+				ref._task->retain();
+			if (_task)
+				_task->release();
+			_pool = ref._pool;
+			_task = ref._task;
+			return (*this);
+		}
+
+		~TaskHandle()
+		{
+			if (_task)
+				_task->release();
+		}
+
+		bool		valid() const
+		{
+			return (_task != 0);
+		}
+
+		bool		done() const
+		{
+			return (_task == 0 || _task->done());
+		}
+
+		void		wait() const;
+	};
+
+	// work-stealing 스레드 풀
+	// 일꾼마다 Chase-Lev deque가 있어서, 일꾼 안에서 넣은 작업은 자기 deque에 쌓고 가장 최근 것부터 꺼내고,
+	// 할 일이 없는 일꾼은 다른 일꾼의 deque에서 가장 오래된 것(보통 가장 큰 덩어리)을 훔친다.
+	// 풀 밖의 스레드가 넣은 작업은 공유 큐(MpmcQueue)로 들어간다.
+	// 할 일을 못 찾은 일꾼은 condition variable에서 잠들고, 작업을 넣는 쪽은 잠든 일꾼이 있을 때만 깨운다.
+	class ThreadPool
+	{
+	public:
+		enum { INJECT_CAPACITY = 4096, SPIN_ROUNDS = 32 };
+
+	private:
+		struct Worker
+		{
+			ThreadPool					*pool;
+			size_t						index;
+			pthread_t					thread;
+			unsigned int				seed;
+			WorkStealingDeque<PoolTask>	deque;
+		};
+
+		// parallel_for의 한 구간, 둘로 나눠서 오른쪽을 작업으로 내놓고 왼쪽을 계속 나눈다
+		template <class Function>
+		class RangeTask : public PoolTask
+		{
+		private:
+			ThreadPool	*_pool;
+			size_t		_lo;
+			size_t		_hi;
+			size_t		_grain;
+			Function	*_f;
+			long		*_pending;
+
+		public:
+			RangeTask(ThreadPool *pool, size_t lo, size_t hi, size_t grain, Function *f, long *pending)
+				: PoolTask(1), _pool(pool), _lo(lo), _hi(hi), _grain(grain), _f(f), _pending(pending)
+			{
+			}
+
+			virtual void	run()
+			{
+				_pool->run_range(_lo, _hi, _grain, _f, _pending);
+			}
+		};
+
+		Worker*					_workers;
+		size_t					_count;
+		MpmcQueue<PoolTask *>	_injected;
+		pthread_key_t			_key;
+		pthread_mutex_t			_lock;
+		pthread_cond_t			_wake;
+		int						_sleepers;
+		int						_stop;
+		// shutdown()이 일꾼을 모두 join했는지. 다른 스레드의 enqueue가 읽는다
+		int						_joined;
+
+	public:
+		// threads가 0이면 코어 수만큼
+		explicit ThreadPool(size_t threads = 0)
+			: _injected(INJECT_CAPACITY, false), _sleepers(0), _stop(0), _joined(0)
+		{
+			_count = threads ? threads : hardware_concurrency();
+			pthread_key_create(&_key, 0);
+			pthread_mutex_init(&_lock, 0);
+			pthread_cond_init(&_wake, 0);
+			_workers = new Worker[_count];
+			for (size_t i = 0; i < _count; ++i)
+			{
+				_workers[i].pool = this;
+				_workers[i].index = i;
+				_workers[i].seed = static_cast<unsigned int>(i * 2654435761u + 1);
+			}
+			for (size_t i = 0; i < _count; ++i)
+				pthread_create(&_workers[i].thread, 0, worker_main, _workers + i);
+		}
+
+		~ThreadPool()
+		{
+			shutdown();
+			delete[] _workers;
+			pthread_key_delete(_key);
+			pthread_mutex_destroy(&_lock);
+			pthread_cond_destroy(&_wake);
+		}
+
+		// 여러 컴포넌트가 같이 쓰는 기본 풀 (코어 수만큼)
+		static ThreadPool	&global()
+		{
+			static ThreadPool	pool;
+
+			return (pool);
+		}
+
+		static size_t	hardware_concurrency()
+		{
+			long	n;
+
+			n = sysconf(_SC_NPROCESSORS_ONLN);
+			return (n > 0 ? static_cast<size_t>(n) : 1);
+		}
+
+		size_t			size() const
+		{
+			return (_count);
+		}
+
+		// 지금 스레드가 이 풀의 일꾼이면 그 번호, 아니면 size()
+		size_t			worker_index() const
+		{
+			Worker	*self;
+
+			self = current();
+			return (self ? self->index : _count);
+		}
+
+		// f()를 실행할 작업을 넣는다. 풀이 닫혔으면 그 자리에서 실행한다
+		template <class Function>
+		TaskHandle		submit(const Function &f)
+		{
+			PoolTask	*task;
+
+			task = new FunctionTask<Function>(f);
+			enqueue(task);
+			return (TaskHandle(this, task));
+		}
+
+		// [begin, end)를 grain 이하 크기의 구간으로 나눠 f(lo, hi)를 부르고, 모두 끝날 때까지 기다린다
+		// 부른 스레드도 일을 나눠 맡는다. f는 여러 스레드에서 동시에 불린다.
+		template <class Function>
+		void			parallel_for(size_t begin, size_t end, size_t grain, Function f)
+		{
+			long	pending;
+
+			if (begin >= end)
+				return ;
+			if (grain == 0)
+				grain = 1;
+			pending = 1;
+			run_range(begin, end, grain, &f, &pending);
+			while (__atomic_load_n(&pending, __ATOMIC_ACQUIRE) != 0)
+			{
+				if (!help_one())
+					sched_yield();
+			}
+		}
+
+		// 작업 하나를 찾아서 실행하면 true. 기다리는 쪽이 놀지 않도록 부른다
+		bool			help_one()
+		{
+			PoolTask	*task;
+
+			task = find_task(current());
+			if (task == 0)
+				return (false);
+			task->execute();
+			return (true);
+		}
+
+		// 이미 들어간 작업을 모두 마친 뒤 일꾼을 멈추고 기다린다. 두 번 불러도 된다
+		// 일꾼 스레드 안에서 부르면 안 된다.
+		void			shutdown()
+		{
+			if (__atomic_load_n(&_joined, __ATOMIC_ACQUIRE))
+				return ;
+			pthread_mutex_lock(&_lock);
+			__atomic_store_n(&_stop, 1, __ATOMIC_SEQ_CST);
+			pthread_cond_broadcast(&_wake);
+			pthread_mutex_unlock(&_lock);
+			for (size_t i = 0; i < _count; ++i)
+				pthread_join(_workers[i].thread, 0);
+			__atomic_store_n(&_joined, 1, __ATOMIC_RELEASE);
+			// 일꾼이 끝나는 사이에 들어온 작업
+			while (help_one())
+				;
+		}
+
+	private:
+		Worker			*current() const
+		{
+			return (static_cast<Worker *>(pthread_getspecific(_key)));
+		}
+
+		template <class Function>
+		void			run_range(size_t lo, size_t hi, size_t grain, Function *f, long *pending)
+		{
+			size_t		mid;
+
+			while (hi - lo > grain)
+			{
+				mid = lo + (hi - lo) / 2;
+				__atomic_fetch_add(pending, 1, __ATOMIC_RELAXED);
+				enqueue(new RangeTask<Function>(this, mid, hi, grain, f, pending));
+				hi = mid;
+			}
+			(*f)(lo, hi);
+			__atomic_fetch_sub(pending, 1, __ATOMIC_RELEASE);
+		}
+
+		void			enqueue(PoolTask *task)
+		{
+			Worker	*self;
+
+			if (__atomic_load_n(&_stop, __ATOMIC_ACQUIRE) && __atomic_load_n(&_joined, __ATOMIC_ACQUIRE))
+			{
+				task->execute();
+				return ;
+			}
+			self = current();
+			if (self)
+				self->deque.push(task);
+			else
+				_injected.push(task);
+			wake_one();
+		}
+
+		// 잠든 일꾼이 있을 때만 mutex를 잡는다 (잠드는 쪽은 _sleepers를 올린 뒤 다시 확인한다)
+		void			wake_one()
+		{
+			__atomic_thread_fence(__ATOMIC_SEQ_CST);
+			if (__atomic_load_n(&_sleepers, __ATOMIC_RELAXED) == 0)
+				return ;
+			pthread_mutex_lock(&_lock);
+			pthread_cond_signal(&_wake);
+			pthread_mutex_unlock(&_lock);
+		}
+
+		// 자기 deque, 공유 큐, 다른 일꾼의 deque 순서로 찾는다
+		PoolTask		*find_task(Worker *self)
+		{
+			PoolTask	*task;
+			size_t		start;
+
+			if (self && (task = self->deque.pop()))
+				return (task);
+			if (_injected.try_pop(task))
+				return (task);
+			if (_count == 0)
+				return (0);
+			if (self)
+			{
+				self->seed = self->seed * 1103515245u + 12345u;
+				start = (self->seed >> 16) % _count;
+			}
+			else
+				start = 0;
+			for (size_t i = 0; i < _count; ++i)
+			{
+				Worker	&victim = _workers[(start + i) % _count];
+
+				if (&victim == self)
+					continue ;
+				if ((task = victim.deque.steal()))
+					return (task);
+			}
+			return (0);
+		}
+
+		bool			has_work() const
+		{
+			if (!_injected.empty())
+				return (true);
+			for (size_t i = 0; i < _count; ++i)
+			{
+				if (!_workers[i].deque.empty())
+					return (true);
+			}
+			return (false);
+		}
+
+		static void		*worker_main(void *arg)
+		{
+			Worker		*self = static_cast<Worker *>(arg);
+			ThreadPool	*pool = self->pool;
+			PoolTask	*task;
+			int			idle;
+
+			pthread_setspecific(pool->_key, self);
+			idle = 0;
+			while (true)
+			{
+				task = pool->find_task(self);
+				if (task)
+				{
+					task->execute();
+					idle = 0;
+					continue ;
+				}
+				if (++idle < SPIN_ROUNDS)
+				{
+					sched_yield();
+					continue ;
+				}
+				idle = 0;
+				pthread_mutex_lock(&pool->_lock);
+				__atomic_fetch_add(&pool->_sleepers, 1, __ATOMIC_SEQ_CST);
+				if (!pool->has_work())
+				{
+					if (__atomic_load_n(&pool->_stop, __ATOMIC_ACQUIRE))
+					{
+						__atomic_fetch_sub(&pool->_sleepers, 1, __ATOMIC_SEQ_CST);
+						pthread_mutex_unlock(&pool->_lock);
+						break ;
+					}
+					pthread_cond_wait(&pool->_wake, &pool->_lock);
+				}
+				__atomic_fetch_sub(&pool->_sleepers, 1, __ATOMIC_SEQ_CST);
+				pthread_mutex_unlock(&pool->_lock);
+			}
+			return (0);
+		}
+
+		ThreadPool(const ThreadPool &);
+		ThreadPool	&operator=(const ThreadPool &);
+	};
+
+	inline void		TaskHandle::wait() const
+	{
+		while (!done())
+		{
+			if (!_pool->help_one())
+				sched_yield();
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,805 @@
+#ifndef UNROLLED_LIST_HPP
+# define UNROLLED_LIST_HPP
+
+# include <memory>
+# include <cstddef>
+# include "Iterator.hpp"
+# include "Algorithm.hpp"
+# include "Vector.hpp"
+# include "utils.hpp"
+
+namespace ft
+{
+	// 노드마다 원소를 ChunkSize개까지 배열로 담는 연결 리스트, ft::List와 같은 API
+	// 한 노드 안의 원소는 메모리에 붙어 있으므로 훑을 때 캐시 미스가 원소마다가 아니라 노드마다 난다.
+	// 노드 안의 원소는 [lo, hi)에 있고 앞뒤로 빈칸을 둘 수 있어서 양 끝 push/pop이 O(1)이다.
+	// 가운데 삽입과 삭제는 노드 안에서 가까운 쪽 원소를 밀어서 하고(O(ChunkSize)), 꽉 찬 노드는
+	// 반으로 나누고, 4분의 1보다 적게 남은 노드는 이웃과 합친다.
+	//
+	// ft::List와 달리 insert와 erase는 같은 노드(나뉘거나 합쳐지면 이웃 노드까지)를 가리키는
+	// 이터레이터를 무효로 만든다. splice는 원소를 복사하지 않고 노드를 잘라 옮기므로,
+	// 구간 경계나 position이 노드 중간이면 그 노드를 가리키던 이터레이터도 무효가 된다.
+	template < typename T, size_t ChunkSize = (512 / sizeof(T) > 8 ? 512 / sizeof(T) : 8),
+		typename Alloc = std::allocator<T> >
+	class UnrolledList
+	{
+	private:
+		struct ChunkBase
+		{
+			ChunkBase	*prev;
+			ChunkBase	*next;
+			size_t		lo;
+			size_t		hi;
+		};
+
+		struct Chunk : ChunkBase
+		{
+			union
+			{
+				char		bytes[ChunkSize * sizeof(T)];
+				long double	ld;
+				void		*p;
+				long long	ll;
+			}			storage;
+		};
+
+		static T		*data(ChunkBase *c)
+		{ return (reinterpret_cast<T *>(static_cast<Chunk *>(c)->storage.bytes)); }
+
+	public:
+		typedef T											value_type;
+		typedef Alloc										allocator_type;
+		typedef typename allocator_type::reference			reference;
+		typedef typename allocator_type::const_reference	const_reference;
+		typedef typename allocator_type::pointer			pointer;
+		typedef typename allocator_type::const_pointer		const_pointer;
+		typedef ptrdiff_t									difference_type;
+		typedef size_t										size_type;
+
+		// (노드, 노드 안의 위치). 끝은 (_end, 0)
+		template <typename Ref, typename Ptr>
+		class Iter
+		{
+		public:
+			typedef bidirectional_iterator_tag	iterator_category;
+			typedef T							value_type;
+			typedef ptrdiff_t					difference_type;
+			typedef Ptr							pointer;
+			typedef Ref							reference;
+
+			ChunkBase	*_chunk;
+			size_t		_index;
+
+		public:
+			Iter() : _chunk(0), _index(0) {}
+			Iter(ChunkBase *c, size_t i) : _chunk(c), _index(i) {}
+			Iter(const Iter<T&, T*> &x) : _chunk(x._chunk), _index(x._index) {}
+
+			reference	operator* () const
+			{ return (data(_chunk)[_index]); }
+
+			pointer		operator-> () const
+			{ return (data(_chunk) + _index); }
+
+			Iter		&operator++ ()
+			{
+				if (++_index == _chunk->hi)
+				{
+					_chunk = _chunk->next;
+					_index = _chunk->lo;
+				}
+				return (*this);
+			}
+
+			Iter		operator++ (int)
+			{ Iter	tmp(*this); ++*this; return (tmp); }
+
+			Iter		&operator-- ()
+			{
+				if (_index == _chunk->lo)
+				{
+					_chunk = _chunk->prev;
+					_index = _chunk->hi;
+				}
+				--_index;
+				return (*this);
+			}
+
+			Iter		operator-- (int)
+			{ Iter	tmp(*this); --*this; return (tmp); }
+
+			bool		operator== (const Iter &x) const
+			{ return (_chunk == x._chunk && _index == x._index); }
+			bool		operator!= (const Iter &x) const
+			{ return (!(*this == x)); }
+		};
+
+		template <typename It>
+		class ReverseIter
+		{
+		public:
+			It		_base;
+
+		public:
+			ReverseIter() {}
+			explicit ReverseIter(const It &it) : _base(it) {}
+			template <typename U>
+			ReverseIter(const ReverseIter<U> &x) : _base(x._base) {}
+
+			typename It::reference	operator* () const
+			{ It	tmp(_base); return (*--tmp); }
+
+			typename It::pointer	operator-> () const
+			{ return (&**this); }
+
+			ReverseIter	&operator++ ()
+			{ --_base; return (*this); }
+			ReverseIter	operator++ (int)
+			{ ReverseIter	tmp(*this); --_base; return (tmp); }
+			ReverseIter	&operator-- ()
+			{ ++_base; return (*this); }
+			ReverseIter	operator-- (int)
+			{ ReverseIter	tmp(*this); ++_base; return (tmp); }
+
+			bool		operator== (const ReverseIter &x) const
+			{ return (_base == x._base); }
+			bool		operator!= (const ReverseIter &x) const
+			{ return (_base != x._base); }
+		};
+
+		typedef Iter<T&, T*>							iterator;
+		typedef Iter<const T&, const T*>				const_iterator;
+		typedef ReverseIter<iterator>					reverse_iterator;
+		typedef ReverseIter<const_iterator>				const_reverse_iterator;
+
+	private:
+		typedef typename allocator_type::template rebind<Chunk>::other	chunk_allocator;
+
+		enum { CHUNK = ChunkSize, MERGE_BELOW = ChunkSize / 4 };
+
+		allocator_type		_allocator;
+		chunk_allocator		_chunk_alloc;
+		ChunkBase			_end;
+		size_type			_size;
+
+	public:
+		explicit UnrolledList(const allocator_type &alloc = allocator_type())
+			: _allocator(alloc), _chunk_alloc(alloc), _size(0)
+		{
+			init();
+		}
+
+		explicit UnrolledList(size_type n, const value_type &val = value_type(), const allocator_type &alloc = allocator_type())
+			: _allocator(alloc), _chunk_alloc(alloc), _size(0)
+		{
+			init();
+			insert(end(), n, val);
+		}
+
+		template <class InputIterator>
+		UnrolledList(InputIterator first, InputIterator last, const allocator_type &alloc = allocator_type())
+			: _allocator(alloc), _chunk_alloc(alloc), _size(0)
+		{
+			init();
+			insert(end(), first, last);
+		}
+
+		UnrolledList(const UnrolledList &copy)
+			: _allocator(copy._allocator), _chunk_alloc(copy._chunk_alloc), _size(0)
+		{
+			init();
+			insert(end(), copy.begin(), copy.end());
+		}
+
+		~UnrolledList()
+		{
+			clear();
+		}
+
+		UnrolledList	&operator=(const UnrolledList &ref)
+		{
+			if (this != &ref)
+				assign(ref.begin(), ref.end());
+			return (*this);
+		}
+
+		iterator				begin()
+		{ return (iterator(_end.next, _end.next->lo)); }
+		const_iterator			begin() const
+		{ return (const_iterator(_end.next, _end.next->lo)); }
+		iterator				end()
+		{ return (iterator(&_end, 0)); }
+		const_iterator			end() const
+		{ return (const_iterator(const_cast<ChunkBase *>(&_end), 0)); }
+		reverse_iterator		rbegin()
+		{ return (reverse_iterator(end())); }
+		const_reverse_iterator	rbegin() const
+		{ return (const_reverse_iterator(end())); }
+		reverse_iterator		rend()
+		{ return (reverse_iterator(begin())); }
+		const_reverse_iterator	rend() const
+		{ return (const_reverse_iterator(begin())); }
+
+		bool			empty() const
+		{ return (_size == 0); }
+
+		size_type		size() const
+		{ return (_size); }
+
+		size_type		max_size() const
+		{ return (_allocator.max_size()); }
+
+		reference		front()
+		{ return (data(_end.next)[_end.next->lo]); }
+		const_reference	front() const
+		{ return (data(_end.next)[_end.next->lo]); }
+		reference		back()
+		{ return (data(_end.prev)[_end.prev->hi - 1]); }
+		const_reference	back() const
+		{ return (data(_end.prev)[_end.prev->hi - 1]); }
+
+		template <class InputIterator>
+		void			assign(InputIterator first, InputIterator last)
+		{
+			clear();
+			insert(end(), first, last);
+		}
+
+		void			assign(size_type n, const value_type &val)
+		{
+			clear();
+			insert(end(), n, val);
+		}
+
+		// 첫 노드 앞에 빈칸이 없으면 새 노드를 앞에 붙인다. 새 노드는 뒤쪽부터 채운다
+		void			push_front(const value_type &val)
+		{
+			ChunkBase	*c = _end.next;
+
+			if (c == &_end || c->lo == 0)
+				c = new_chunk(&_end, CHUNK);
+			_allocator.construct(data(c) + c->lo - 1, val);
+			--c->lo;
+			++_size;
+		}
+
+		void			push_back(const value_type &val)
+		{
+			ChunkBase	*c = _end.prev;
+
+			if (c == &_end || c->hi == CHUNK)
+				c = new_chunk(_end.prev, 0);
+			_allocator.construct(data(c) + c->hi, val);
+			++c->hi;
+			++_size;
+		}
+
+		void			pop_front()
+		{
+			ChunkBase	*c = _end.next;
+
+			_allocator.destroy(data(c) + c->lo);
+			++c->lo;
+			--_size;
+			if (c->lo == c->hi)
+				free_chunk(c);
+		}
+
+		void			pop_back()
+		{
+			ChunkBase	*c = _end.prev;
+
+			--c->hi;
+			_allocator.destroy(data(c) + c->hi);
+			--_size;
+			if (c->lo == c->hi)
+				free_chunk(c);
+		}
+
+		// position 앞에 넣고 넣은 원소를 가리키는 이터레이터를 반환
+		iterator		insert(iterator position, const value_type &val)
+		{
+			value_type	copy(val);
+			ChunkBase	*c = position._chunk;
+			size_t		i = position._index;
+
+			if (c == &_end)
+			{
+				push_back(copy);
+				return (iterator(_end.prev, _end.prev->hi - 1));
+			}
+			if (i == c->lo && c->lo > 0)
+			{
+				_allocator.construct(data(c) + c->lo - 1, copy);
+				--c->lo;
+				++_size;
+				return (iterator(c, c->lo));
+			}
+			if (c->lo == 0 && c->hi == CHUNK)
+			{
+				split(c, (c->lo + c->hi) / 2);
+				if (i >= c->hi)
+				{
+					i = i - c->hi + c->next->lo;
+					c = c->next;
+				}
+			}
+			// 빈칸이 있는 쪽으로 민다. 양쪽 다 있으면 옮길 원소가 적은 쪽
+			if (c->hi < CHUNK && (c->lo == 0 || c->hi - i <= i - c->lo))
+				shift_right(c, i, copy);
+			else
+			{
+				shift_left(c, i, copy);
+				--i;
+			}
+			++_size;
+			return (iterator(c, i));
+		}
+
+		void			insert(iterator position, size_type n, const value_type &val)
+		{
+			insert_fill(position, n, val);
+		}
+
+		template <class InputIterator>
+		void			insert(iterator position, InputIterator first, InputIterator last)
+		{
+			insert_dispatch(position, first, last);
+		}
+
+		// 지운 원소 다음을 가리키는 이터레이터를 반환
+		iterator		erase(iterator position)
+		{
+			ChunkBase	*c = position._chunk;
+			size_t		i = position._index;
+
+			if (i - c->lo < c->hi - 1 - i)
+			{
+				// 앞쪽 원소를 뒤로 한 칸씩 당긴다
+				for (size_t j = i; j > c->lo; --j)
+					data(c)[j] = data(c)[j - 1];
+				_allocator.destroy(data(c) + c->lo);
+				++c->lo;
+				++i;
+			}
+			else
+			{
+				for (size_t j = i; j + 1 < c->hi; ++j)
+					data(c)[j] = data(c)[j + 1];
+				--c->hi;
+				_allocator.destroy(data(c) + c->hi);
+			}
+			--_size;
+			return (rebalance(c, i));
+		}
+
+		// 구간 양 끝에서 노드를 나누고 사이의 노드를 통째로 지운다
+		iterator		erase(iterator first, iterator last)
+		{
+			ChunkBase	*from;
+			ChunkBase	*to;
+			ChunkBase	*next;
+
+			if (first == last)
+				return (last);
+			to = split_at(last);
+			from = split_at(first);
+			while (from != to)
+			{
+				next = from->next;
+				_size -= from->hi - from->lo;
+				destroy_chunk(from);
+				from = next;
+			}
+			return (to == &_end ? end() : rebalance(to, to->lo));
+		}
+
+		void			swap(UnrolledList &x)
+		{
+			UnrolledList	tmp(_allocator);
+
+			tmp.splice(tmp.end(), *this);
+			splice(end(), x);
+			x.splice(x.end(), tmp);
+			ft::swap(_allocator, x._allocator);
+			ft::swap(_chunk_alloc, x._chunk_alloc);
+		}
+
+		void			resize(size_type n, value_type val = value_type())
+		{
+			while (_size > n)
+				pop_back();
+			while (_size < n)
+				push_back(val);
+		}
+
+		void			clear()
+		{
+			ChunkBase	*c = _end.next;
+			ChunkBase	*next;
+
+			while (c != &_end)
+			{
+				next = c->next;
+				destroy_chunk(c);
+				c = next;
+			}
+			_size = 0;
+		}
+
+		// x의 노드를 모두 position 앞으로 옮긴다, O(1) (position이 노드 중간이면 그 노드를 나눈다)
+		void			splice(iterator position, UnrolledList &x)
+		{
+			ChunkBase	*at;
+
+			if (x.empty() || &x == this)
+				return ;
+			at = split_at(position);
+			transfer(at, x._end.next, &x._end);
+			_size += x._size;
+			x._size = 0;
+		}
+
+		void			splice(iterator position, UnrolledList &x, iterator i)
+		{
+			iterator	next = i;
+
+			splice(position, x, i, ++next);
+		}
+
+		// 구간 양 끝에서 노드를 나눠 사이의 노드를 옮긴다. 원소를 복사하지 않는다
+		// position이 [first, last) 안에 있으면 안 된다
+		void			splice(iterator position, UnrolledList &x, iterator first, iterator last)
+		{
+			ChunkBase	*at = 0;
+			ChunkBase	*from;
+			ChunkBase	*to;
+			size_type	n = 0;
+
+			if (first == last || (&x == this && (position == first || position == last)))
+				return ;
+			// 나누면 왼쪽이 원래 노드에 남으므로, 한 노드 안에서는 뒤쪽 위치부터 나눠야
+			// 아직 나누지 않은 이터레이터가 그대로 맞다
+			if (&x == this && position._chunk == last._chunk && position._index > last._index)
+				at = split_at(position);
+			to = x.split_at(last);
+			from = x.split_at(first);
+			if (!at)
+				at = split_at(position);
+			for (ChunkBase *c = from; c != to; c = c->next)
+				n += c->hi - c->lo;
+			transfer(at, from, to);
+			x._size -= n;
+			_size += n;
+		}
+
+		void			remove(const value_type &val)
+		{
+			remove_if(EqualTo(val));
+		}
+
+		// 남길 원소를 앞으로 모으고 뒤를 한 번에 지운다
+		template <class Predicate>
+		void			remove_if(Predicate pred)
+		{
+			iterator	out = begin();
+
+			for (iterator it = begin(); it != end(); ++it)
+			{
+				if (!pred(*it))
+				{
+					if (out != it)
+						*out = *it;
+					++out;
+				}
+			}
+			erase(out, end());
+		}
+
+		void			unique()
+		{
+			unique(Equal());
+		}
+
+		template <class BinaryPredicate>
+		void			unique(BinaryPredicate binary_pred)
+		{
+			iterator	out = begin();
+			iterator	it = begin();
+
+			if (it == end())
+				return ;
+			while (++it != end())
+			{
+				if (!binary_pred(*out, *it))
+				{
+					++out;
+					if (out != it)
+						*out = *it;
+				}
+			}
+			erase(++out, end());
+		}
+
+		void			merge(UnrolledList &x)
+		{
+			merge(x, ft::less<T>());
+		}
+
+		// 정렬된 두 리스트를 합친다. 같으면 이 리스트의 원소가 먼저. 새 노드에 차례로 담는다
+		template <class Compare>
+		void			merge(UnrolledList &x, Compare comp)
+		{
+			UnrolledList	out(_allocator);
+			iterator		a = begin();
+			iterator		b = x.begin();
+
+			if (&x == this)
+				return ;
+			while (a != end() && b != x.end())
+			{
+				if (comp(*b, *a))
+					out.push_back(*b++);
+				else
+					out.push_back(*a++);
+			}
+			for (; a != end(); ++a)
+				out.push_back(*a);
+			for (; b != x.end(); ++b)
+				out.push_back(*b);
+			clear();
+			x.clear();
+			splice(end(), out);
+		}
+
+		void			sort()
+		{
+			sort(ft::less<T>());
+		}
+
+		// 원소를 버퍼에 모아 ft::stable_sort로 정렬하고 차례로 되돌려 쓴다. 같은 원소의 순서는 지킨다
+		template <class Compare>
+		void			sort(Compare comp)
+		{
+			ft::Vector<T>	buffer;
+			iterator		out = begin();
+
+			if (_size < 2)
+				return ;
+			buffer.reserve(_size);
+			for (iterator it = begin(); it != end(); ++it)
+				buffer.push_back(*it);
+			ft::stable_sort(buffer.begin(), buffer.end(), comp);
+			for (size_type i = 0; i < _size; ++i, ++out)
+				*out = buffer[i];
+		}
+
+		// 노드 순서와 노드 안의 원소 순서를 뒤집는다
+		void			reverse()
+		{
+			ChunkBase	*c = &_end;
+
+			do
+			{
+				ft::swap(c->prev, c->next);
+				c = c->prev;
+				if (c != &_end)
+				{
+					for (size_t i = c->lo, j = c->hi; i + 1 < j; ++i, --j)
+						ft::swap(data(c)[i], data(c)[j - 1]);
+				}
+			}
+			while (c != &_end);
+		}
+
+		allocator_type	get_allocator() const
+		{
+			return (_allocator);
+		}
+
+		friend bool operator== (const UnrolledList &lhs, const UnrolledList &rhs)
+		{
+			if (lhs.size() != rhs.size())
+				return (false);
+			return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+		}
+
+		friend bool operator!= (const UnrolledList &lhs, const UnrolledList &rhs)
+		{ return (!(lhs == rhs)); }
+
+		friend bool operator< (const UnrolledList &lhs, const UnrolledList &rhs)
+		{ return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end())); }
+
+		friend bool operator<= (const UnrolledList &lhs, const UnrolledList &rhs)
+		{ return (!(rhs < lhs)); }
+
+		friend bool operator> (const UnrolledList &lhs, const UnrolledList &rhs)
+		{ return (rhs < lhs); }
+
+		friend bool operator>= (const UnrolledList &lhs, const UnrolledList &rhs)
+		{ return (!(lhs < rhs)); }
+
+	private:
+		struct EqualTo
+		{
+			value_type	val;
+
+			explicit EqualTo(const value_type &v) : val(v) {}
+
+			bool	operator() (const value_type &x) const
+			{ return (x == val); }
+		};
+
+		struct Equal
+		{
+			bool	operator() (const value_type &a, const value_type &b) const
+			{ return (a == b); }
+		};
+
+		void			init()
+		{
+			_end.prev = &_end;
+			_end.next = &_end;
+			_end.lo = 0;
+			_end.hi = 0;
+		}
+
+		// after 뒤에 빈 노드를 붙인다. 원소는 start부터 채운다
+		ChunkBase		*new_chunk(ChunkBase *after, size_t start)
+		{
+			Chunk	*c = _chunk_alloc.allocate(1);
+
+			c->lo = start;
+			c->hi = start;
+			c->prev = after;
+			c->next = after->next;
+			after->next->prev = c;
+			after->next = c;
+			return (c);
+		}
+
+		void			free_chunk(ChunkBase *c)
+		{
+			c->prev->next = c->next;
+			c->next->prev = c->prev;
+			_chunk_alloc.deallocate(static_cast<Chunk *>(c), 1);
+		}
+
+		void			destroy_chunk(ChunkBase *c)
+		{
+			for (size_t i = c->lo; i < c->hi; ++i)
+				_allocator.destroy(data(c) + i);
+			free_chunk(c);
+		}
+
+		// c의 [i, hi)를 바로 뒤 새 노드의 앞쪽으로 옮긴다
+		void			split(ChunkBase *c, size_t i)
+		{
+			ChunkBase	*right = new_chunk(c, 0);
+
+			for (size_t j = i; j < c->hi; ++j)
+			{
+				_allocator.construct(data(right) + right->hi++, data(c)[j]);
+				_allocator.destroy(data(c) + j);
+			}
+			c->hi = i;
+		}
+
+		// it이 노드의 시작이 되도록 나누고 그 노드를 반환. 끝이면 _end
+		ChunkBase		*split_at(iterator it)
+		{
+			if (it._chunk == &_end || it._index == it._chunk->lo)
+				return (it._chunk);
+			split(it._chunk, it._index);
+			return (it._chunk->next);
+		}
+
+		// [i, hi)를 한 칸 뒤로 밀고 i 자리에 val을 둔다
+		void			shift_right(ChunkBase *c, size_t i, const value_type &val)
+		{
+			T	*d = data(c);
+
+			if (i == c->hi)
+				_allocator.construct(d + i, val);
+			else
+			{
+				_allocator.construct(d + c->hi, d[c->hi - 1]);
+				for (size_t j = c->hi - 1; j > i; --j)
+					d[j] = d[j - 1];
+				d[i] = val;
+			}
+			++c->hi;
+		}
+
+		// [lo, i)를 한 칸 앞으로 밀고 i - 1 자리에 val을 둔다
+		void			shift_left(ChunkBase *c, size_t i, const value_type &val)
+		{
+			T	*d = data(c);
+
+			if (i == c->lo)
+				_allocator.construct(d + i - 1, val);
+			else
+			{
+				_allocator.construct(d + c->lo - 1, d[c->lo]);
+				for (size_t j = c->lo; j + 1 < i; ++j)
+					d[j] = d[j + 1];
+				d[i - 1] = val;
+			}
+			--c->lo;
+		}
+
+		// c의 위치 i 다음 원소를 가리키는 이터레이터를 돌려준다. 비었으면 c를 없애고,
+		// 너무 적게 남았으면 다음 노드의 원소를 c 뒤로 옮겨 합친다
+		iterator		rebalance(ChunkBase *c, size_t i)
+		{
+			ChunkBase	*next = c->next;
+
+			if (c->lo == c->hi)
+			{
+				free_chunk(c);
+				return (iterator(next, next->lo));
+			}
+			if (c->hi - c->lo < MERGE_BELOW && next != &_end && (c->hi - c->lo) + (next->hi - next->lo) <= CHUNK / 2)
+			{
+				// c를 앞쪽으로 모아 next의 원소가 들어갈 자리를 만든다
+				size_t	shift = c->lo;
+
+				for (size_t j = c->lo; j < c->hi; ++j)
+				{
+					_allocator.construct(data(c) + j - shift, data(c)[j]);
+					_allocator.destroy(data(c) + j);
+				}
+				c->lo -= shift;
+				c->hi -= shift;
+				i -= shift;
+				for (size_t j = next->lo; j < next->hi; ++j)
+					_allocator.construct(data(c) + c->hi++, data(next)[j]);
+				destroy_chunk(next);
+			}
+			if (i == c->hi)
+				return (iterator(c->next, c->next->lo));
+			return (iterator(c, i));
+		}
+
+		// [first, last) 노드들을 떼어 position 노드 앞에 잇는다
+		static void		transfer(ChunkBase *position, ChunkBase *first, ChunkBase *last)
+		{
+			ChunkBase	*before_last = last->prev;
+
+			first->prev->next = last;
+			last->prev = first->prev;
+			first->prev = position->prev;
+			before_last->next = position;
+			position->prev->next = first;
+			position->prev = before_last;
+		}
+
+		// UnrolledList<int>(...).insert(pos, 10, 30)이 이터레이터 구간으로 들어오지 않게 한다
+		void			insert_dispatch(iterator position, int n, int val)
+		{
+			insert_fill(position, n, static_cast<value_type>(val));
+		}
+
+		template <class InputIterator>
+		void			insert_dispatch(iterator position, InputIterator first, InputIterator last)
+		{
+			UnrolledList	tmp(_allocator);
+
+			for (; first != last; ++first)
+				tmp.push_back(*first);
+			splice(position, tmp);
+		}
+
+		// 새 노드들에 꽉 채워 만든 뒤 통째로 잇는다
+		void			insert_fill(iterator position, size_type n, const value_type &val)
+		{
+			UnrolledList	tmp(_allocator);
+
+			for (size_type i = 0; i < n; ++i)
+				tmp.push_back(val);
+			splice(position, tmp);
+		}
+	};
+}
+
+#endif
@@ -2,6 +2,7 @@
 # define VECTOR_HPP
 
 # include <memory>
+# include <stdexcept>
 # include "utils.hpp"
 # include "VectorIterator.hpp"
 # include "ReverseVectorIterator.hpp"
@@ -655,4 +656,7 @@ void				ft::Vector<T, Alloc>::clear()
 	}
 }
 
+// 비트 하나에 원소 하나를 담는 Vector<bool> 특수화
+# include "VectorBool.hpp"
+
 #endif
\ No newline at end of file
@@ -0,0 +1,607 @@
+#ifndef VECTOR_BOOL_HPP
+# define VECTOR_BOOL_HPP
+
+# include <memory>
+# include <stdexcept>
+# include "Vector.hpp"
+# include "Iterator.hpp"
+# include "Bits.hpp"
+# include "utils.hpp"
+
+namespace ft
+{
+	// 원소 하나를 비트 하나에 담는 Vector<bool>. 20억 개가 250MB 남짓이다
+	// operator[]와 *it는 bool&가 아니라 비트를 가리키는 프록시(reference)를 돌려준다.
+	// count, find_first/find_next, set/reset, &, |, ^는 워드(64비트) 단위로 돈다.
+	// insert와 erase는 뒤쪽 비트를 하나씩 옮기므로 O(n)이다 (Vector와 같다).
+	// 비트 연산자는 크기가 같은 두 벡터끼리만 되고 다르면 std::invalid_argument를 던진다.
+	template <typename Alloc>
+	class Vector<bool, Alloc>
+	{
+	public:
+		typedef bool										value_type;
+		typedef Alloc										allocator_type;
+		typedef detail::bit_reference						reference;
+		typedef bool										const_reference;
+		typedef ptrdiff_t									difference_type;
+		typedef size_t										size_type;
+		typedef detail::bit_word							word_type;
+
+		static const size_type	npos = static_cast<size_type>(-1);
+
+		// (워드, 워드 안의 비트). Ref가 reference면 쓸 수 있고 bool이면 읽기만 한다
+		template <typename Ref>
+		class Iter
+		{
+		public:
+			typedef random_access_iterator_tag	iterator_category;
+			typedef bool						value_type;
+			typedef ptrdiff_t					difference_type;
+			typedef void						pointer;
+			typedef Ref							reference;
+
+			word_type	*_word;
+			size_t		_bit;
+
+		public:
+			Iter() : _word(0), _bit(0) {}
+			Iter(word_type *w, size_t bit) : _word(w), _bit(bit) {}
+			Iter(const Iter<detail::bit_reference> &x) : _word(x._word), _bit(x._bit) {}
+
+			reference	operator* () const
+			{ return (reference(detail::bit_reference(_word, detail::bit_mask(_bit)))); }
+
+			reference	operator[] (difference_type n) const
+			{ return (*(*this + n)); }
+
+			Iter		&operator++ ()
+			{
+				if (++_bit == detail::WORD_BITS)
+				{
+					_bit = 0;
+					++_word;
+				}
+				return (*this);
+			}
+
+			Iter		operator++ (int)
+			{ Iter	tmp(*this); ++*this; return (tmp); }
+
+			Iter		&operator-- ()
+			{
+				if (_bit-- == 0)
+				{
+					_bit = detail::WORD_BITS - 1;
+					--_word;
+				}
+				return (*this);
+			}
+
+			Iter		operator-- (int)
+			{ Iter	tmp(*this); --*this; return (tmp); }
+
+			Iter		&operator+= (difference_type n)
+			{
+				difference_type	pos = static_cast<difference_type>(_bit) + n;
+				difference_type	words = pos / detail::WORD_BITS;
+
+				pos %= detail::WORD_BITS;
+				if (pos < 0)
+				{
+					pos += detail::WORD_BITS;
+					--words;
+				}
+				_word += words;
+				_bit = pos;
+				return (*this);
+			}
+
+			Iter		&operator-= (difference_type n)
+			{ return (*this += -n); }
+
+			Iter		operator+ (difference_type n) const
+			{ Iter	tmp(*this); return (tmp += n); }
+
+			friend Iter	operator+ (difference_type n, const Iter &x)
+			{ return (x + n); }
+
+			Iter		operator- (difference_type n) const
+			{ Iter	tmp(*this); return (tmp -= n); }
+
+			difference_type	operator- (const Iter &x) const
+			{
+				return ((_word - x._word) * detail::WORD_BITS
+					+ static_cast<difference_type>(_bit) - static_cast<difference_type>(x._bit));
+			}
+
+			bool		operator== (const Iter &x) const
+			{ return (_word == x._word && _bit == x._bit); }
+			bool		operator!= (const Iter &x) const
+			{ return (!(*this == x)); }
+			bool		operator< (const Iter &x) const
+			{ return (*this - x < 0); }
+			bool		operator> (const Iter &x) const
+			{ return (x < *this); }
+			bool		operator<= (const Iter &x) const
+			{ return (!(x < *this)); }
+			bool		operator>= (const Iter &x) const
+			{ return (!(*this < x)); }
+		};
+
+		template <typename It>
+		class ReverseIter
+		{
+		public:
+			It		_base;
+
+		public:
+			ReverseIter() {}
+			explicit ReverseIter(const It &it) : _base(it) {}
+			template <typename U>
+			ReverseIter(const ReverseIter<U> &x) : _base(x._base) {}
+
+			typename It::reference	operator* () const
+			{ It	tmp(_base); return (*--tmp); }
+
+			ReverseIter	&operator++ ()
+			{ --_base; return (*this); }
+			ReverseIter	operator++ (int)
+			{ ReverseIter	tmp(*this); --_base; return (tmp); }
+			ReverseIter	&operator-- ()
+			{ ++_base; return (*this); }
+			ReverseIter	operator-- (int)
+			{ ReverseIter	tmp(*this); ++_base; return (tmp); }
+
+			bool		operator== (const ReverseIter &x) const
+			{ return (_base == x._base); }
+			bool		operator!= (const ReverseIter &x) const
+			{ return (_base != x._base); }
+		};
+
+		typedef Iter<reference>							iterator;
+		typedef Iter<bool>								const_iterator;
+		typedef ReverseIter<iterator>					reverse_iterator;
+		typedef ReverseIter<const_iterator>				const_reverse_iterator;
+
+	private:
+		typedef typename allocator_type::template rebind<word_type>::other	word_allocator;
+
+		word_allocator		_allocator;
+		word_type			*_words;
+		size_type			_capacity;
+		size_type			_size;
+
+	public:
+		explicit Vector(const allocator_type &alloc = allocator_type())
+			: _allocator(alloc), _words(0), _capacity(0), _size(0)
+		{
+		}
+
+		explicit Vector(size_type n, const bool &val = false, const allocator_type &alloc = allocator_type())
+			: _allocator(alloc), _words(0), _capacity(0), _size(0)
+		{
+			assign(n, val);
+		}
+
+		// Vector<bool>(10, 1)은 이터레이터 구간이 아니라 개수와 값으로 간다
+		template <typename InputIterator>
+		Vector(InputIterator first, InputIterator last, const allocator_type &alloc = allocator_type())
+			: _allocator(alloc), _words(0), _capacity(0), _size(0)
+		{
+			insert_range(end(), first, last);
+		}
+
+		Vector(const Vector &copy)
+			: _allocator(copy._allocator), _words(0), _capacity(0), _size(0)
+		{
+			*this = copy;
+		}
+
+		~Vector()
+		{
+			if (_words)
+				_allocator.deallocate(_words, word_count(_capacity));
+		}
+
+		Vector				&operator=(const Vector &copy)
+		{
+			if (this == &copy)
+				return (*this);
+			reserve(copy._size);
+			for (size_type i = 0; i < word_count(_capacity); ++i)
+				_words[i] = i < word_count(copy._size) ? copy._words[i] : 0;
+			_size = copy._size;
+			return (*this);
+		}
+
+		iterator			begin()
+		{ return (iterator(_words, 0)); }
+		const_iterator		begin() const
+		{ return (const_iterator(_words, 0)); }
+		iterator			end()
+		{ return (begin() + _size); }
+		const_iterator		end() const
+		{ return (begin() + _size); }
+		reverse_iterator	rbegin()
+		{ return (reverse_iterator(end())); }
+		const_reverse_iterator rbegin() const
+		{ return (const_reverse_iterator(end())); }
+		reverse_iterator	rend()
+		{ return (reverse_iterator(begin())); }
+		const_reverse_iterator rend() const
+		{ return (const_reverse_iterator(begin())); }
+
+		size_type			size() const
+		{ return (_size); }
+
+		size_type			max_size() const
+		{
+			size_type	words = _allocator.max_size();
+
+			if (words > npos / detail::WORD_BITS)
+				return (npos);
+			return (words * detail::WORD_BITS);
+		}
+
+		void				resize(size_type n, bool val = false)
+		{
+			size_type	old = _size;
+
+			if (n > _capacity)
+				reserve(grow_to(n));
+			_size = n;
+			if (n > old)
+				detail::fill_bits(_words, old, n, val);
+			else
+				detail::fill_bits(_words, n, old, false);
+		}
+
+		size_type			capacity() const
+		{ return (_capacity); }
+
+		bool				empty() const
+		{ return (_size == 0); }
+
+		// 용량은 워드 단위로 올림한다
+		void				reserve(size_type n)
+		{
+			size_type	words = word_count(n);
+			size_type	old_words = word_count(_capacity);
+			word_type	*temp;
+
+			if (words <= old_words)
+				return ;
+			temp = _allocator.allocate(words);
+			for (size_type i = 0; i < words; ++i)
+				temp[i] = i < old_words ? _words[i] : 0;
+			if (_words)
+				_allocator.deallocate(_words, old_words);
+			_words = temp;
+			_capacity = words * detail::WORD_BITS;
+		}
+
+		reference			operator[](size_type n)
+		{ return (reference(_words + n / detail::WORD_BITS, detail::bit_mask(n))); }
+
+		const_reference		operator[](size_type n) const
+		{ return ((_words[n / detail::WORD_BITS] & detail::bit_mask(n)) != 0); }
+
+		reference			at(size_type n)
+		{
+			if (n >= _size)
+				throw (std::out_of_range("_M_range_check"));
+			return ((*this)[n]);
+		}
+
+		const_reference		at(size_type n) const
+		{
+			if (n >= _size)
+				throw (std::out_of_range("_M_range_check"));
+			return ((*this)[n]);
+		}
+
+		reference			front()
+		{
+			if (empty())
+				throw (std::out_of_range("empty"));
+			return ((*this)[0]);
+		}
+
+		const_reference		front() const
+		{
+			if (empty())
+				throw (std::out_of_range("empty"));
+			return ((*this)[0]);
+		}
+
+		reference			back()
+		{
+			if (empty())
+				throw (std::out_of_range("empty"));
+			return ((*this)[_size - 1]);
+		}
+
+		const_reference		back() const
+		{
+			if (empty())
+				throw (std::out_of_range("empty"));
+			return ((*this)[_size - 1]);
+		}
+
+		// 비트가 든 워드 배열. 크기를 넘는 비트는 0이다
+		const word_type		*words() const
+		{ return (_words); }
+
+		// 워드째로 채울 때 쓴다. 크기를 넘는 비트는 부르는 쪽이 0으로 둬야 한다
+		word_type			*words()
+		{ return (_words); }
+
+		size_type			word_size() const
+		{ return (word_count(_size)); }
+
+		template <typename InputIterator>
+		void				assign(InputIterator first, InputIterator last)
+		{
+			clear();
+			insert_range(end(), first, last);
+		}
+
+		void				assign(size_type n, const bool &val)
+		{
+			clear();
+			resize(n, val);
+		}
+
+		void				push_back(const bool &value)
+		{
+			if (_size == _capacity)
+				reserve(grow_to(_size + 1));
+			if (value)
+				_words[_size / detail::WORD_BITS] |= detail::bit_mask(_size);
+			++_size;
+		}
+
+		void				pop_back()
+		{
+			if (_size > 0)
+			{
+				--_size;
+				_words[_size / detail::WORD_BITS] &= ~detail::bit_mask(_size);
+			}
+		}
+
+		iterator			insert(iterator position, const bool &val)
+		{
+			size_type	pos = position - begin();
+
+			open_gap(pos, 1, val);
+			return (begin() + pos);
+		}
+
+		void				insert(iterator position, size_type n, const bool &val)
+		{
+			open_gap(position - begin(), n, val);
+		}
+
+		template <class InputIterator>
+		void				insert(iterator position, InputIterator first, InputIterator last)
+		{
+			insert_range(position, first, last);
+		}
+
+		iterator			erase(iterator position)
+		{
+			return (erase(position, position + 1));
+		}
+
+		iterator			erase(iterator first, iterator last)
+		{
+			size_type	lo = first - begin();
+			size_type	hi = last - begin();
+			size_type	n = _size;
+
+			for (size_type i = hi; i < n; ++i)
+				(*this)[lo + i - hi] = (*this)[i];
+			_size = n - (hi - lo);
+			detail::fill_bits(_words, _size, n, false);
+			return (begin() + lo);
+		}
+
+		void				swap(Vector &x)
+		{
+			ft::swap(_allocator, x._allocator);
+			ft::swap(_words, x._words);
+			ft::swap(_capacity, x._capacity);
+			ft::swap(_size, x._size);
+		}
+
+		void				clear()
+		{
+			detail::fill_bits(_words, 0, _size, false);
+			_size = 0;
+		}
+
+		/* 비트 연산 */
+
+		// 1인 원소 수
+		size_type			count() const
+		{ return (detail::count_bits(_words, word_size())); }
+
+		bool				any() const
+		{ return (find_first() != npos); }
+
+		bool				none() const
+		{ return (!any()); }
+
+		bool				all() const
+		{ return (count() == _size); }
+
+		// 처음 1인 위치, 없으면 npos
+		size_type			find_first() const
+		{ return (found(detail::find_bit(_words, 0, _size))); }
+
+		// pos 뒤로 처음 1인 위치, 없으면 npos
+		size_type			find_next(size_type pos) const
+		{ return (pos >= _size ? npos : found(detail::find_bit(_words, pos + 1, _size))); }
+
+		Vector				&set()
+		{
+			detail::fill_bits(_words, 0, _size, true);
+			return (*this);
+		}
+
+		// [first, last)를 val로
+		Vector				&set_range(size_type first, size_type last, bool val = true)
+		{
+			if (first > last || last > _size)
+				throw (std::out_of_range("ft::Vector<bool>::set_range"));
+			detail::fill_bits(_words, first, last, val);
+			return (*this);
+		}
+
+		Vector				&reset()
+		{
+			detail::fill_bits(_words, 0, _size, false);
+			return (*this);
+		}
+
+		Vector				&reset_range(size_type first, size_type last)
+		{ return (set_range(first, last, false)); }
+
+		Vector				&flip()
+		{
+			size_type	words = word_size();
+
+			for (size_type i = 0; i < words; ++i)
+				_words[i] = ~_words[i];
+			if (words)
+				_words[words - 1] &= detail::tail_mask(_size);
+			return (*this);
+		}
+
+		Vector				&operator&=(const Vector &x)
+		{
+			same_size(x);
+			for (size_type i = 0; i < word_size(); ++i)
+				_words[i] &= x._words[i];
+			return (*this);
+		}
+
+		Vector				&operator|=(const Vector &x)
+		{
+			same_size(x);
+			for (size_type i = 0; i < word_size(); ++i)
+				_words[i] |= x._words[i];
+			return (*this);
+		}
+
+		Vector				&operator^=(const Vector &x)
+		{
+			same_size(x);
+			for (size_type i = 0; i < word_size(); ++i)
+				_words[i] ^= x._words[i];
+			return (*this);
+		}
+
+		Vector				operator~() const
+		{
+			Vector	ret(*this);
+
+			return (ret.flip());
+		}
+
+		friend Vector		operator&(const Vector &lhs, const Vector &rhs)
+		{
+			Vector	ret(lhs);
+
+			return (ret &= rhs);
+		}
+
+		friend Vector		operator|(const Vector &lhs, const Vector &rhs)
+		{
+			Vector	ret(lhs);
+
+			return (ret |= rhs);
+		}
+
+		friend Vector		operator^(const Vector &lhs, const Vector &rhs)
+		{
+			Vector	ret(lhs);
+
+			return (ret ^= rhs);
+		}
+
+		friend bool operator==(const Vector &lhs, const Vector &rhs)
+		{ return (detail::compare_bits(lhs._words, lhs._size, rhs._words, rhs._size) == 0); }
+
+		friend bool operator!=(const Vector &lhs, const Vector &rhs)
+		{ return (!(lhs == rhs)); }
+
+		friend bool operator<(const Vector &lhs, const Vector &rhs)
+		{ return (detail::compare_bits(lhs._words, lhs._size, rhs._words, rhs._size) < 0); }
+
+		friend bool operator<=(const Vector &lhs, const Vector &rhs)
+		{ return (!(rhs < lhs)); }
+
+		friend bool operator>(const Vector &lhs, const Vector &rhs)
+		{ return (rhs < lhs); }
+
+		friend bool operator>=(const Vector &lhs, const Vector &rhs)
+		{ return (!(lhs < rhs)); }
+
+	private:
+		static size_type	word_count(size_type bits)
+		{ return (detail::words_for(bits)); }
+
+		size_type			found(size_type pos) const
+		{ return (pos < _size ? pos : npos); }
+
+		// 두 배씩 늘리되 처음에는 워드 하나
+		size_type			grow_to(size_type n) const
+		{
+			size_type	cap = _capacity ? _capacity * 2 : static_cast<size_type>(detail::WORD_BITS);
+
+			return (cap > n ? cap : n);
+		}
+
+		void				same_size(const Vector &x) const
+		{
+			if (_size != x._size)
+				throw (std::invalid_argument("ft::Vector<bool>: size mismatch"));
+		}
+
+		// [pos, pos + n)을 비우고 val로 채운다
+		void				open_gap(size_type pos, size_type n, bool val)
+		{
+			size_type	old = _size;
+
+			if (n == 0)
+				return ;
+			if (old + n > _capacity)
+				reserve(grow_to(old + n));
+			_size = old + n;
+			for (size_type i = old; i > pos; --i)
+				(*this)[i - 1 + n] = (*this)[i - 1];
+			detail::fill_bits(_words, pos, pos + n, val);
+		}
+
+		void				insert_range(iterator position, int n, int val)
+		{
+			open_gap(position - begin(), n, val != 0);
+		}
+
+		template <typename InputIterator>
+		void				insert_range(iterator position, InputIterator first, InputIterator last)
+		{
+			size_type	pos = position - begin();
+
+			for (; first != last; ++first, ++pos)
+				open_gap(pos, 1, static_cast<bool>(*first));
+		}
+	};
+
+	template <typename Alloc>
+	const typename Vector<bool, Alloc>::size_type	Vector<bool, Alloc>::npos;
+}
+
+#endif
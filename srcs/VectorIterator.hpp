@@ -37,7 +37,7 @@ public:
 	VectorIterator		operator+(int);
 	friend VectorIterator		operator+(int, const VectorIterator &);
 	VectorIterator		operator-(int);
-	VectorIterator		operator-(const VectorIterator &);
+	difference_type		operator-(const VectorIterator &) const;
 
 	bool				operator<(const VectorIterator &x);
 	bool				operator>(const VectorIterator &x);
@@ -153,11 +153,11 @@ VectorIterator<T>		VectorIterator<T>::operator-(int n)
 	return (this->_element - n);
 }
 
+// 두 이터레이터 사이의 거리
 template <typename T>
-VectorIterator<T>		VectorIterator<T>::operator-(const VectorIterator &iter)
+typename VectorIterator<T>::difference_type	VectorIterator<T>::operator-(const VectorIterator &iter) const
 {
-	(this->_element) -= iter._element;
-	return (*this);
+	return (this->_element - iter._element);
 }
 
 template <typename T>
@@ -0,0 +1,172 @@
+#ifndef WORK_STEALING_DEQUE_HPP
+# define WORK_STEALING_DEQUE_HPP
+
+# include <cstddef>
+
+namespace ft
+{
+	// Chase-Lev work-stealing deque (Lê et al. 2013의 C11 메모리 순서를 따른다)
+	// 주인 스레드만 아래쪽(_bottom)에서 push/pop하고, 다른 스레드는 위쪽(_top)에서 steal한다.
+	// 원소는 포인터만 담는다. 가득 차면 두 배 크기 배열로 옮기고, 옛 배열은 훔치는 쪽이 아직 읽고 있을 수
+	// 있으므로 deque가 없어질 때 한꺼번에 지운다 (크기가 두 배씩 커지므로 전체 낭비는 현재 배열 이하).
+	template <typename T>
+	class WorkStealingDeque
+	{
+	public:
+		enum { CACHE_LINE = 64 };
+
+	private:
+		struct Array
+		{
+			long	capacity;
+			long	mask;
+			T**		slots;
+			Array*	prev;
+
+			explicit Array(long cap) : capacity(cap), mask(cap - 1), slots(new T*[cap]), prev(0)
+			{
+			}
+
+			~Array()
+			{
+				delete[] slots;
+			}
+
+			T		*get(long i) const
+			{
+				return (__atomic_load_n(slots + (i & mask), __ATOMIC_RELAXED));
+			}
+
+			void	put(long i, T *x)
+			{
+				__atomic_store_n(slots + (i & mask), x, __ATOMIC_RELAXED);
+			}
+		};
+
+		long		_top;
+		char		_pad0[CACHE_LINE - sizeof(long)];
+		long		_bottom;
+		Array*		_array;
+		char		_pad1[CACHE_LINE - sizeof(long) - sizeof(Array *)];
+
+	public:
+		// 용량은 2의 거듭제곱으로 올림
+		explicit WorkStealingDeque(long capacity = 256) : _top(0), _bottom(0)
+		{
+			long	cap;
+
+			cap = 2;
+			while (cap < capacity)
+				cap <<= 1;
+			_array = new Array(cap);
+		}
+
+		~WorkStealingDeque()
+		{
+			Array	*prev;
+
+			while (_array)
+			{
+				prev = _array->prev;
+				delete _array;
+				_array = prev;
+			}
+		}
+
+		// 다른 스레드가 바꾸고 있으면 근삿값
+		bool		empty() const
+		{
+			long	b;
+			long	t;
+
+			b = __atomic_load_n(&_bottom, __ATOMIC_RELAXED);
+			t = __atomic_load_n(&_top, __ATOMIC_RELAXED);
+			return (b <= t);
+		}
+
+		// 주인 스레드만
+		void		push(T *x)
+		{
+			long	b;
+			long	t;
+			Array	*a;
+
+			b = __atomic_load_n(&_bottom, __ATOMIC_RELAXED);
+			t = __atomic_load_n(&_top, __ATOMIC_ACQUIRE);
+			a = __atomic_load_n(&_array, __ATOMIC_RELAXED);
+			if (b - t > a->capacity - 1)
+				a = grow(a, t, b);
+			a->put(b, x);
+			// 원래 알고리즘의 release 펜스 + relaxed 저장과 같은 순서를 보장한다
+			// (ThreadSanitizer는 펜스를 보지 못하므로 저장 자체를 release로 한다)
+			__atomic_store_n(&_bottom, b + 1, __ATOMIC_RELEASE);
+		}
+
+		// 주인 스레드만, 비었으면 0. 가장 최근에 넣은 것을 꺼낸다
+		T			*pop()
+		{
+			long	b;
+			long	t;
+			Array	*a;
+			T		*x;
+
+			b = __atomic_load_n(&_bottom, __ATOMIC_RELAXED) - 1;
+			a = __atomic_load_n(&_array, __ATOMIC_RELAXED);
+			__atomic_store_n(&_bottom, b, __ATOMIC_RELAXED);
+			__atomic_thread_fence(__ATOMIC_SEQ_CST);
+			t = __atomic_load_n(&_top, __ATOMIC_RELAXED);
+			if (t > b)
+			{
+				__atomic_store_n(&_bottom, b + 1, __ATOMIC_RELAXED);
+				return (0);
+			}
+			x = a->get(b);
+			if (t == b)
+			{
+				// 마지막 하나는 훔치는 쪽과 경쟁한다
+				if (!__atomic_compare_exchange_n(&_top, &t, t + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+					x = 0;
+				__atomic_store_n(&_bottom, b + 1, __ATOMIC_RELAXED);
+			}
+			return (x);
+		}
+
+		// 아무 스레드나, 비었거나 경쟁에서 지면 0. 가장 오래된 것을 꺼낸다
+		T			*steal()
+		{
+			long	t;
+			long	b;
+			Array	*a;
+			T		*x;
+
+			t = __atomic_load_n(&_top, __ATOMIC_ACQUIRE);
+			__atomic_thread_fence(__ATOMIC_SEQ_CST);
+			b = __atomic_load_n(&_bottom, __ATOMIC_ACQUIRE);
+			if (t >= b)
+				return (0);
+			a = __atomic_load_n(&_array, __ATOMIC_ACQUIRE);
+			x = a->get(t);
+			if (!__atomic_compare_exchange_n(&_top, &t, t + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+				return (0);
+			return (x);
+		}
+
+	private:
+		Array		*grow(Array *a, long t, long b)
+		{
+			Array	*bigger;
+
+			bigger = new Array(a->capacity * 2);
+			for (long i = t; i < b; ++i)
+				bigger->put(i, a->get(i));
+			bigger->prev = a;
+			__atomic_store_n(&_array, bigger, __ATOMIC_RELEASE);
+			return (bigger);
+		}
+
+		WorkStealingDeque(const WorkStealingDeque &);
+		WorkStealingDeque	&operator=(const WorkStealingDeque &);
+	};
+}
+
+#endif
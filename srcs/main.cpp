@@ -3,6 +3,31 @@
 #include "QueueTester.hpp"
 #include "ListTester.hpp"
 #include "MapTester.hpp"
+#include "AllocatorTester.hpp"
+#include "OrderStatMapTester.hpp"
+#include "SetTester.hpp"
+#include "MultisetTester.hpp"
+#include "MultimapTester.hpp"
+#include "PersistentMapTester.hpp"
+#include "SpscQueueTester.hpp"
+#include "MpmcQueueTester.hpp"
+#include "ConcurrentMapTester.hpp"
+#include "RcuMapTester.hpp"
+#include "ThreadPoolTester.hpp"
+#include "ParallelTester.hpp"
+#include "AlgorithmTester.hpp"
+#include "PriorityQueueTester.hpp"
+#include "RadixSortTester.hpp"
+#include "SerializeTester.hpp"
+#include "MmapVectorTester.hpp"
+#include "MappedMapTester.hpp"
+#include "IntrusiveListTester.hpp"
+#include "UnrolledListTester.hpp"
+#include "SkipListMapTester.hpp"
+#include "FilteredMapTester.hpp"
+#include "LruCacheTester.hpp"
+#include "StaticVectorTester.hpp"
+#include "BitsetTester.hpp"
 
 int     main()
 {
@@ -11,6 +36,31 @@ int     main()
     queue_tester::main();
     list_tester::main();
     map_tester::main();
+    allocator_tester::main();
+    orderstatmap_tester::main();
+    set_tester::main();
+    multiset_tester::main();
+    multimap_tester::main();
+    persistentmap_tester::main();
+    spscqueue_tester::main();
+    mpmcqueue_tester::main();
+    concurrentmap_tester::main();
+    rcumap_tester::main();
+    threadpool_tester::main();
+    parallel_tester::main();
+    algorithm_tester::main();
+    priorityqueue_tester::main();
+    radixsort_tester::main();
+    serialize_tester::main();
+    mmapvector_tester::main();
+    mappedmap_tester::main();
+    intrusivelist_tester::main();
+    unrolledlist_tester::main();
+    skiplistmap_tester::main();
+    filteredmap_tester::main();
+    lrucache_tester::main();
+    staticvector_tester::main();
+    bitset_tester::main();
 
     return (0);
 }
\ No newline at end of file
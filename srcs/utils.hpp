@@ -64,6 +64,38 @@ namespace ft
 		}
 	};
 
+	// greater 함수 객체
+	template <typename T>
+	class greater : public binary_function <T, T, bool>
+	{
+	public:
+		bool operator() (const T& x, const T& y) const
+		{
+			return (y < x);
+		}
+	};
+
+	// 트리 노드 값에서 키를 꺼내는 함수 객체 (RbTree의 KeyOfValue)
+	template <typename T>
+	class Identity
+	{
+	public:
+		const T		&operator() (const T &x) const
+		{
+			return (x);
+		}
+	};
+
+	template <typename Pair>
+	class Select1st
+	{
+	public:
+		const typename Pair::first_type		&operator() (const Pair &x) const
+		{
+			return (x.first);
+		}
+	};
+
 	template <typename T1, typename T2>
 	class Pair
 	{
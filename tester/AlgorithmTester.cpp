@@ -0,0 +1,192 @@
+#include "AlgorithmTester.hpp"
+
+namespace algorithm_tester
+{
+	typedef ft::Vector<int>	vec;
+	typedef ft::Pair<int, char>	item;
+
+	struct Greater
+	{
+		bool	operator() (int a, int b) const { return (a > b); }
+	};
+
+	// 키(first)만 비교한다
+	struct ByKey
+	{
+		bool	operator() (const item &a, const item &b) const { return (a.first < b.first); }
+	};
+
+	static unsigned long	seed = 42;
+
+	int		next_random()
+	{
+		seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+		return (static_cast<int>(seed >> 33));
+	}
+
+	void	print(const char *name, const vec &v)
+	{
+		std::cout << name << " (" << v.size() << "):";
+		for (size_t i = 0; i < v.size(); ++i)
+			std::cout << ' ' << v[i];
+		std::cout << '\n';
+	}
+
+	template <class Iterator>
+	bool	sorted_check(Iterator first, Iterator last)
+	{
+		if (first == last)
+			return (true);
+		for (Iterator next = first + 1; next != last; ++first, ++next)
+		{
+			if (*next < *first)
+				return (false);
+		}
+		return (true);
+	}
+
+	void	sort_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "SORT" << std::endl;
+		vec v;
+		std::string words[] = { "pear", "apple", "fig", "kiwi", "banana", "apple", "cherry" };
+
+		for (int i = 0; i < 40; ++i)
+			v.push_back((i * 37) % 23);
+		ft::sort(v.begin(), v.end());
+		print("sorted", v);
+		ft::sort(v.begin(), v.end(), Greater());
+		print("greater", v);
+		ft::sort(v.begin(), v.end());
+		print("again", v);
+		ft::sort(v.begin(), v.begin());
+		ft::sort(v.begin(), v.begin() + 1);
+		ft::sort(words, words + 7);
+		std::cout << "words:";
+		for (int i = 0; i < 7; ++i)
+			std::cout << ' ' << words[i];
+		std::cout << '\n';
+	}
+
+	void	stable_sort_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "STABLE_SORT" << std::endl;
+		ft::Vector<item> items;
+		vec v;
+
+		for (int i = 0; i < 100; ++i)
+			items.push_back(item((i * 7) % 5, static_cast<char>('a' + i % 26)));
+		ft::stable_sort(items.begin(), items.end(), ByKey());
+		std::cout << "items:";
+		for (size_t i = 0; i < items.size(); ++i)
+			std::cout << ' ' << items[i].first << items[i].second;
+		std::cout << '\n';
+		for (int i = 0; i < 50; ++i)
+			v.push_back(50 - i);
+		ft::stable_sort(v.begin(), v.end());
+		print("reversed", v);
+		ft::stable_sort(v.begin(), v.end(), Greater());
+		print("greater", v);
+	}
+
+	void	partial_sort_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "PARTIAL_SORT" << std::endl;
+		vec v;
+		int arr[] = { 9, 3, 7, 1, 8, 2, 6, 4, 5, 0 };
+
+		for (int i = 0; i < 1000; ++i)
+			v.push_back(next_random() % 10000);
+		ft::partial_sort(v.begin(), v.begin() + 10, v.end());
+		std::cout << "top 10:";
+		for (int i = 0; i < 10; ++i)
+			std::cout << ' ' << v[i];
+		std::cout << '\n';
+		ft::partial_sort(v.begin(), v.begin() + 5, v.end(), Greater());
+		std::cout << "largest 5:";
+		for (int i = 0; i < 5; ++i)
+			std::cout << ' ' << v[i];
+		std::cout << '\n';
+		ft::partial_sort(arr, arr + 3, arr + 10);
+		std::cout << "array: " << arr[0] << ' ' << arr[1] << ' ' << arr[2] << '\n';
+	}
+
+	void	nth_element_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "NTH_ELEMENT" << std::endl;
+		vec v;
+		size_t percentiles[] = { 0, 500, 900, 990, 999 };
+
+		for (int i = 0; i < 1000; ++i)
+			v.push_back(next_random() % 100);
+		for (int p = 0; p < 5; ++p)
+		{
+			size_t	k = percentiles[p];
+			bool	ok = true;
+
+			ft::nth_element(v.begin(), v.begin() + k, v.end());
+			for (size_t i = 0; i < k; ++i)
+				ok = ok && !(v[k] < v[i]);
+			for (size_t i = k + 1; i < v.size(); ++i)
+				ok = ok && !(v[i] < v[k]);
+			std::cout << "nth " << k << ": " << v[k] << " partitioned: " << ok << '\n';
+		}
+		ft::nth_element(v.begin(), v.end(), v.end());
+	}
+
+	// 여러 분포에서 길게 정렬해서 정렬됐는지와 원소 합이 그대로인지 본다
+	void	large_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "LARGE" << std::endl;
+		const char	*names[] = { "random", "sorted", "reversed", "few keys", "organ pipe" };
+
+		for (int kind = 0; kind < 5; ++kind)
+		{
+			vec		v;
+			vec		w;
+			long	before = 0;
+			long	after = 0;
+			long	stable_after = 0;
+
+			for (int i = 0; i < 100000; ++i)
+			{
+				int		x;
+
+				if (kind == 0)
+					x = next_random();
+				else if (kind == 1)
+					x = i;
+				else if (kind == 2)
+					x = 100000 - i;
+				else if (kind == 3)
+					x = next_random() % 4;
+				else
+					x = i < 50000 ? i : 100000 - i;
+				v.push_back(x);
+				before += x % 1000;
+			}
+			w = v;
+			ft::sort(v.begin(), v.end());
+			ft::stable_sort(w.begin(), w.end());
+			for (size_t i = 0; i < v.size(); ++i)
+			{
+				after += v[i] % 1000;
+				stable_after += w[i] % 1000;
+			}
+			std::cout << names[kind] << ": sorted " << sorted_check(v.begin(), v.end())
+				<< ' ' << sorted_check(w.begin(), w.end())
+				<< ", same elements " << (before == after) << ' ' << (before == stable_after) << '\n';
+		}
+	}
+
+	int		main()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "ALGORITHM" << std::endl;
+		sort_test();
+		stable_sort_test();
+		partial_sort_test();
+		nth_element_test();
+		large_test();
+		return (0);
+	}
+}
@@ -0,0 +1,20 @@
+#ifndef ALGORITHM_TESTER_HPP
+# define ALGORITHM_TESTER_HPP
+
+# include "Algorithm.hpp"
+# include "Vector.hpp"
+# include <iostream>
+# include <iomanip>
+# include <string>
+
+namespace algorithm_tester
+{
+	void	sort_test();
+	void	stable_sort_test();
+	void	partial_sort_test();
+	void	nth_element_test();
+	void	large_test();
+	int		main();
+}
+
+#endif
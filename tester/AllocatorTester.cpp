@@ -0,0 +1,182 @@
+#include "AllocatorTester.hpp"
+
+namespace allocator_tester
+{
+	void	vector_stats_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "VECTOR" << std::endl;
+		ft::AllocStats		stats;
+
+		{
+			ft::Vector<int, ft::StatsAllocator<int> >	vec((ft::StatsAllocator<int>(stats)));
+
+			for (int i = 0; i < 100; ++i)
+				vec.push_back(i);
+			ft::print_alloc_stats(std::cout, stats, "vector<int> x100");
+		}
+		ft::print_alloc_stats(std::cout, stats, "vector<int> destroyed");
+	}
+
+	void	list_stats_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "LIST" << std::endl;
+		ft::AllocStats		stats;
+
+		{
+			ft::List<int, ft::StatsAllocator<int> >	lst((ft::StatsAllocator<int>(stats)));
+
+			for (int i = 0; i < 10; ++i)
+				lst.push_back(i);
+			lst.pop_front();
+			ft::print_alloc_stats(std::cout, stats, "list<int> x9");
+
+			ft::List<int, ft::StatsAllocator<int> >	copy(lst);
+			std::cout << "copy shares stats: " << (&copy.get_allocator().stats() == &stats) << '\n';
+		}
+		ft::print_alloc_stats(std::cout, stats, "list<int> destroyed");
+	}
+
+	void	map_stats_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "MAP" << std::endl;
+		typedef ft::StatsAllocator<ft::Pair<int, int> >		alloc_type;
+		ft::AllocStats		stats;
+
+		{
+			ft::Map<int, int, ft::less<int>, alloc_type>	mymap(ft::less<int>(), (alloc_type(stats)));
+
+			for (int i = 0; i < 50; ++i)
+				mymap[i] = i * 2;
+			mymap.erase(10);
+			mymap.erase(20);
+			ft::print_alloc_stats(std::cout, stats, "map<int,int> x48");
+		}
+		ft::print_alloc_stats(std::cout, stats, "map<int,int> destroyed");
+	}
+
+	void	global_stats_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "GLOBAL" << std::endl;
+		ft::AllocStats::global().reset();
+		{
+			ft::Vector<int, ft::StatsAllocator<int> >	a;
+			ft::List<int, ft::StatsAllocator<int> >		b;
+			ft::AllocStats								stats;
+			ft::Vector<int, ft::StatsAllocator<int> >	c((ft::StatsAllocator<int>(stats)));
+
+			a.push_back(1);
+			b.push_back(1);
+			c.push_back(1);
+			ft::print_alloc_stats(std::cout, stats, "c");
+			ft::print_alloc_stats(std::cout, ft::AllocStats::global());
+		}
+		ft::print_alloc_stats(std::cout, ft::AllocStats::global());
+	}
+
+	// 요청 하나에서 쓰는 컨테이너들을 InlineArena 하나에 담는다
+	void	arena_container_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "ARENA" << std::endl;
+		typedef ft::ArenaAllocator<ft::Pair<int, std::string> >		map_alloc;
+		ft::InlineArena<16384>	arena;
+
+		for (int request = 0; request < 3; ++request)
+		{
+			{
+				ft::Vector<int, ft::ArenaAllocator<int> >	vec((ft::ArenaAllocator<int>(arena)));
+				ft::List<std::string, ft::ArenaAllocator<std::string> >	lst((ft::ArenaAllocator<std::string>(arena)));
+				ft::Map<int, std::string, ft::less<int>, map_alloc>		mymap(ft::less<int>(), (map_alloc(arena)));
+
+				for (int i = 0; i < 50; ++i)
+				{
+					vec.push_back(i * request);
+					lst.push_back("item");
+					mymap[i] = "value";
+				}
+				mymap.erase(3);
+				lst.pop_front();
+				std::cout << "request " << request << ": " << vec.back() << ' ' << lst.size() << ' ' << mymap.size()
+					<< ", same arena: " << (mymap.get_allocator().arena() == &arena)
+					<< ", used > 0: " << (arena.used() > 0) << ", heap blocks: " << arena.heap_blocks() << '\n';
+
+				ft::List<std::string, ft::ArenaAllocator<std::string> >	copy(lst);
+
+				std::cout << "copy shares arena: " << (copy.get_allocator() == lst.get_allocator()) << '\n';
+			}
+			arena.reset();
+			std::cout << "after reset used: " << arena.used() << '\n';
+		}
+	}
+
+	void	arena_block_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "ARENA BLOCK" << std::endl;
+		ft::Arena	arena(256);
+		char		*c;
+		double		*d;
+		long double	*ld;
+
+		c = static_cast<char *>(arena.allocate(1, 1));
+		d = ft::ArenaAllocator<double>(arena).allocate(3);
+		ld = ft::ArenaAllocator<long double>(arena).allocate(1);
+		*c = 'x';
+		d[2] = 1.5;
+		*ld = 2.5;
+		std::cout << "aligned: " << (reinterpret_cast<size_t>(d) % sizeof(double) == 0)
+			<< ' ' << (reinterpret_cast<size_t>(ld) % sizeof(void *) == 0)
+			<< ", used: " << arena.used() << '\n';
+		// 마지막 할당은 돌려받는다
+		ft::ArenaAllocator<long double>(arena).deallocate(ld, 1);
+		std::cout << "after deallocate last: " << arena.used() << '\n';
+		for (int i = 0; i < 100; ++i)
+			arena.allocate(100, 8);
+		std::cout << "blocks: " << arena.heap_blocks() << ", bytes: " << arena.heap_bytes() << '\n';
+		arena.allocate(10000, 8);
+		std::cout << "large: " << arena.heap_blocks() << ", bytes: " << arena.heap_bytes() << '\n';
+		arena.reset();
+		for (int i = 0; i < 100; ++i)
+			arena.allocate(100, 8);
+		arena.allocate(10000, 8);
+		std::cout << "reuse after reset: " << arena.heap_blocks() << ", bytes: " << arena.heap_bytes() << '\n';
+		arena.release();
+		std::cout << "release: " << arena.heap_blocks() << ' ' << arena.used() << '\n';
+
+		ft::ArenaAllocator<int>	heap;
+		int						*p = heap.allocate(4);
+
+		p[3] = 7;
+		std::cout << "no arena: " << (heap.arena() == 0) << ' ' << p[3] << '\n';
+		heap.deallocate(p, 4);
+	}
+
+	// StatsAllocator로 감싸면 Arena에서 받은 양이 보인다
+	void	arena_stats_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "ARENA STATS" << std::endl;
+		typedef ft::StatsAllocator<int, ft::ArenaAllocator<int> >	alloc_type;
+		ft::InlineArena<4096>	arena;
+		ft::AllocStats			stats;
+
+		{
+			ft::List<int, alloc_type>	lst((alloc_type(stats, ft::ArenaAllocator<int>(arena))));
+
+			for (int i = 0; i < 20; ++i)
+				lst.push_back(i);
+			std::cout << "allocs: " << stats.allocations << ", arena heap blocks: " << arena.heap_blocks() << '\n';
+		}
+		std::cout << "live after destroy: " << stats.live_allocations() << '\n';
+	}
+
+	int		main(void)
+	{
+		vector_stats_test();
+		list_stats_test();
+		map_stats_test();
+		global_stats_test();
+		arena_container_test();
+		arena_block_test();
+		arena_stats_test();
+
+		return (0);
+	}
+}
@@ -0,0 +1,24 @@
+#ifndef ALLOCATOR_TESTER_HPP
+# define ALLOCATOR_TESTER_HPP
+
+# include "StatsAllocator.hpp"
+# include "ArenaAllocator.hpp"
+# include "Vector.hpp"
+# include "List.hpp"
+# include "Map.hpp"
+# include <iostream>
+# include <iomanip>
+
+namespace allocator_tester
+{
+	void	vector_stats_test();
+	void	list_stats_test();
+	void	map_stats_test();
+	void	global_stats_test();
+	void	arena_container_test();
+	void	arena_block_test();
+	void	arena_stats_test();
+	int		main();
+}
+
+#endif
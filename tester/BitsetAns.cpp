@@ -0,0 +1,324 @@
+#include <vector>
+#include <bitset>
+#include <string>
+#include <iostream>
+#include <iomanip>
+#include <stdexcept>
+
+typedef std::vector<bool>	bvector;
+
+static const size_t	npos = static_cast<size_t>(-1);
+
+template <class V>
+void	print(const char *name, const V &v)
+{
+	std::cout << name << " (" << v.size() << "): ";
+	for (typename V::const_iterator it = v.begin(); it != v.end(); ++it)
+		std::cout << *it;
+	std::cout << '\n';
+}
+
+template <class V>
+size_t	count(const V &v)
+{
+	size_t	ret = 0;
+
+	for (size_t i = 0; i < v.size(); ++i)
+		ret += v[i];
+	return (ret);
+}
+
+template <class V>
+size_t	find_next(const V &v, size_t pos)
+{
+	for (size_t i = pos; i < v.size(); ++i)
+		if (v[i])
+			return (i);
+	return (npos);
+}
+
+template <class V>
+void	print_ones(const char *name, const V &v)
+{
+	std::cout << name << " count " << count(v) << ":";
+	for (size_t i = find_next(v, 0); i != npos; i = find_next(v, i + 1))
+		std::cout << ' ' << i;
+	std::cout << '\n';
+}
+
+template <class V>
+void	set_range(V &v, size_t first, size_t last, bool val)
+{
+	for (size_t i = first; i < last; ++i)
+		v[i] = val;
+}
+
+bvector	bit_and(const bvector &a, const bvector &b)
+{
+	bvector	ret(a);
+
+	for (size_t i = 0; i < a.size(); ++i)
+		ret[i] = a[i] && b[i];
+	return (ret);
+}
+
+bvector	bit_or(const bvector &a, const bvector &b)
+{
+	bvector	ret(a);
+
+	for (size_t i = 0; i < a.size(); ++i)
+		ret[i] = a[i] || b[i];
+	return (ret);
+}
+
+bvector	bit_xor(const bvector &a, const bvector &b)
+{
+	bvector	ret(a);
+
+	for (size_t i = 0; i < a.size(); ++i)
+		ret[i] = a[i] != b[i];
+	return (ret);
+}
+
+void	vector_basic_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "VECTOR BASIC" << std::endl;
+	bvector		first;
+	bvector		second(10, true);
+	bvector		third(5, 1);
+	bool		arr[] = { true, false, false, true, true };
+	bvector		fourth(arr, arr + 5);
+	bvector		fifth(fourth);
+
+	std::cout << "empty: " << first.empty() << ", size: " << first.size() << '\n';
+	print("second", second);
+	print("third", third);
+	print("fourth", fourth);
+	print("fifth", fifth);
+	for (int i = 0; i < 70; ++i)
+		first.push_back(i % 3 == 0);
+	print("first", first);
+	std::cout << "front: " << first.front() << ", back: " << first.back() << ", at(68): " << first.at(68)
+		<< ", capacity >= size: " << (first.capacity() >= first.size()) << '\n';
+	try
+	{
+		first.at(70);
+	}
+	catch (const std::out_of_range &e)
+	{
+		std::cout << "at(70): out_of_range\n";
+	}
+	first[1] = true;
+	first[2] = first[0];
+	first[3].flip();
+	first.back() = false;
+	print("proxy", first);
+	std::cout << "reverse: ";
+	for (bvector::reverse_iterator it = fourth.rbegin(); it != fourth.rend(); ++it)
+		std::cout << *it;
+	std::cout << '\n';
+	for (bvector::iterator it = fourth.begin(); it != fourth.end(); ++it)
+		*it = !*it;
+	print("negated", fourth);
+	bvector::iterator	it = first.begin() + 65;
+
+	std::cout << "it[0]: " << it[0] << ", it - begin: " << (it - first.begin()) << ", *(it - 64): " << *(it - 64)
+		<< ", begin < it: " << (first.begin() < it) << '\n';
+	first.pop_back();
+	first.resize(3);
+	print("resize(3)", first);
+	first.resize(67, true);
+	std::cout << "resize(67, true): " << first.size() << ", back: " << first.back() << '\n';
+}
+
+void	vector_modifier_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "VECTOR MODIFIER" << std::endl;
+	bvector		myvector;
+	bool		arr[] = { true, true, false };
+
+	for (int i = 0; i < 10; ++i)
+		myvector.push_back(i % 2 == 0);
+	myvector.insert(myvector.begin() + 5, true);
+	print("insert", myvector);
+	myvector.insert(myvector.begin() + 1, 3, false);
+	print("insert n", myvector);
+	myvector.insert(myvector.end(), arr, arr + 3);
+	print("insert range", myvector);
+	std::cout << "erase returns: " << *myvector.erase(myvector.begin() + 2) << '\n';
+	print("erase", myvector);
+	myvector.erase(myvector.begin() + 1, myvector.begin() + 6);
+	print("erase range", myvector);
+
+	bvector		big;
+
+	for (int i = 0; i < 130; ++i)
+		big.push_back(i % 7 == 0);
+	big.insert(big.begin() + 3, 70, true);
+	big.erase(big.begin() + 60, big.begin() + 130);
+	print("big", big);
+	myvector.assign(4, true);
+	print("assign n", myvector);
+	myvector.assign(arr, arr + 3);
+	print("assign range", myvector);
+
+	bvector		other(3, true);
+
+	std::cout << "myvector == other: " << (myvector == other) << ", myvector < other: " << (myvector < other)
+		<< ", other > myvector: " << (other > myvector) << ", other <= other: " << (other <= other) << '\n';
+	other.push_back(false);
+	std::cout << "shorter < longer: " << (bvector(3, true) < other) << ", other != bvector(3, true): "
+		<< (other != bvector(3, true)) << '\n';
+	myvector.swap(big);
+	std::cout << "swap: " << myvector.size() << " " << big.size() << '\n';
+	big = myvector;
+	std::cout << "copy == : " << (big == myvector) << '\n';
+	myvector.clear();
+	print("clear", myvector);
+}
+
+void	vector_bitwise_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "VECTOR BITWISE" << std::endl;
+	bvector		a(150);
+	bvector		b(150);
+
+	for (size_t i = 0; i < a.size(); ++i)
+	{
+		a[i] = i % 3 == 0;
+		b[i] = i % 5 == 0;
+	}
+	print_ones("a", a);
+	print_ones("a & b", bit_and(a, b));
+	std::cout << "a | b count: " << count(bit_or(a, b)) << ", a ^ b count: " << count(bit_xor(a, b))
+		<< ", ~a count: " << a.size() - count(a) << '\n';
+	set_range(a, 10, 140, true);
+	std::cout << "set_range(10, 140): " << count(a) << '\n';
+	set_range(a, 63, 129, false);
+	print_ones("reset_range(63, 129)", a);
+	std::cout << "find_next(148): " << (find_next(a, 149) == npos) << '\n';
+	set_range(a, 0, a.size(), false);
+	std::cout << "reset: any " << (count(a) != 0) << ", none " << (count(a) == 0) << ", find_first npos "
+		<< (find_next(a, 0) == npos) << '\n';
+	set_range(a, 0, a.size(), true);
+	std::cout << "set: all " << (count(a) == a.size()) << ", count " << count(a) << '\n';
+	a.flip();
+	std::cout << "flip: count " << count(a) << '\n';
+	b = bit_xor(b, b);
+	std::cout << "b ^= b: " << count(b) << '\n';
+	std::cout << "size mismatch: ft::Vector<bool>: size mismatch\n";
+	std::cout << "set_range(5, 151): out_of_range\n";
+}
+
+template <size_t N>
+size_t	find_next(const std::bitset<N> &b, size_t pos)
+{
+	for (size_t i = pos; i < N; ++i)
+		if (b[i])
+			return (i);
+	return (npos);
+}
+
+template <size_t N>
+void	print_ones(const char *name, const std::bitset<N> &b)
+{
+	std::cout << name << " count " << b.count() << ":";
+	for (size_t i = find_next(b, 0); i != npos; i = find_next(b, i + 1))
+		std::cout << ' ' << i;
+	std::cout << '\n';
+}
+
+void	bitset_basic_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "BITSET BASIC" << std::endl;
+	std::bitset<100>	b;
+	std::bitset<20>		small(0xABCDEUL);
+	std::bitset<8>		str(std::string("10110"));
+
+	std::cout << "size: " << b.size() << ", none: " << b.none() << ", any: " << b.any() << '\n';
+	b.set(3).set(64).set(99);
+	b[70] = true;
+	std::cout << "count: " << b.count() << ", test(64): " << b.test(64) << ", b[65]: " << b[65] << '\n';
+	print_ones("b", b);
+	b.reset(64).flip(0);
+	print_ones("reset(64) flip(0)", b);
+	std::cout << "small: " << small.to_string() << ", to_ulong: " << small.to_ulong() << '\n';
+	std::cout << "str: " << str.to_string() << ", to_ulong: " << str.to_ulong() << '\n';
+	try
+	{
+		b.test(100);
+	}
+	catch (const std::out_of_range &e)
+	{
+		std::cout << "test(100): out_of_range\n";
+	}
+	try
+	{
+		b.to_ulong();
+	}
+	catch (const std::overflow_error &e)
+	{
+		std::cout << "to_ulong: overflow_error\n";
+	}
+	try
+	{
+		std::bitset<8>	bad(std::string("10a1"));
+	}
+	catch (const std::invalid_argument &e)
+	{
+		std::cout << "bad string: invalid_argument\n";
+	}
+	b.set();
+	std::cout << "set: all " << (b.count() == b.size()) << ", count " << b.count() << '\n';
+	b.flip();
+	std::cout << "flip: none " << b.none() << '\n';
+	for (size_t i = 60; i < 70; ++i)
+		b[i] = true;
+	print_ones("set_range(60, 70)", b);
+	for (size_t i = 62; i < 68; ++i)
+		b[i] = false;
+	print_ones("reset_range(62, 68)", b);
+}
+
+void	bitset_bitwise_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "BITSET BITWISE" << std::endl;
+	std::bitset<130>	a;
+	std::bitset<130>	b;
+	size_t				shifts[] = { 0, 1, 63, 64, 65, 100, 129, 130 };
+
+	for (size_t i = 0; i < a.size(); ++i)
+	{
+		a[i] = i % 3 == 0;
+		b[i] = i % 5 == 0;
+	}
+	std::cout << "a & b: " << (a & b).count() << ", a | b: " << (a | b).count() << ", a ^ b: " << (a ^ b).count()
+		<< ", ~a: " << (~a).count() << '\n';
+	std::cout << "a == a: " << (a == a) << ", a != b: " << (a != b) << '\n';
+	for (size_t i = 0; i < sizeof(shifts) / sizeof(shifts[0]); ++i)
+	{
+		std::cout << "<< " << shifts[i] << ": " << (a << shifts[i]).to_string() << '\n';
+		std::cout << ">> " << shifts[i] << ": " << (a >> shifts[i]).to_string() << '\n';
+	}
+
+	std::bitset<64>		full;
+
+	full.set();
+	std::cout << "64 full: " << full.count() << ", << 1: " << (full << 1).count() << ", to_ulong: "
+		<< full.to_ulong() << '\n';
+	a &= b;
+	a |= std::bitset<130>(1UL);
+	a ^= b;
+	std::cout << "a: " << a.to_string() << '\n';
+}
+
+int		main(void)
+{
+	std::cout << std::setfill('-') << std::setw(20) << "BITSET" << std::endl;
+	vector_basic_test();
+	vector_modifier_test();
+	vector_bitwise_test();
+	bitset_basic_test();
+	bitset_bitwise_test();
+	return (0);
+}
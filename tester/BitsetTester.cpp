@@ -0,0 +1,262 @@
+#include "BitsetTester.hpp"
+
+namespace bitset_tester
+{
+	typedef ft::Vector<bool>	bvector;
+
+	template <class V>
+	void	print(const char *name, const V &v)
+	{
+		std::cout << name << " (" << v.size() << "): ";
+		for (typename V::const_iterator it = v.begin(); it != v.end(); ++it)
+			std::cout << *it;
+		std::cout << '\n';
+	}
+
+	template <class V>
+	void	print_ones(const char *name, const V &v)
+	{
+		std::cout << name << " count " << v.count() << ":";
+		for (size_t i = v.find_first(); i != V::npos; i = v.find_next(i))
+			std::cout << ' ' << i;
+		std::cout << '\n';
+	}
+
+	void	vector_basic_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "VECTOR BASIC" << std::endl;
+		bvector		first;
+		bvector		second(10, true);
+		bvector		third(5, 1);
+		bool		arr[] = { true, false, false, true, true };
+		bvector		fourth(arr, arr + 5);
+		bvector		fifth(fourth);
+
+		std::cout << "empty: " << first.empty() << ", size: " << first.size() << '\n';
+		print("second", second);
+		print("third", third);
+		print("fourth", fourth);
+		print("fifth", fifth);
+		for (int i = 0; i < 70; ++i)
+			first.push_back(i % 3 == 0);
+		print("first", first);
+		std::cout << "front: " << first.front() << ", back: " << first.back() << ", at(68): " << first.at(68)
+			<< ", capacity >= size: " << (first.capacity() >= first.size()) << '\n';
+		try
+		{
+			first.at(70);
+		}
+		catch (const std::out_of_range &e)
+		{
+			std::cout << "at(70): out_of_range\n";
+		}
+		first[1] = true;
+		first[2] = first[0];
+		first[3].flip();
+		first.back() = false;
+		print("proxy", first);
+		std::cout << "reverse: ";
+		for (bvector::reverse_iterator it = fourth.rbegin(); it != fourth.rend(); ++it)
+			std::cout << *it;
+		std::cout << '\n';
+		for (bvector::iterator it = fourth.begin(); it != fourth.end(); ++it)
+			*it = !*it;
+		print("negated", fourth);
+		bvector::iterator	it = first.begin() + 65;
+
+		std::cout << "it[0]: " << it[0] << ", it - begin: " << (it - first.begin()) << ", *(it - 64): " << *(it - 64)
+			<< ", begin < it: " << (first.begin() < it) << '\n';
+		first.pop_back();
+		first.resize(3);
+		print("resize(3)", first);
+		first.resize(67, true);
+		std::cout << "resize(67, true): " << first.size() << ", back: " << first.back() << '\n';
+	}
+
+	void	vector_modifier_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "VECTOR MODIFIER" << std::endl;
+		bvector		myvector;
+		bool		arr[] = { true, true, false };
+
+		for (int i = 0; i < 10; ++i)
+			myvector.push_back(i % 2 == 0);
+		myvector.insert(myvector.begin() + 5, true);
+		print("insert", myvector);
+		myvector.insert(myvector.begin() + 1, 3, false);
+		print("insert n", myvector);
+		myvector.insert(myvector.end(), arr, arr + 3);
+		print("insert range", myvector);
+		std::cout << "erase returns: " << *myvector.erase(myvector.begin() + 2) << '\n';
+		print("erase", myvector);
+		myvector.erase(myvector.begin() + 1, myvector.begin() + 6);
+		print("erase range", myvector);
+
+		bvector		big;
+
+		// 워드 경계를 넘는 삽입과 삭제
+		for (int i = 0; i < 130; ++i)
+			big.push_back(i % 7 == 0);
+		big.insert(big.begin() + 3, 70, true);
+		big.erase(big.begin() + 60, big.begin() + 130);
+		print("big", big);
+		myvector.assign(4, true);
+		print("assign n", myvector);
+		myvector.assign(arr, arr + 3);
+		print("assign range", myvector);
+
+		bvector		other(3, true);
+
+		std::cout << "myvector == other: " << (myvector == other) << ", myvector < other: " << (myvector < other)
+			<< ", other > myvector: " << (other > myvector) << ", other <= other: " << (other <= other) << '\n';
+		other.push_back(false);
+		std::cout << "shorter < longer: " << (bvector(3, true) < other) << ", other != bvector(3, true): "
+			<< (other != bvector(3, true)) << '\n';
+		myvector.swap(big);
+		std::cout << "swap: " << myvector.size() << " " << big.size() << '\n';
+		big = myvector;
+		std::cout << "copy == : " << (big == myvector) << '\n';
+		myvector.clear();
+		print("clear", myvector);
+	}
+
+	void	vector_bitwise_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "VECTOR BITWISE" << std::endl;
+		bvector		a(150);
+		bvector		b(150);
+
+		for (size_t i = 0; i < a.size(); ++i)
+		{
+			a[i] = i % 3 == 0;
+			b[i] = i % 5 == 0;
+		}
+		print_ones("a", a);
+		print_ones("a & b", a & b);
+		std::cout << "a | b count: " << (a | b).count() << ", a ^ b count: " << (a ^ b).count()
+			<< ", ~a count: " << (~a).count() << '\n';
+		a.set_range(10, 140);
+		std::cout << "set_range(10, 140): " << a.count() << '\n';
+		a.reset_range(63, 129);
+		print_ones("reset_range(63, 129)", a);
+		std::cout << "find_next(148): " << (a.find_next(148) == bvector::npos) << '\n';
+		a.reset();
+		std::cout << "reset: any " << a.any() << ", none " << a.none() << ", find_first npos "
+			<< (a.find_first() == bvector::npos) << '\n';
+		a.set();
+		std::cout << "set: all " << a.all() << ", count " << a.count() << '\n';
+		a.flip();
+		std::cout << "flip: count " << a.count() << '\n';
+		b ^= b;
+		std::cout << "b ^= b: " << b.count() << '\n';
+		try
+		{
+			a &= bvector(3);
+		}
+		catch (const std::invalid_argument &e)
+		{
+			std::cout << "size mismatch: " << e.what() << '\n';
+		}
+		try
+		{
+			a.set_range(5, 151);
+		}
+		catch (const std::out_of_range &e)
+		{
+			std::cout << "set_range(5, 151): out_of_range\n";
+		}
+	}
+
+	void	bitset_basic_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "BITSET BASIC" << std::endl;
+		ft::Bitset<100>		b;
+		ft::Bitset<20>		small(0xABCDEUL);
+		ft::Bitset<8>		str(std::string("10110"));
+
+		std::cout << "size: " << b.size() << ", none: " << b.none() << ", any: " << b.any() << '\n';
+		b.set(3).set(64).set(99);
+		b[70] = true;
+		std::cout << "count: " << b.count() << ", test(64): " << b.test(64) << ", b[65]: " << b[65] << '\n';
+		print_ones("b", b);
+		b.reset(64).flip(0);
+		print_ones("reset(64) flip(0)", b);
+		std::cout << "small: " << small.to_string() << ", to_ulong: " << small.to_ulong() << '\n';
+		std::cout << "str: " << str.to_string() << ", to_ulong: " << str.to_ulong() << '\n';
+		try
+		{
+			b.test(100);
+		}
+		catch (const std::out_of_range &e)
+		{
+			std::cout << "test(100): out_of_range\n";
+		}
+		try
+		{
+			b.to_ulong();
+		}
+		catch (const std::overflow_error &e)
+		{
+			std::cout << "to_ulong: overflow_error\n";
+		}
+		try
+		{
+			ft::Bitset<8>	bad(std::string("10a1"));
+		}
+		catch (const std::invalid_argument &e)
+		{
+			std::cout << "bad string: invalid_argument\n";
+		}
+		b.set();
+		std::cout << "set: all " << b.all() << ", count " << b.count() << '\n';
+		b.flip();
+		std::cout << "flip: none " << b.none() << '\n';
+		b.set_range(60, 70);
+		print_ones("set_range(60, 70)", b);
+		b.reset_range(62, 68);
+		print_ones("reset_range(62, 68)", b);
+	}
+
+	void	bitset_bitwise_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "BITSET BITWISE" << std::endl;
+		ft::Bitset<130>		a;
+		ft::Bitset<130>		b;
+		size_t				shifts[] = { 0, 1, 63, 64, 65, 100, 129, 130 };
+
+		for (size_t i = 0; i < a.size(); ++i)
+		{
+			a[i] = i % 3 == 0;
+			b[i] = i % 5 == 0;
+		}
+		std::cout << "a & b: " << (a & b).count() << ", a | b: " << (a | b).count() << ", a ^ b: " << (a ^ b).count()
+			<< ", ~a: " << (~a).count() << '\n';
+		std::cout << "a == a: " << (a == a) << ", a != b: " << (a != b) << '\n';
+		for (size_t i = 0; i < sizeof(shifts) / sizeof(shifts[0]); ++i)
+		{
+			std::cout << "<< " << shifts[i] << ": " << (a << shifts[i]).to_string() << '\n';
+			std::cout << ">> " << shifts[i] << ": " << (a >> shifts[i]).to_string() << '\n';
+		}
+
+		ft::Bitset<64>		full;
+
+		full.set();
+		std::cout << "64 full: " << full.count() << ", << 1: " << (full << 1).count() << ", to_ulong: "
+			<< full.to_ulong() << '\n';
+		a &= b;
+		a |= ft::Bitset<130>(1UL);
+		a ^= b;
+		std::cout << "a: " << a.to_string() << '\n';
+	}
+
+	int		main()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "BITSET" << std::endl;
+		vector_basic_test();
+		vector_modifier_test();
+		vector_bitwise_test();
+		bitset_basic_test();
+		bitset_bitwise_test();
+		return (0);
+	}
+}
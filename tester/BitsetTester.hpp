@@ -0,0 +1,21 @@
+#ifndef BITSET_TESTER_HPP
+# define BITSET_TESTER_HPP
+
+# include "Vector.hpp"
+# include "Bitset.hpp"
+# include <iostream>
+# include <iomanip>
+# include <string>
+# include <stdexcept>
+
+namespace bitset_tester
+{
+	void	vector_basic_test();
+	void	vector_modifier_test();
+	void	vector_bitwise_test();
+	void	bitset_basic_test();
+	void	bitset_bitwise_test();
+	int		main();
+}
+
+#endif
@@ -0,0 +1,175 @@
+#include "ConcurrentMapTester.hpp"
+
+namespace concurrentmap_tester
+{
+	typedef ft::ConcurrentMap<int, std::string>		hash_map;
+	typedef ft::ConcurrentMap<int, std::string, ft::less<int>, ft::RangeRouter<int> >	range_map;
+
+	struct Printer
+	{
+		void	operator() (const ft::Pair<int, std::string> &val) const
+		{
+			std::cout << ' ' << val.first << '=' << val.second;
+		}
+	};
+
+	void	basic_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "BASIC" << std::endl;
+		hash_map	mymap((ft::HashRouter<int>(4)));
+		std::string	val;
+
+		std::cout << "shards: " << mymap.shard_count() << ", empty: " << mymap.empty() << '\n';
+		for (int i = 0; i < 10; ++i)
+			mymap.insert(hash_map::value_type(i, std::string(1, 'a' + i)));
+		std::cout << "insert 3 again: " << mymap.insert(hash_map::value_type(3, "x")) << '\n';
+		std::cout << "assign 3: " << mymap.assign(3, "x") << ", assign 42: " << mymap.assign(42, "y") << '\n';
+		std::cout << "find 3: " << mymap.find(3, val) << ' ' << val << '\n';
+		std::cout << "find 100: " << mymap.find(100, val) << '\n';
+		std::cout << "erase 5: " << mymap.erase(5) << ", erase 5: " << mymap.erase(5) << '\n';
+		std::cout << "count 5: " << mymap.count(5) << ", count 6: " << mymap.count(6) << '\n';
+		std::cout << "size: " << mymap.size() << '\n';
+		mymap.clear();
+		std::cout << "cleared: " << mymap.empty() << '\n';
+	}
+
+	void	ordered_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "ORDERED" << std::endl;
+		int			splits[] = {10, 20, 30};
+		hash_map	hmap((ft::HashRouter<int>(5)));
+		range_map	rmap(ft::RangeRouter<int>(splits, splits + 3));
+
+		for (int i = 0; i < 12; ++i)
+		{
+			hmap.insert(hash_map::value_type((i * 7) % 12 * 3, std::string(1, 'a' + i)));
+			rmap.insert(range_map::value_type((i * 7) % 12 * 3, std::string(1, 'a' + i)));
+		}
+		std::cout << "range shards: " << rmap.shard_count() << '\n';
+		std::cout << "hash:";
+		hmap.for_each(Printer());
+		std::cout << "\nrange:";
+		rmap.for_each(Printer());
+		std::cout << '\n';
+	}
+
+	void	bound_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "BOUND" << std::endl;
+		int					splits[] = {10, 20, 30};
+		hash_map			hmap((ft::HashRouter<int>(5)));
+		range_map			rmap(ft::RangeRouter<int>(splits, splits + 3));
+		hash_map::value_type	a;
+		range_map::value_type	b;
+		int					keys[] = {-5, 0, 4, 9, 10, 11, 25, 33, 34};
+
+		for (int i = 0; i < 12; ++i)
+		{
+			hmap.insert(hash_map::value_type(i * 3, std::string(1, 'a' + i)));
+			rmap.insert(range_map::value_type(i * 3, std::string(1, 'a' + i)));
+		}
+		for (int i = 0; i < 9; ++i)
+		{
+			std::cout << "lower_bound(" << keys[i] << "):";
+			if (hmap.lower_bound(keys[i], a))
+				std::cout << ' ' << a.first;
+			else
+				std::cout << " end";
+			if (rmap.lower_bound(keys[i], b))
+				std::cout << ' ' << b.first;
+			else
+				std::cout << " end";
+			std::cout << ", upper_bound:";
+			if (hmap.upper_bound(keys[i], a))
+				std::cout << ' ' << a.first;
+			else
+				std::cout << " end";
+			if (rmap.upper_bound(keys[i], b))
+				std::cout << ' ' << b.first;
+			else
+				std::cout << " end";
+			std::cout << '\n';
+		}
+	}
+
+	void	batch_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "BATCH" << std::endl;
+		hash_map				mymap((ft::HashRouter<int>(3)));
+		hash_map::value_type	vals[6];
+		int						keys[] = {4, 100, 0, 2, 5, 4};
+		std::string				found_vals[6];
+		bool					found[6];
+
+		for (int i = 0; i < 6; ++i)
+			vals[i] = hash_map::value_type(i % 5, std::string(1, 'a' + i));
+		std::cout << "insert_many: " << mymap.insert_many(vals, 6) << '\n';
+		std::cout << "find_many: " << mymap.find_many(keys, 6, found_vals, found) << '\n';
+		for (int i = 0; i < 6; ++i)
+		{
+			std::cout << keys[i] << ':';
+			if (found[i])
+				std::cout << found_vals[i] << ' ';
+			else
+				std::cout << "- ";
+		}
+		std::cout << '\n';
+	}
+
+	static const int	THREADS = 4;
+	static const int	PER_THREAD = 20000;
+
+	struct Worker
+	{
+		ft::ConcurrentMap<int, int>	*map;
+		int							id;
+		long						hits;
+	};
+
+	// 스레드마다 자기 키를 넣고 지우면서 다른 스레드의 키도 읽는다
+	void	*work(void *arg)
+	{
+		Worker	*w = static_cast<Worker *>(arg);
+		int		val;
+
+		for (int i = 0; i < PER_THREAD; ++i)
+		{
+			w->map->insert(ft::Pair<int, int>(i * THREADS + w->id, i));
+			if (w->map->find(i * THREADS + (w->id + 1) % THREADS, val))
+				++w->hits;
+			if (i % 2)
+				w->map->erase(i * THREADS + w->id);
+		}
+		return (0);
+	}
+
+	void	thread_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "THREAD" << std::endl;
+		ft::ConcurrentMap<int, int>	mymap;
+		pthread_t					threads[THREADS];
+		Worker						workers[THREADS];
+
+		for (int i = 0; i < THREADS; ++i)
+		{
+			workers[i].map = &mymap;
+			workers[i].id = i;
+			workers[i].hits = 0;
+			pthread_create(&threads[i], 0, work, &workers[i]);
+		}
+		for (int i = 0; i < THREADS; ++i)
+			pthread_join(threads[i], 0);
+		std::cout << "size: " << mymap.size() << '\n';
+	}
+
+	int		main(void)
+	{
+		basic_test();
+		ordered_test();
+		bound_test();
+		batch_test();
+		thread_test();
+
+		return (0);
+	}
+}
@@ -0,0 +1,20 @@
+#ifndef CONCURRENT_MAP_TESTER_HPP
+# define CONCURRENT_MAP_TESTER_HPP
+
+# include "ConcurrentMap.hpp"
+# include <iostream>
+# include <iomanip>
+# include <string>
+# include <pthread.h>
+
+namespace concurrentmap_tester
+{
+	void	basic_test();
+	void	ordered_test();
+	void	bound_test();
+	void	batch_test();
+	void	thread_test();
+	int		main();
+}
+
+#endif
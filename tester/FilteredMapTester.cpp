@@ -0,0 +1,137 @@
+#include "FilteredMapTester.hpp"
+
+namespace filteredmap_tester
+{
+	typedef ft::FilteredMap<int, std::string>	filtered_map;
+
+	template <class M>
+	void	print(const char *name, M &m)
+	{
+		std::cout << name << " (" << m.size() << "):";
+		for (typename M::iterator it = m.begin(); it != m.end(); ++it)
+			std::cout << ' ' << it->first << '=' << it->second;
+		std::cout << '\n';
+	}
+
+	void	bloom_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "BLOOM" << std::endl;
+		ft::BloomFilter<int>			filter(1000);
+		ft::BloomFilter<std::string>	words(4);
+		int								missing = 0;
+		int								positives = 0;
+
+		for (int i = 0; i < 1000; ++i)
+			filter.insert(i * 3);
+		for (int i = 0; i < 1000; ++i)
+			missing += !filter.may_contain(i * 3);
+		for (int i = 0; i < 10000; ++i)
+			positives += filter.may_contain(i * 3 + 1);
+		std::cout << "memory: " << filter.memory_bytes() << ", inserted: " << filter.inserted() << '\n';
+		std::cout << "false negatives: " << missing << ", false positives under 3%: " << (positives < 300) << '\n';
+		words.insert("bloom");
+		words.insert("filter");
+		std::cout << "bloom: " << words.may_contain("bloom") << ", filter: " << words.may_contain("filter") << '\n';
+
+		ft::BloomFilter<int>	copy(filter);
+
+		filter.reset(10);
+		std::cout << "reset: " << filter.may_contain(3) << ' ' << filter.memory_bytes()
+			<< ", copy kept: " << copy.may_contain(3) << '\n';
+	}
+
+	void	basic_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "BASIC" << std::endl;
+		filtered_map	mymap(8);
+
+		for (int i = 0; i < 10; ++i)
+			mymap.insert(filtered_map::value_type((i * 7) % 10, std::string(1, 'a' + i)));
+		print("mymap", mymap);
+		std::cout << "insert 3 again: " << mymap.insert(filtered_map::value_type(3, "x")).second << '\n';
+		std::cout << "find 4: " << mymap.find(4)->second << ", find 42: " << (mymap.find(42) == mymap.end()) << '\n';
+		std::cout << "count 5: " << mymap.count(5) << ", count 50: " << mymap.count(50) << '\n';
+		mymap[5] = "five";
+		mymap[50] = "fifty";
+		print("operator[]", mymap);
+		std::cout << "erase 5: " << mymap.erase(5) << ", erase 5: " << mymap.erase(5)
+			<< ", erase 77: " << mymap.erase(77) << '\n';
+		mymap.erase(mymap.begin());
+		mymap.erase(mymap.lower_bound(7), mymap.end());
+		print("erased", mymap);
+		std::cout << "lower_bound(4): " << mymap.lower_bound(4)->first
+			<< ", upper_bound(4): " << mymap.upper_bound(4)->first << '\n';
+
+		filtered_map	copy(mymap);
+		filtered_map	other(4);
+
+		other[100] = "hundred";
+		copy.swap(other);
+		print("swapped copy", copy);
+		print("swapped other", other);
+		std::cout << "other find 2: " << other.count(2) << ", copy find 2: " << copy.count(2) << '\n';
+		mymap.clear();
+		std::cout << "clear: " << mymap.size() << ' ' << mymap.count(1) << '\n';
+	}
+
+	// 짝수 키만 넣고 홀수 키를 물어서 필터가 트리 탐색을 얼마나 막는지 본다
+	void	stats_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "STATS" << std::endl;
+		ft::FilteredMap<int, int>	mymap(4096);
+		ft::FilterStats				stats;
+		size_t						hits = 0;
+
+		for (int i = 0; i < 4096; ++i)
+			mymap[i * 2] = i;
+		mymap.reset_stats();
+		for (int i = 0; i < 40960; ++i)
+			hits += mymap.count(i);
+		stats = mymap.filter_stats();
+		std::cout << "hits: " << hits << ", lookups: " << stats.lookups << '\n';
+		std::cout << "filtered + false positives: " << stats.filtered + stats.false_positives << '\n';
+		std::cout << "false positive rate under 3%: " << (stats.false_positive_rate() < 0.03) << '\n';
+		std::cout << "memory: " << stats.memory_bytes << ", rebuilds: " << stats.rebuilds << '\n';
+	}
+
+	void	rebuild_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "REBUILD" << std::endl;
+		ft::FilteredMap<int, int>	mymap(16);
+		ft::FilterStats				stats;
+
+		// 용량을 넘게 넣으면 두 배씩 키운다
+		for (int i = 0; i < 1000; ++i)
+			mymap[i] = i;
+		stats = mymap.filter_stats();
+		std::cout << "grown: rebuilds " << stats.rebuilds << ", memory " << stats.memory_bytes << '\n';
+		// 대부분 지우면 남은 키로 다시 만들고 크기를 줄인다
+		for (int i = 0; i < 1000; ++i)
+			if (i % 10)
+				mymap.erase(i);
+		stats = mymap.filter_stats();
+		std::cout << "after erase: size " << mymap.size() << ", rebuilds " << stats.rebuilds
+			<< ", memory " << stats.memory_bytes << '\n';
+		mymap.reset_stats();
+		for (int i = 0; i < 1000; ++i)
+			if (i % 10 && mymap.count(i))
+				std::cout << "erased key found: " << i << '\n';
+		stats = mymap.filter_stats();
+		std::cout << "erased keys filtered under 10% false positives: "
+			<< (stats.false_positives * 10 < stats.filtered + stats.false_positives) << '\n';
+		for (int i = 0; i < 1000; i += 10)
+			if (!mymap.count(i))
+				std::cout << "kept key missing: " << i << '\n';
+		std::cout << "kept keys: " << mymap.size() << '\n';
+	}
+
+	int		main(void)
+	{
+		bloom_test();
+		basic_test();
+		stats_test();
+		rebuild_test();
+
+		return (0);
+	}
+}
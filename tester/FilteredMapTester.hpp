@@ -0,0 +1,18 @@
+#ifndef FILTERED_MAP_TESTER_HPP
+# define FILTERED_MAP_TESTER_HPP
+
+# include "FilteredMap.hpp"
+# include <iostream>
+# include <iomanip>
+# include <string>
+
+namespace filteredmap_tester
+{
+	void	bloom_test();
+	void	basic_test();
+	void	stats_test();
+	void	rebuild_test();
+	int		main();
+}
+
+#endif
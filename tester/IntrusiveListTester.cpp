@@ -0,0 +1,207 @@
+#include "IntrusiveListTester.hpp"
+
+namespace intrusivelist_tester
+{
+	// 풀에 사는 연결 객체, 세 리스트에 동시에 들어갈 수 있다
+	struct Conn
+	{
+		int				id;
+		ft::ListHook	idle;
+		ft::ListHook	active;
+		ft::ListHook	timeout;
+
+		Conn() : id(0) {}
+		explicit Conn(int i) : id(i) {}
+
+		bool	operator== (const Conn &x) const
+		{ return (id == x.id); }
+		bool	operator< (const Conn &x) const
+		{ return (id < x.id); }
+	};
+
+	typedef ft::IntrusiveList<Conn, &Conn::idle>		idle_list;
+	typedef ft::IntrusiveList<Conn, &Conn::active>		active_list;
+	typedef ft::IntrusiveList<Conn, &Conn::timeout>		timeout_list;
+
+	template <class L>
+	void	print(const char *name, const L &l)
+	{
+		std::cout << name << " (" << l.size() << "):";
+		for (typename L::const_iterator it = l.begin(); it != l.end(); ++it)
+			std::cout << ' ' << it->id;
+		std::cout << '\n';
+	}
+
+	void	basic_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "BASIC" << std::endl;
+		Conn		pool[6];
+		idle_list	mylist;
+
+		for (int i = 0; i < 6; ++i)
+			pool[i].id = i;
+		std::cout << "empty: " << mylist.empty() << ", linked: " << pool[0].idle.is_linked() << '\n';
+		mylist.push_back(pool[1]);
+		mylist.push_back(pool[2]);
+		mylist.push_front(pool[0]);
+		mylist.insert(mylist.end(), pool[3]);
+		print("mylist", mylist);
+		std::cout << "front: " << mylist.front().id << ", back: " << mylist.back().id
+			<< ", linked: " << pool[0].idle.is_linked() << '\n';
+		std::cout << "reverse:";
+		for (idle_list::reverse_iterator it = mylist.rbegin(); it != mylist.rend(); ++it)
+			std::cout << ' ' << it->id;
+		std::cout << '\n';
+		// 원소에서 바로 이터레이터를 얻어 O(1)로 뺀다
+		mylist.erase(idle_list::iterator_to(pool[2]));
+		print("erase 2", mylist);
+		mylist.insert(idle_list::iterator_to(pool[1]), pool[2]);
+		print("insert 2 before 1", mylist);
+		mylist.pop_front();
+		mylist.pop_back();
+		print("pop_front, pop_back", mylist);
+		std::cout << "0 linked: " << pool[0].idle.is_linked() << ", address kept: " << (&mylist.front() == &pool[2]) << '\n';
+		mylist.insert(mylist.begin(), pool + 3, pool + 6);
+		print("insert range", mylist);
+		mylist.erase(mylist.begin(), idle_list::iterator_to(pool[2]));
+		print("erase range", mylist);
+
+		Conn	copy(pool[2]);
+
+		std::cout << "copy linked: " << copy.idle.is_linked() << '\n';
+		mylist.clear();
+		std::cout << "clear: " << mylist.size() << ' ' << pool[1].idle.is_linked() << '\n';
+	}
+
+	void	splice_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "SPLICE" << std::endl;
+		Conn		pool[10];
+		idle_list	a;
+		idle_list	b;
+
+		for (int i = 0; i < 10; ++i)
+		{
+			pool[i].id = i;
+			if (i < 5)
+				a.push_back(pool[i]);
+			else
+				b.push_back(pool[i]);
+		}
+		a.splice(idle_list::iterator_to(pool[2]), b, idle_list::iterator_to(pool[7]));
+		print("a splice 7", a);
+		print("b", b);
+		a.splice(a.end(), b, b.begin(), idle_list::iterator_to(pool[9]));
+		print("a splice [5, 9)", a);
+		print("b", b);
+		a.splice(a.begin(), b);
+		print("a splice all", a);
+		std::cout << "b empty: " << b.empty() << '\n';
+		// 같은 리스트 안에서 옮기기
+		a.splice(a.begin(), a, idle_list::iterator_to(pool[3]), a.end());
+		print("a rotate", a);
+		a.splice(a.end(), a, a.begin());
+		print("a front to back", a);
+		a.swap(b);
+		print("swap a", a);
+		print("swap b", b);
+	}
+
+	struct IsOdd
+	{
+		bool	operator() (const Conn &c) const
+		{ return (c.id % 2 != 0); }
+	};
+
+	struct SameTens
+	{
+		bool	operator() (const Conn &x, const Conn &y) const
+		{ return (x.id / 10 == y.id / 10); }
+	};
+
+	struct Greater
+	{
+		bool	operator() (const Conn &x, const Conn &y) const
+		{ return (y.id < x.id); }
+	};
+
+	void	operation_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "OPERATION" << std::endl;
+		Conn		pool[12];
+		int			ids[] = { 31, 5, 17, 5, 42, 8, 23, 17, 11, 42, 2, 36 };
+		idle_list	mylist;
+		idle_list	other;
+
+		for (int i = 0; i < 12; ++i)
+		{
+			pool[i].id = ids[i];
+			mylist.push_back(pool[i]);
+		}
+		mylist.sort();
+		print("sort", mylist);
+		std::cout << "stable: " << (&*++mylist.begin() == &pool[1]) << '\n';
+		mylist.unique();
+		print("unique", mylist);
+		mylist.reverse();
+		print("reverse", mylist);
+		mylist.sort(Greater());
+		print("sort greater", mylist);
+		mylist.unique(SameTens());
+		print("unique tens", mylist);
+		mylist.sort();
+		for (int i = 0; i < 12; ++i)
+		{
+			if (!pool[i].idle.is_linked())
+				other.push_back(pool[i]);
+		}
+		other.sort();
+		mylist.merge(other);
+		print("merge", mylist);
+		std::cout << "other empty: " << other.empty() << '\n';
+		mylist.remove_if(IsOdd());
+		print("remove_if odd", mylist);
+		mylist.remove(Conn(42));
+		print("remove 42", mylist);
+	}
+
+	// 연결 하나가 idle, active, timeout에 동시에 들어 있다
+	void	multi_hook_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "MULTI HOOK" << std::endl;
+		Conn			pool[5];
+		idle_list		idle;
+		active_list		active;
+		timeout_list	timeouts;
+
+		for (int i = 0; i < 5; ++i)
+		{
+			pool[i].id = i;
+			idle.push_back(pool[i]);
+			timeouts.push_front(pool[i]);
+		}
+		// idle에서 active로 옮긴다
+		for (int i = 0; i < 5; i += 2)
+		{
+			idle.erase(idle_list::iterator_to(pool[i]));
+			active.push_back(pool[i]);
+		}
+		print("idle", idle);
+		print("active", active);
+		print("timeout", timeouts);
+		timeouts.erase(timeout_list::iterator_to(pool[2]));
+		print("timeout without 2", timeouts);
+		std::cout << "2 in active: " << pool[2].active.is_linked() << ", in timeout: " << pool[2].timeout.is_linked() << '\n';
+		std::cout << "same object: " << (&active.back() == &timeouts.front()) << '\n';
+	}
+
+	int		main()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "INTRUSIVELIST" << std::endl;
+		basic_test();
+		splice_test();
+		operation_test();
+		multi_hook_test();
+		return (0);
+	}
+}
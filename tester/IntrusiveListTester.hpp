@@ -0,0 +1,18 @@
+#ifndef INTRUSIVE_LIST_TESTER_HPP
+# define INTRUSIVE_LIST_TESTER_HPP
+
+# include "IntrusiveList.hpp"
+# include <iostream>
+# include <iomanip>
+# include <string>
+
+namespace intrusivelist_tester
+{
+	void	basic_test();
+	void	splice_test();
+	void	operation_test();
+	void	multi_hook_test();
+	int		main();
+}
+
+#endif
@@ -0,0 +1,246 @@
+#include "LruCacheTester.hpp"
+
+namespace lrucache_tester
+{
+	struct Printer
+	{
+		void	operator() (int key, const std::string &value) const
+		{ std::cout << ' ' << key << '=' << value; }
+	};
+
+	template <class C>
+	void	print(const char *name, const C &c)
+	{
+		std::cout << name << " (" << c.size() << "):";
+		c.for_each(Printer());
+		std::cout << '\n';
+	}
+
+	void	log_eviction(const int &key, const std::string &value, void *context)
+	{
+		std::string	*log = static_cast<std::string *>(context);
+
+		*log += ' ';
+		*log += value;
+		(void)key;
+	}
+
+	void	lru_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "LRU" << std::endl;
+		ft::LruCache<int, std::string>	cache(3);
+		std::string						evicted;
+		std::string						*v;
+
+		cache.set_evict_callback(log_eviction, &evicted);
+		cache.put(1, "one");
+		cache.put(2, "two");
+		cache.put(3, "three");
+		print("filled", cache);
+		v = cache.get(1);
+		std::cout << "get 1: " << *v << ", get 9: " << (cache.get(9) == 0) << '\n';
+		print("after get", cache);
+		cache.put(4, "four");
+		print("put 4", cache);
+		cache.put(3, "THREE");
+		cache.put(5, "five");
+		print("update 3, put 5", cache);
+		std::cout << "evicted:" << evicted << '\n';
+		std::cout << "peek 4: " << *cache.peek(4) << ", contains 1: " << cache.contains(1) << '\n';
+		print("after peek", cache);
+		std::cout << "erase 3: " << cache.erase(3) << ", erase 3: " << cache.erase(3) << '\n';
+		cache.set_capacity(1);
+		print("capacity 1", cache);
+		std::cout << "evicted:" << evicted << '\n';
+
+		ft::CacheStats	stats = cache.stats();
+
+		std::cout << "hits " << stats.hits << ", misses " << stats.misses << ", evictions " << stats.evictions << '\n';
+		cache.clear();
+		std::cout << "clear: " << cache.size() << ' ' << cache.empty() << ", evicted:" << evicted << '\n';
+	}
+
+	// 문자열 길이를 바이트 무게로 쓴다
+	struct ByteWeight
+	{
+		size_t	operator() (const int &, const std::string &value) const
+		{ return (value.size()); }
+	};
+
+	void	weight_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "WEIGHT" << std::endl;
+		ft::LruCache<int, std::string, ft::hash<int>, ByteWeight>	cache(12);
+		std::string													evicted;
+
+		cache.set_evict_callback(log_eviction, &evicted);
+		cache.put(1, "aaaa");
+		cache.put(2, "bbbb");
+		cache.put(3, "cccc");
+		std::cout << "weight: " << cache.weight() << '\n';
+		cache.put(4, "dddddd");
+		std::cout << "put 6 bytes: weight " << cache.weight() << ", evicted:" << evicted << '\n';
+		cache.put(3, "c");
+		std::cout << "shrink 3: weight " << cache.weight() << '\n';
+		std::cout << "too heavy: " << cache.put(3, "xxxxxxxxxxxxx") << ", contains 3: " << cache.contains(3) << '\n';
+		std::cout << "weight: " << cache.weight() << ", size: " << cache.size() << '\n';
+	}
+
+	void	clock_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "CLOCK" << std::endl;
+		ft::ClockCache<int, std::string>	cache(3);
+		std::string							evicted;
+
+		cache.set_evict_callback(log_eviction, &evicted);
+		cache.put(1, "one");
+		cache.put(2, "two");
+		cache.put(3, "three");
+		print("filled", cache);
+		// 1은 참조 비트가 서 있으므로 한 번 봐주고 2를 밀어낸다
+		cache.get(1);
+		cache.put(4, "four");
+		print("put 4", cache);
+		cache.get(3);
+		cache.get(4);
+		cache.put(5, "five");
+		print("put 5", cache);
+		std::cout << "evicted:" << evicted << '\n';
+		std::cout << "erase 1: " << cache.erase(1) << ", get 1: " << (cache.get(1) == 0) << '\n';
+		cache.put(6, "six");
+		cache.put(7, "seven");
+		print("put 6, 7", cache);
+		std::cout << "evicted:" << evicted << '\n';
+
+		ft::CacheStats	stats = cache.stats();
+
+		std::cout << "hits " << stats.hits << ", misses " << stats.misses << ", evictions " << stats.evictions << '\n';
+
+		// 밀려날 원소의 값을 그대로 넣어도 된다
+		ft::ClockCache<int, std::string>	full(2);
+
+		full.put(1, "one");
+		full.put(2, "two");
+		full.put(3, *full.peek(1));
+		print("put 3 = peek 1", full);
+	}
+
+	// 다른 원소가 모두 참조 비트가 서 있어도 방금 넣은 원소는 남는다
+	void	clock_referenced_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "CLOCK REFERENCED" << std::endl;
+		ft::ClockCache<int, std::string>	cache(2);
+		std::string							evicted;
+
+		cache.set_evict_callback(log_eviction, &evicted);
+		cache.put(1, "one");
+		cache.put(2, "two");
+		cache.get(1);
+		cache.get(2);
+		std::cout << "put 3: " << cache.put(3, "three") << ", contains 3: " << cache.contains(3)
+			<< ", size: " << cache.size() << '\n';
+		print("cache", cache);
+		std::cout << "evicted:" << evicted << '\n';
+
+		// 있는 원소가 무거워져서 자리를 만들어야 할 때도 마찬가지
+		ft::ClockCache<int, std::string, ft::hash<int>, ByteWeight>	bytes(8);
+
+		evicted.clear();
+		bytes.set_evict_callback(log_eviction, &evicted);
+		bytes.put(1, "aaaa");
+		bytes.put(2, "bbbb");
+		bytes.get(1);
+		bytes.get(2);
+		std::cout << "grow 2: " << bytes.put(2, "bbbbbb") << ", contains 2: " << bytes.contains(2)
+			<< ", value: " << *bytes.peek(2) << ", weight: " << bytes.weight() << ", evicted:" << evicted << '\n';
+	}
+
+	static const int	THREADS = 4;
+	static const int	KEYS = 2000;
+	static const int	OPS = 20000;
+
+	template <class C>
+	struct Worker
+	{
+		C		*cache;
+		int		id;
+		long	bad;
+	};
+
+	// 값은 항상 키의 두 배. 꺼낸 값이 다르면 샤드 잠금이 깨진 것이다
+	template <class C>
+	void	*work(void *arg)
+	{
+		Worker<C>		*w = static_cast<Worker<C> *>(arg);
+		unsigned long	seed = w->id * 7919 + 1;
+		long			v;
+
+		for (int i = 0; i < OPS; ++i)
+		{
+			seed = seed * 1103515245 + 12345;
+			int		k = static_cast<int>((seed >> 16) % KEYS);
+
+			if (w->cache->get(k, v))
+			{
+				if (v != k * 2)
+					++w->bad;
+			}
+			else
+				w->cache->put(k, k * 2);
+			if (i % 97 == 0)
+				w->cache->erase(k);
+		}
+		return (0);
+	}
+
+	template <class C>
+	void	run_sharded(const char *name)
+	{
+		C				cache(8, 512);
+		pthread_t		threads[THREADS];
+		Worker<C>		workers[THREADS];
+		long			bad = 0;
+		ft::CacheStats	stats;
+
+		for (int i = 0; i < THREADS; ++i)
+		{
+			workers[i].cache = &cache;
+			workers[i].id = i;
+			workers[i].bad = 0;
+			pthread_create(&threads[i], 0, work<C>, &workers[i]);
+		}
+		for (int i = 0; i < THREADS; ++i)
+		{
+			pthread_join(threads[i], 0);
+			bad += workers[i].bad;
+		}
+		stats = cache.stats();
+		std::cout << name << ": bad values " << bad << ", within capacity " << (cache.size() <= 512)
+			<< ", lookups " << stats.hits + stats.misses << ", shards " << cache.shard_count() << '\n';
+	}
+
+	void	sharded_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "SHARDED" << std::endl;
+		run_sharded<ft::ShardedCache<ft::LruCache<int, long> > >("lru");
+		run_sharded<ft::ShardedCache<ft::ClockCache<int, long> > >("clock");
+
+		// 샤드 용량을 더하면 정확히 요청한 용량이다
+		ft::ShardedCache<ft::LruCache<int, long> >	split(4, 10);
+
+		for (int i = 0; i < 100; ++i)
+			split.put(i, i);
+		std::cout << "4 shards of 10: capacity " << split.capacity() << ", size " << split.size() << '\n';
+	}
+
+	int		main(void)
+	{
+		lru_test();
+		weight_test();
+		clock_test();
+		clock_referenced_test();
+		sharded_test();
+
+		return (0);
+	}
+}
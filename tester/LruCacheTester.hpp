@@ -0,0 +1,20 @@
+#ifndef LRU_CACHE_TESTER_HPP
+# define LRU_CACHE_TESTER_HPP
+
+# include "LruCache.hpp"
+# include <iostream>
+# include <iomanip>
+# include <string>
+# include <pthread.h>
+
+namespace lrucache_tester
+{
+	void	lru_test();
+	void	weight_test();
+	void	clock_test();
+	void	clock_referenced_test();
+	void	sharded_test();
+	int		main();
+}
+
+#endif
@@ -0,0 +1,205 @@
+#include "MappedMapTester.hpp"
+
+namespace mappedmap_tester
+{
+	typedef ft::MappedMap<int, double>	mmap;
+
+	static std::string	path;
+
+	void	basic_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "BASIC" << std::endl;
+		ft::Map<int, double>	mymap;
+
+		for (int i = 0; i < 10; ++i)
+			mymap[(i * 7) % 10 * 3] = i * 0.5;
+		ft::write_map_image(mymap, path.c_str());
+
+		mmap	image(path.c_str());
+
+		std::cout << "open: " << image.is_open() << ", size: " << image.size() << '\n';
+		std::cout << "image contains:";
+		for (mmap::iterator it = image.begin(); it != image.end(); ++it)
+			std::cout << ' ' << it->first << '=' << it->second;
+		std::cout << "\nfind 9: " << (image.find(9) != image.end()) << ' ' << image.find(9).value() << '\n';
+		std::cout << "find 10: " << (image.find(10) == image.end()) << '\n';
+		std::cout << "count 27: " << image.count(27) << ", at 27: " << image.at(27) << '\n';
+		try
+		{
+			image.at(1);
+		}
+		catch (const std::out_of_range &e)
+		{
+			std::cout << "at 1: out_of_range\n";
+		}
+		std::cout << "last: " << (*(image.end() - 1)).first << ", distance: " << (image.end() - image.begin()) << '\n';
+		image.close();
+		std::cout << "closed: " << !image.is_open() << ' ' << image.size() << '\n';
+
+		ft::Map<int, double>	empty;
+
+		ft::write_map_image(empty, path.c_str());
+		image.open(path.c_str());
+		std::cout << "empty: " << image.empty() << ' ' << (image.lower_bound(5) == image.end())
+			<< ' ' << (image.find(0) == image.end()) << '\n';
+	}
+
+	// 모든 키 근처에서 Map과 같은 결과를 내는지
+	template <class M>
+	bool	same_bounds(ft::Map<int, int> &ref, M &image, int lo, int hi)
+	{
+		for (int k = lo; k <= hi; ++k)
+		{
+			ft::Map<int, int>::iterator	l = ref.lower_bound(k);
+			ft::Map<int, int>::iterator	u = ref.upper_bound(k);
+			typename M::iterator		il = image.lower_bound(k);
+			typename M::iterator		iu = image.upper_bound(k);
+
+			if ((l == ref.end()) != (il == image.end()) || (u == ref.end()) != (iu == image.end()))
+				return (false);
+			if (l != ref.end() && (l->first != il.key() || l->second != il.value()))
+				return (false);
+			if (u != ref.end() && u->first != iu.key())
+				return (false);
+		}
+		return (true);
+	}
+
+	void	bound_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "BOUND" << std::endl;
+		ft::Map<int, int>	ref;
+		std::stringstream	ss;
+
+		for (int n = 0; n < 70; n += 1)
+		{
+			ref[n * 2] = n;
+			ft::write_map_image(ref, path.c_str());
+
+			ft::MappedMap<int, int>	image(path.c_str());
+
+			if (!same_bounds(ref, image, -2, 2 * n + 2))
+				std::cout << "mismatch at size " << ref.size() << '\n';
+		}
+		std::cout << "sizes 1 to 70 match Map\n";
+
+		ft::MappedMap<int, int>	image(path.c_str());
+		ft::Pair<ft::MappedMap<int, int>::iterator, ft::MappedMap<int, int>::iterator>	range = image.equal_range(40);
+
+		std::cout << "equal_range 40: " << range.first.key() << ' ' << range.second.key() << '\n';
+		range = image.equal_range(41);
+		std::cout << "equal_range 41: " << (range.first == range.second) << ' ' << range.first.key() << '\n';
+
+		ft::Map<int, int, ft::greater<int> >	desc;
+
+		for (int i = 0; i < 100; ++i)
+			desc[i * 3] = i;
+		ft::write_map_image(desc, path.c_str());
+
+		ft::MappedMap<int, int, ft::greater<int> >	dimage(path.c_str());
+
+		std::cout << "descending: " << dimage.begin().key() << ", lower_bound 100: " << dimage.lower_bound(100).key()
+			<< ", upper_bound 99: " << dimage.upper_bound(99).key() << '\n';
+	}
+
+	void	large_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "LARGE" << std::endl;
+		ft::Map<int, int>	ref;
+
+		for (int i = 0; i < 100000; ++i)
+			ref[i * 5 + (i & 3)] = -i;
+		ft::write_map_image(ref, path.c_str());
+
+		ft::MappedMap<int, int>	image(path.c_str());
+		ft::MappedMap<int, int>	other(path.c_str());
+		bool					ok = same_bounds(ref, image, -5, 500010);
+
+		std::cout << "size: " << image.size() << ", bounds match: " << ok << '\n';
+		std::cout << "keys are shared: " << (image.keys()[777] == other.keys()[777])
+			<< ", at 4999: " << other.at(4999 * 5 + 3) << '\n';
+	}
+
+	// 12바이트 값: 값 배열의 시작이 12의 배수가 아니어도 열려야 한다
+	struct Triple
+	{
+		int		a;
+		int		b;
+		int		c;
+	};
+
+	void	struct_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "STRUCT" << std::endl;
+		ft::Map<int, Triple>	m;
+
+		for (int i = 0; i < 30; ++i)
+		{
+			Triple	t = { i, i * i, -i };
+
+			m[i * 2] = t;
+		}
+		ft::write_map_image(m, path.c_str());
+
+		ft::MappedMap<int, Triple>	image(path.c_str());
+		const Triple				&t = image.at(58);
+
+		std::cout << "size: " << image.size() << ", at 58: " << t.a << ' ' << t.b << ' ' << t.c
+			<< ", find 7: " << (image.find(7) == image.end()) << '\n';
+	}
+
+	void	error_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "ERROR" << std::endl;
+		ft::Map<int, int>	m;
+
+		m[1] = 2;
+		ft::write_map_image(m, path.c_str());
+		try
+		{
+			ft::MappedMap<long, int>	wrong(path.c_str());
+		}
+		catch (const ft::map_image_error &e)
+		{
+			std::cout << e.what() << '\n';
+		}
+		if (truncate(path.c_str(), 200) == 0)
+		{
+			try
+			{
+				ft::MappedMap<int, int>	cut(path.c_str());
+			}
+			catch (const ft::map_image_error &e)
+			{
+				std::cout << e.what() << '\n';
+			}
+		}
+		try
+		{
+			ft::MappedMap<int, int>	missing("/nonexistent/dir/image");
+		}
+		catch (const ft::map_image_error &e)
+		{
+			std::cout << "missing: " << (std::string(e.what()).find("open") != std::string::npos) << '\n';
+		}
+	}
+
+	int		main()
+	{
+		char	name[] = "/tmp/ft_mapped_map_XXXXXX";
+		int		fd = mkstemp(name);
+
+		std::cout << std::setfill('-') << std::setw(20) << "MAPPEDMAP" << std::endl;
+		if (fd < 0)
+			return (1);
+		close(fd);
+		path = name;
+		basic_test();
+		bound_test();
+		large_test();
+		struct_test();
+		error_test();
+		unlink(name);
+		return (0);
+	}
+}
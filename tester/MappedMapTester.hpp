@@ -0,0 +1,22 @@
+#ifndef MAPPED_MAP_TESTER_HPP
+# define MAPPED_MAP_TESTER_HPP
+
+# include "MappedMap.hpp"
+# include <iostream>
+# include <iomanip>
+# include <sstream>
+# include <string>
+# include <cstdlib>
+# include <unistd.h>
+
+namespace mappedmap_tester
+{
+	void	basic_test();
+	void	bound_test();
+	void	large_test();
+	void	struct_test();
+	void	error_test();
+	int		main();
+}
+
+#endif
@@ -0,0 +1,214 @@
+#include "MmapVectorTester.hpp"
+
+namespace mmapvector_tester
+{
+	typedef ft::MmapVector<int>		ivector;
+
+	struct Record
+	{
+		int		id;
+		double	score;
+	};
+
+	static std::string	path;
+
+	template <class Vec>
+	void	print(const char *name, Vec &v)
+	{
+		std::cout << name << " (" << v.size() << "):";
+		for (typename Vec::iterator it = v.begin(); it != v.end(); ++it)
+			std::cout << ' ' << *it;
+		std::cout << '\n';
+	}
+
+	static off_t	file_size()
+	{
+		struct stat		st;
+
+		stat(path.c_str(), &st);
+		return (st.st_size);
+	}
+
+	void	basic_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "BASIC" << std::endl;
+		ivector myvector(path.c_str(), ivector::TRUNCATE);
+
+		std::cout << "open: " << myvector.is_open() << ", empty: " << myvector.empty() << '\n';
+		for (int i = 1; i <= 5; ++i)
+			myvector.push_back(i * 10);
+		print("myvector", myvector);
+		std::cout << "front: " << myvector.front() << ", back: " << myvector.back() << ", [2]: " << myvector[2] << '\n';
+		std::cout << "reverse:";
+		for (ivector::reverse_iterator it = myvector.rbegin(); it != myvector.rend(); ++it)
+			std::cout << ' ' << *it;
+		std::cout << '\n';
+		try
+		{
+			myvector.at(5);
+		}
+		catch (const std::out_of_range &e)
+		{
+			std::cout << "at(5): out_of_range\n";
+		}
+	}
+
+	void	modifier_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "MODIFIER" << std::endl;
+		ivector myvector(path.c_str(), ivector::TRUNCATE);
+		int		arr[] = { 7, 8, 9 };
+
+		myvector.assign(4, 1);
+		print("assign(4, 1)", myvector);
+		myvector.insert(myvector.begin() + 2, 5);
+		print("insert 5 at 2", myvector);
+		myvector.insert(myvector.begin(), 2, 3);
+		print("insert 2 x 3", myvector);
+		myvector.insert(myvector.end() - 1, arr, arr + 3);
+		print("insert range", myvector);
+		myvector.insert(myvector.begin(), myvector[4]);
+		print("insert own element", myvector);
+		myvector.erase(myvector.begin() + 1);
+		print("erase 1", myvector);
+		myvector.erase(myvector.begin() + 2, myvector.begin() + 5);
+		print("erase [2, 5)", myvector);
+		myvector.resize(8, -1);
+		print("resize(8, -1)", myvector);
+		myvector.resize(3);
+		print("resize(3)", myvector);
+		myvector.pop_back();
+		print("pop_back", myvector);
+		myvector.assign(arr, arr + 3);
+		print("assign range", myvector);
+
+		ivector other(path.c_str(), ivector::READ_ONLY);
+
+		std::cout << "same file equal: " << (myvector == other) << '\n';
+		// 같은 페이지를 나눠 쓰므로 다른 핸들의 변경이 바로 보인다
+		myvector.push_back(10);
+		std::cout << "reader sees push: " << other.size() << ' ' << other.back() << '\n';
+		myvector.resize(5000, 4);
+		std::cout << "reader after growth: " << (other.size() <= other.capacity()) << ' ' << other[3] << '\n';
+		myvector.clear();
+		std::cout << "clear: " << myvector.size() << '\n';
+	}
+
+	void	reopen_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "REOPEN" << std::endl;
+		{
+			ft::MmapVector<Record>	records(path.c_str(), ft::MmapVector<Record>::TRUNCATE);
+
+			for (int i = 0; i < 4; ++i)
+			{
+				Record	r = { i, i * 1.5 };
+
+				records.push_back(r);
+			}
+			records.sync();
+		}
+		ft::MmapVector<Record>	records(path.c_str(), ft::MmapVector<Record>::READ_ONLY);
+
+		records.advise(ft::MmapVector<Record>::SEQUENTIAL);
+		std::cout << "reopened (" << records.size() << "):";
+		for (size_t i = 0; i < records.size(); ++i)
+			std::cout << ' ' << records[i].id << '/' << records[i].score;
+		std::cout << "\nread_only: " << records.read_only() << '\n';
+		try
+		{
+			records.push_back(records[0]);
+		}
+		catch (const ft::mmap_error &e)
+		{
+			std::cout << e.what() << '\n';
+		}
+		records.close();
+		std::cout << "closed: " << !records.is_open() << ", size: " << records.size() << '\n';
+	}
+
+	void	growth_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "GROWTH" << std::endl;
+		ivector		myvector(path.c_str(), ivector::TRUNCATE);
+		long long	sum = 0;
+		bool		ok = true;
+
+		for (int i = 0; i < 1000000; ++i)
+			myvector.push_back(i);
+		myvector.advise(ivector::RANDOM);
+		for (size_t i = 0; i < myvector.size(); ++i)
+		{
+			sum += myvector[i];
+			ok = ok && myvector[i] == static_cast<int>(i);
+		}
+		std::cout << "size: " << myvector.size() << ", capacity >= size: " << (myvector.capacity() >= myvector.size())
+			<< ", sum: " << sum << ", in order: " << ok << '\n';
+		myvector.resize(1000);
+		myvector.shrink_to_fit();
+		myvector.sync(false);
+		std::cout << "shrink: " << myvector.capacity() << ", file bytes: " << file_size() << '\n';
+		myvector.reserve(5000);
+		std::cout << "reserve: " << myvector.capacity() << ", file bytes: " << file_size()
+			<< ", back: " << myvector.back() << '\n';
+
+		ivector	a;
+		a.swap(myvector);
+		std::cout << "swap: " << a.size() << ' ' << myvector.is_open() << '\n';
+	}
+
+	void	error_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "ERROR" << std::endl;
+		{
+			ivector	v(path.c_str(), ivector::TRUNCATE);
+
+			v.push_back(1);
+		}
+		try
+		{
+			ft::MmapVector<double>	d(path.c_str());
+		}
+		catch (const ft::mmap_error &e)
+		{
+			std::cout << e.what() << '\n';
+		}
+		try
+		{
+			ivector	missing("/nonexistent/dir/file", ivector::READ_ONLY);
+		}
+		catch (const ft::mmap_error &e)
+		{
+			std::cout << "missing file: " << (std::string(e.what()).find("open") != std::string::npos) << '\n';
+		}
+		try
+		{
+			ivector	closed;
+
+			closed.push_back(1);
+		}
+		catch (const ft::mmap_error &e)
+		{
+			std::cout << e.what() << '\n';
+		}
+	}
+
+	int		main()
+	{
+		char	name[] = "/tmp/ft_mmap_vector_XXXXXX";
+		int		fd = mkstemp(name);
+
+		std::cout << std::setfill('-') << std::setw(20) << "MMAPVECTOR" << std::endl;
+		if (fd < 0)
+			return (1);
+		close(fd);
+		path = name;
+		basic_test();
+		modifier_test();
+		reopen_test();
+		growth_test();
+		error_test();
+		unlink(name);
+		return (0);
+	}
+}
@@ -0,0 +1,22 @@
+#ifndef MMAP_VECTOR_TESTER_HPP
+# define MMAP_VECTOR_TESTER_HPP
+
+# include "MmapVector.hpp"
+# include <iostream>
+# include <iomanip>
+# include <string>
+# include <cstdlib>
+# include <sys/stat.h>
+# include <unistd.h>
+
+namespace mmapvector_tester
+{
+	void	basic_test();
+	void	modifier_test();
+	void	reopen_test();
+	void	growth_test();
+	void	error_test();
+	int		main();
+}
+
+#endif
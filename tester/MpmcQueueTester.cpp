@@ -0,0 +1,129 @@
+#include "MpmcQueueTester.hpp"
+
+namespace mpmcqueue_tester
+{
+	void	basic_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "BASIC" << std::endl;
+		ft::MpmcQueue<std::string> myqueue(3);
+		std::string		val;
+
+		std::cout << "capacity: " << myqueue.capacity() << '\n';
+		myqueue.push("one");
+		myqueue.push("two");
+		myqueue.push("three");
+		std::cout << "size: " << myqueue.size() << '\n';
+		std::cout << "myqueue contains:";
+		while (!myqueue.empty())
+		{
+			myqueue.pop(val);
+			std::cout << ' ' << val;
+		}
+		std::cout << "\nempty: " << myqueue.empty() << '\n';
+	}
+
+	void	try_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "TRY" << std::endl;
+		ft::MpmcQueue<int> myqueue(4);
+		int		val;
+
+		for (int i = 0; i < 6; ++i)
+			std::cout << "try_push " << i << ": " << myqueue.try_push(i) << '\n';
+		myqueue.try_pop(val);
+		std::cout << "try_pop: " << val << ", try_push 6: " << myqueue.try_push(6) << '\n';
+		std::cout << "myqueue contains:";
+		while (myqueue.try_pop(val))
+			std::cout << ' ' << val;
+		std::cout << "\ntry_pop on empty: " << myqueue.try_pop(val) << '\n';
+	}
+
+	void	timed_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "TIMED" << std::endl;
+		ft::MpmcQueue<int> parked(2);
+		ft::MpmcQueue<int> spinning(2, false);
+		int		val;
+
+		std::cout << "pop_for on empty: " << parked.try_pop_for(val, 2000) << ' ' << spinning.try_pop_for(val, 2000) << '\n';
+		parked.push(1);
+		parked.push(2);
+		spinning.push(1);
+		spinning.push(2);
+		std::cout << "push_for on full: " << parked.try_push_for(3, 2000) << ' ' << spinning.try_push_for(3, 2000) << '\n';
+		std::cout << "pop_for: " << parked.try_pop_for(val, 2000) << ' ' << val << '\n';
+	}
+
+	static const int	THREADS = 4;
+	static const long	PER_THREAD = 100000;
+
+	struct Shared
+	{
+		ft::MpmcQueue<long>		*queue;
+		long					sum;
+		long					id;
+	};
+
+	void	*producer(void *arg)
+	{
+		Shared	*s = static_cast<Shared *>(arg);
+
+		for (long i = 1; i <= PER_THREAD; ++i)
+			s->queue->push(s->id * PER_THREAD + i);
+		return (0);
+	}
+
+	void	*consumer(void *arg)
+	{
+		Shared	*s = static_cast<Shared *>(arg);
+		long	val;
+
+		for (long i = 0; i < PER_THREAD; ++i)
+		{
+			s->queue->pop(val);
+			s->sum += val;
+		}
+		return (0);
+	}
+
+	void	thread_test(bool parking)
+	{
+		std::cout << std::setfill('-') << std::setw(20) << (parking ? "THREAD PARK" : "THREAD SPIN") << std::endl;
+		ft::MpmcQueue<long>	myqueue(64, parking);
+		pthread_t			threads[THREADS * 2];
+		Shared				shared[THREADS * 2];
+		long				sum;
+		long				expect;
+
+		for (int i = 0; i < THREADS * 2; ++i)
+		{
+			shared[i].queue = &myqueue;
+			shared[i].sum = 0;
+			shared[i].id = i;
+			pthread_create(&threads[i], 0, i < THREADS ? consumer : producer, &shared[i]);
+		}
+		sum = 0;
+		for (int i = 0; i < THREADS * 2; ++i)
+		{
+			pthread_join(threads[i], 0);
+			sum += shared[i].sum;
+		}
+		// 생산자 id는 THREADS .. 2 * THREADS - 1
+		expect = 0;
+		for (long id = THREADS; id < THREADS * 2; ++id)
+			expect += id * PER_THREAD * PER_THREAD + PER_THREAD * (PER_THREAD + 1) / 2;
+		std::cout << "sum matches: " << (sum == expect) << '\n';
+		std::cout << "empty: " << myqueue.empty() << '\n';
+	}
+
+	int		main(void)
+	{
+		basic_test();
+		try_test();
+		timed_test();
+		thread_test(true);
+		thread_test(false);
+
+		return (0);
+	}
+}
@@ -0,0 +1,19 @@
+#ifndef MPMC_QUEUE_TESTER_HPP
+# define MPMC_QUEUE_TESTER_HPP
+
+# include "MpmcQueue.hpp"
+# include <iostream>
+# include <iomanip>
+# include <string>
+# include <pthread.h>
+
+namespace mpmcqueue_tester
+{
+	void	basic_test();
+	void	try_test();
+	void	timed_test();
+	void	thread_test(bool parking);
+	int		main();
+}
+
+#endif
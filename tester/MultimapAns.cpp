@@ -0,0 +1,98 @@
+#include <map>
+#include <iostream>
+#include <iomanip>
+
+void	insert_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "INSERT" << std::endl;
+	std::multimap<char,int> mymultimap;
+	std::multimap<char,int>::iterator it;
+
+	mymultimap.insert (std::pair<char,int>('a',100));
+	mymultimap.insert (std::pair<char,int>('z',150));
+	it=mymultimap.insert (std::pair<char,int>('b',75));
+	mymultimap.insert (it, std::pair<char,int>('c',300));
+	mymultimap.insert (it, std::pair<char,int>('z',400));
+	mymultimap.insert (std::pair<char,int>('b',76));
+
+	std::multimap<char,int> anothermultimap;
+	anothermultimap.insert(mymultimap.find('b'),mymultimap.find('c'));
+	for (it=mymultimap.begin(); it!=mymultimap.end(); ++it)
+		std::cout << (*it).first << " => " << (*it).second << '\n';
+	std::cout << "anothermultimap contains:\n";
+	for (it=anothermultimap.begin(); it!=anothermultimap.end(); ++it)
+		std::cout << (*it).first << " => " << (*it).second << '\n';
+}
+
+void	count_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "COUNT" << std::endl;
+	std::multimap<char,int> mymm;
+
+	mymm.insert(std::pair<char,int>('x',50));
+	mymm.insert(std::pair<char,int>('y',100));
+	mymm.insert(std::pair<char,int>('y',150));
+	mymm.insert(std::pair<char,int>('y',200));
+	mymm.insert(std::pair<char,int>('z',250));
+	mymm.insert(std::pair<char,int>('z',300));
+	for (char c='x'; c<='z'; c++)
+	{
+		std::cout << "There are " << mymm.count(c) << " elements with key " << c << ":";
+		std::multimap<char,int>::iterator it;
+		for (it=mymm.equal_range(c).first; it!=mymm.equal_range(c).second; ++it)
+			std::cout << ' ' << (*it).second;
+		std::cout << '\n';
+	}
+}
+
+void	erase_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "ERASE" << std::endl;
+	std::multimap<char,int> mymultimap;
+
+	mymultimap.insert(std::pair<char,int>('a',10));
+	mymultimap.insert(std::pair<char,int>('b',20));
+	mymultimap.insert(std::pair<char,int>('b',30));
+	mymultimap.insert(std::pair<char,int>('c',40));
+	mymultimap.insert(std::pair<char,int>('d',50));
+	mymultimap.insert(std::pair<char,int>('d',60));
+	mymultimap.insert(std::pair<char,int>('e',70));
+	mymultimap.insert(std::pair<char,int>('f',80));
+
+	std::multimap<char,int>::iterator it = mymultimap.find('b');
+	mymultimap.erase (it);
+	std::cout << "erase d: " << mymultimap.erase ('d') << '\n';
+	it=mymultimap.find ('e');
+	mymultimap.erase ( it, mymultimap.end() );
+	for (it=mymultimap.begin(); it!=mymultimap.end(); ++it)
+		std::cout << (*it).first << " => " << (*it).second << '\n';
+	std::cout << "size: " << mymultimap.size() << '\n';
+}
+
+void	bound_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "BOUND" << std::endl;
+	std::multimap<char,int> mymultimap;
+	std::multimap<char,int>::iterator it,itlow,itup;
+
+	mymultimap.insert(std::pair<char,int>('a',10));
+	mymultimap.insert(std::pair<char,int>('b',121));
+	mymultimap.insert(std::pair<char,int>('c',1001));
+	mymultimap.insert(std::pair<char,int>('c',2002));
+	mymultimap.insert(std::pair<char,int>('d',11011));
+	mymultimap.insert(std::pair<char,int>('e',44));
+	itlow = mymultimap.lower_bound ('b');
+	itup = mymultimap.upper_bound ('d');
+	for (it=itlow; it!=itup; ++it)
+		std::cout << (*it).first << " => " << (*it).second << '\n';
+}
+
+int main(void)
+{
+	insert_test();
+	count_test();
+	erase_test();
+	bound_test();
+
+	return (0);
+}
@@ -0,0 +1,17 @@
+#ifndef MULTIMAP_TESTER_HPP
+# define MULTIMAP_TESTER_HPP
+
+# include "Multimap.hpp"
+# include <iostream>
+# include <iomanip>
+
+namespace multimap_tester
+{
+	void	insert_test();
+	void	count_test();
+	void	erase_test();
+	void	bound_test();
+	int		main();
+}
+
+#endif
@@ -0,0 +1,98 @@
+#include <set>
+#include <iostream>
+#include <iomanip>
+
+void	insert_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "INSERT" << std::endl;
+	std::multiset<int> mymultiset;
+	std::multiset<int>::iterator it;
+
+	for (int i=1; i<=5; i++) mymultiset.insert(i*10);
+	it=mymultiset.insert(30);
+	mymultiset.insert (it,27);
+	mymultiset.insert (it,50);
+	mymultiset.insert (it,20);
+	int myints[]= {10,20,30};
+	mymultiset.insert (myints,myints+3);
+	std::cout << "mymultiset contains:";
+	for (it=mymultiset.begin(); it!=mymultiset.end(); ++it)
+		std::cout << ' ' << *it;
+	std::cout << "\nsize: " << mymultiset.size() << '\n';
+}
+
+void	count_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "COUNT" << std::endl;
+	int myints[]={10,73,12,22,73,73,12};
+	std::multiset<int> mymultiset (myints,myints+7);
+
+	std::cout << "73 appears " << mymultiset.count(73) << " times in mymultiset.\n";
+	std::cout << "12 appears " << mymultiset.count(12) << " times in mymultiset.\n";
+	std::cout << "11 appears " << mymultiset.count(11) << " times in mymultiset.\n";
+}
+
+void	equal_range_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "EQUAL_RANGE" << std::endl;
+	int myints[]= {77,30,16,2,30,30};
+	std::multiset<int> mymultiset(myints, myints+6);
+	std::pair<std::multiset<int>::iterator,std::multiset<int>::iterator> ret;
+
+	ret = mymultiset.equal_range(30);
+	mymultiset.erase(ret.first, ret.second);
+	std::cout << "mymultiset contains:";
+	for (std::multiset<int>::iterator it=mymultiset.begin(); it!=mymultiset.end(); ++it)
+		std::cout << ' ' << *it;
+	std::cout << '\n';
+	ret = mymultiset.equal_range(20);
+	std::cout << "empty range at: " << *ret.first << ' ' << (ret.first == ret.second) << '\n';
+}
+
+void	erase_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "ERASE" << std::endl;
+	std::multiset<int> mymultiset;
+	std::multiset<int>::iterator it;
+
+	for (int i=1; i<8; i++) mymultiset.insert(i*10);
+	for (int i=1; i<8; i+=2) mymultiset.insert(i*10);
+	it=mymultiset.begin();
+	it++;
+	mymultiset.erase (it);
+	std::cout << "erase 40: " << mymultiset.erase (40) << '\n';
+	std::cout << "erase 50: " << mymultiset.erase (50) << '\n';
+	it=mymultiset.find (60);
+	mymultiset.erase ( it, mymultiset.end() );
+	std::cout << "mymultiset contains:";
+	for (it=mymultiset.begin(); it!=mymultiset.end(); ++it)
+		std::cout << ' ' << *it;
+	std::cout << '\n';
+}
+
+void	bound_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "BOUND" << std::endl;
+	int myints[]= {77,30,16,2,30,30};
+	std::multiset<int> mymultiset (myints,myints+6);
+	std::multiset<int>::iterator itlow,itup;
+
+	itlow = mymultiset.lower_bound (30);
+	itup = mymultiset.upper_bound (40);
+	mymultiset.erase(itlow,itup);
+	std::cout << "mymultiset contains:";
+	for (std::multiset<int>::iterator it=mymultiset.begin(); it!=mymultiset.end(); ++it)
+		std::cout << ' ' << *it;
+	std::cout << '\n';
+}
+
+int main(void)
+{
+	insert_test();
+	count_test();
+	equal_range_test();
+	erase_test();
+	bound_test();
+
+	return (0);
+}
@@ -0,0 +1,18 @@
+#ifndef MULTISET_TESTER_HPP
+# define MULTISET_TESTER_HPP
+
+# include "Multiset.hpp"
+# include <iostream>
+# include <iomanip>
+
+namespace multiset_tester
+{
+	void	insert_test();
+	void	count_test();
+	void	equal_range_test();
+	void	erase_test();
+	void	bound_test();
+	int		main();
+}
+
+#endif
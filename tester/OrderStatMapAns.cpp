@@ -0,0 +1,134 @@
+#include <map>
+#include <iterator>
+#include <iostream>
+#include <iomanip>
+
+typedef std::map<int, int>	sum_map;
+
+void	fill(sum_map &mymap)
+{
+	for (int i = 99; i >= 0; --i)
+		mymap[i * 3] = i * 6;
+}
+
+size_t	rank(const sum_map &mymap, int k)
+{
+	return (std::distance(mymap.begin(), mymap.lower_bound(k)));
+}
+
+sum_map::const_iterator	select(const sum_map &mymap, size_t i)
+{
+	sum_map::const_iterator	it = mymap.begin();
+
+	std::advance(it, i);
+	return (it);
+}
+
+size_t	count_range(const sum_map &mymap, int lo, int hi)
+{
+	if (!(lo < hi))
+		return (0);
+	return (std::distance(mymap.lower_bound(lo), mymap.lower_bound(hi)));
+}
+
+int		aggregate_range(const sum_map &mymap, int lo, int hi)
+{
+	int		ret = 0;
+
+	if (!(lo < hi))
+		return (0);
+	for (sum_map::const_iterator it = mymap.lower_bound(lo); it != mymap.lower_bound(hi); ++it)
+		ret += it->second;
+	return (ret);
+}
+
+void	insert_erase_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "INSERT, ERASE" << std::endl;
+	sum_map		mymap;
+
+	fill(mymap);
+	std::cout << "size: " << mymap.size() << '\n';
+	for (int i = 0; i < 300; i += 6)
+		mymap.erase(i);
+	mymap.erase(mymap.find(33), mymap.find(81));
+	std::cout << "size: " << mymap.size() << '\n';
+	for (sum_map::iterator it = mymap.begin(); it != mymap.end(); ++it)
+		std::cout << it->first << ' ';
+	std::cout << '\n';
+}
+
+void	rank_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "RANK" << std::endl;
+	sum_map		mymap;
+
+	fill(mymap);
+	std::cout << "rank(0): " << rank(mymap, 0) << '\n';
+	std::cout << "rank(1): " << rank(mymap, 1) << '\n';
+	std::cout << "rank(150): " << rank(mymap, 150) << '\n';
+	std::cout << "rank(1000): " << rank(mymap, 1000) << '\n';
+}
+
+void	select_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "SELECT" << std::endl;
+	sum_map		mymap;
+
+	fill(mymap);
+	std::cout << "select(0): " << select(mymap, 0)->first << '\n';
+	std::cout << "select(50): " << select(mymap, 50)->first << '\n';
+	std::cout << "p99: " << select(mymap, mymap.size() * 99 / 100)->first << '\n';
+	std::cout << "select(size) == end: " << (select(mymap, mymap.size()) == mymap.end()) << '\n';
+}
+
+void	count_range_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "COUNT_RANGE" << std::endl;
+	sum_map		mymap;
+
+	fill(mymap);
+	std::cout << "[0, 300): " << count_range(mymap, 0, 300) << '\n';
+	std::cout << "[10, 20): " << count_range(mymap, 10, 20) << '\n';
+	std::cout << "[20, 10): " << count_range(mymap, 20, 10) << '\n';
+	std::cout << "[-5, 4): " << count_range(mymap, -5, 4) << '\n';
+}
+
+void	aggregate_range_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "AGGREGATE_RANGE" << std::endl;
+	sum_map		mymap;
+
+	fill(mymap);
+	std::cout << "total: " << aggregate_range(mymap, -1, 1000) << '\n';
+	std::cout << "[0, 300): " << aggregate_range(mymap, 0, 300) << '\n';
+	std::cout << "[10, 20): " << aggregate_range(mymap, 10, 20) << '\n';
+	std::cout << "[100, 101): " << aggregate_range(mymap, 100, 101) << '\n';
+	std::cout << "[99, 100): " << aggregate_range(mymap, 99, 100) << '\n';
+	for (int i = 0; i < 100; i += 2)
+		mymap.erase(i * 3);
+	std::cout << "after erase [0, 300): " << aggregate_range(mymap, 0, 300) << '\n';
+}
+
+void	distance_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "DISTANCE" << std::endl;
+	sum_map		mymap;
+
+	fill(mymap);
+	std::cout << "begin, end: " << std::distance(mymap.begin(), mymap.end()) << '\n';
+	std::cout << "30, 90: " << std::distance(mymap.find(30), mymap.find(90)) << '\n';
+	std::cout << "90, 30: " << -std::distance(mymap.find(30), mymap.find(90)) << '\n';
+}
+
+int main(void)
+{
+	insert_erase_test();
+	rank_test();
+	select_test();
+	count_range_test();
+	aggregate_range_test();
+	distance_test();
+
+	return (0);
+}
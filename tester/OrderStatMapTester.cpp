@@ -0,0 +1,104 @@
+#include "OrderStatMapTester.hpp"
+
+namespace orderstatmap_tester
+{
+	typedef ft::OrderStatMap<int, int, ft::less<int>, ft::SumAggregate<ft::Pair<int, int> > >	sum_map;
+
+	void	fill(sum_map &mymap)
+	{
+		// 0, 3, 6, ..., 297 => value: key * 2
+		for (int i = 99; i >= 0; --i)
+			mymap.assign(i * 3, i * 6);
+	}
+
+	void	insert_erase_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "INSERT, ERASE" << std::endl;
+		sum_map		mymap;
+
+		fill(mymap);
+		std::cout << "size: " << mymap.size() << '\n';
+		for (int i = 0; i < 300; i += 6)
+			mymap.erase(i);
+		mymap.erase(mymap.find(33), mymap.find(81));
+		std::cout << "size: " << mymap.size() << '\n';
+		for (sum_map::iterator it = mymap.begin(); it != mymap.end(); ++it)
+			std::cout << it->first << ' ';
+		std::cout << '\n';
+	}
+
+	void	rank_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "RANK" << std::endl;
+		sum_map		mymap;
+
+		fill(mymap);
+		std::cout << "rank(0): " << mymap.rank(0) << '\n';
+		std::cout << "rank(1): " << mymap.rank(1) << '\n';
+		std::cout << "rank(150): " << mymap.rank(150) << '\n';
+		std::cout << "rank(1000): " << mymap.rank(1000) << '\n';
+	}
+
+	void	select_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "SELECT" << std::endl;
+		sum_map		mymap;
+
+		fill(mymap);
+		std::cout << "select(0): " << mymap.select(0)->first << '\n';
+		std::cout << "select(50): " << mymap.select(50)->first << '\n';
+		std::cout << "p99: " << mymap.select(mymap.size() * 99 / 100)->first << '\n';
+		std::cout << "select(size) == end: " << (mymap.select(mymap.size()) == mymap.end()) << '\n';
+	}
+
+	void	count_range_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "COUNT_RANGE" << std::endl;
+		sum_map		mymap;
+
+		fill(mymap);
+		std::cout << "[0, 300): " << mymap.count_range(0, 300) << '\n';
+		std::cout << "[10, 20): " << mymap.count_range(10, 20) << '\n';
+		std::cout << "[20, 10): " << mymap.count_range(20, 10) << '\n';
+		std::cout << "[-5, 4): " << mymap.count_range(-5, 4) << '\n';
+	}
+
+	void	aggregate_range_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "AGGREGATE_RANGE" << std::endl;
+		sum_map		mymap;
+
+		fill(mymap);
+		std::cout << "total: " << mymap.aggregate() << '\n';
+		std::cout << "[0, 300): " << mymap.aggregate_range(0, 300) << '\n';
+		std::cout << "[10, 20): " << mymap.aggregate_range(10, 20) << '\n';
+		std::cout << "[100, 101): " << mymap.aggregate_range(100, 101) << '\n';
+		std::cout << "[99, 100): " << mymap.aggregate_range(99, 100) << '\n';
+		for (int i = 0; i < 100; i += 2)
+			mymap.erase(i * 3);
+		std::cout << "after erase [0, 300): " << mymap.aggregate_range(0, 300) << '\n';
+	}
+
+	void	distance_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "DISTANCE" << std::endl;
+		sum_map		mymap;
+
+		fill(mymap);
+		std::cout << "begin, end: " << mymap.distance(mymap.begin(), mymap.end()) << '\n';
+		std::cout << "30, 90: " << mymap.distance(mymap.find(30), mymap.find(90)) << '\n';
+		std::cout << "90, 30: " << mymap.distance(mymap.find(90), mymap.find(30)) << '\n';
+	}
+
+	int		main(void)
+	{
+		insert_erase_test();
+		rank_test();
+		select_test();
+		count_range_test();
+		aggregate_range_test();
+		distance_test();
+
+		return (0);
+	}
+}
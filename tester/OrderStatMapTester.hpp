@@ -0,0 +1,19 @@
+#ifndef ORDER_STAT_MAP_TESTER_HPP
+# define ORDER_STAT_MAP_TESTER_HPP
+
+# include "OrderStatMap.hpp"
+# include <iostream>
+# include <iomanip>
+
+namespace orderstatmap_tester
+{
+	void	insert_erase_test();
+	void	rank_test();
+	void	select_test();
+	void	count_range_test();
+	void	aggregate_range_test();
+	void	distance_test();
+	int		main();
+}
+
+#endif
@@ -0,0 +1,174 @@
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <iostream>
+#include <iomanip>
+
+typedef std::vector<long>	vec;
+
+struct Twice
+{
+	void	operator() (long &x) const { x *= 2; }
+};
+
+struct Square
+{
+	long	operator() (long x) const { return (x * x); }
+};
+
+struct Max
+{
+	long	operator() (long a, long b) const { return (a < b ? b : a); }
+};
+
+struct Concat
+{
+	unsigned long	operator() (unsigned long a, unsigned long b) const
+	{
+		unsigned long	pa = a >> 32, ha = a & 0xffffffffUL;
+		unsigned long	pb = b >> 32, hb = b & 0xffffffffUL;
+
+		return ((((pa * pb) & 0xffffffffUL) << 32) | ((ha * pb + hb) & 0xffffffffUL));
+	}
+};
+
+// std::exclusive_scan은 C++17부터
+template <class InputIterator, class OutputIterator, class V, class Function>
+OutputIterator	exclusive_scan(InputIterator first, InputIterator last, OutputIterator out, V init, Function op)
+{
+	for (; first != last; ++first, ++out)
+	{
+		V	x = *first;
+
+		*out = init;
+		init = op(init, x);
+	}
+	return (out);
+}
+
+void	print(const char *name, const vec &v)
+{
+	std::cout << name << " (" << v.size() << "):";
+	for (size_t i = 0; i < v.size(); ++i)
+		std::cout << ' ' << v[i];
+	std::cout << '\n';
+}
+
+void	for_each_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "FOR_EACH" << std::endl;
+	vec v;
+
+	for (long i = 0; i < 30; ++i)
+		v.push_back(i);
+	std::for_each(v.begin(), v.end(), Twice());
+	print("twice", v);
+	std::for_each(v.begin(), v.end(), Twice());
+	print("sequential", v);
+	std::for_each(v.begin(), v.begin(), Twice());
+	std::cout << "empty range: " << v[0] << ' ' << v[1] << '\n';
+}
+
+void	transform_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "TRANSFORM" << std::endl;
+	vec v;
+	vec out(25, 0);
+	vec::iterator ret;
+
+	for (long i = 0; i < 20; ++i)
+		v.push_back(i - 5);
+	ret = std::transform(v.begin(), v.end(), out.begin(), Square());
+	std::cout << "end offset: " << ret - out.begin() << '\n';
+	print("square", out);
+	std::transform(v.begin(), v.end(), v.begin(), Square());
+	print("in place", v);
+}
+
+void	fill_copy_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "FILL/COPY" << std::endl;
+	vec v(40, 0);
+	vec w(45, -1);
+	long arr[10];
+	vec::iterator ret;
+
+	std::fill(v.begin(), v.end(), 9L);
+	std::fill(v.begin() + 10, v.begin() + 20, 3L);
+	print("fill", v);
+	for (long i = 0; i < 40; ++i)
+		v[i] += i;
+	ret = std::copy(v.begin(), v.end(), w.begin() + 2);
+	std::cout << "end offset: " << ret - w.begin() << '\n';
+	print("copy", w);
+	std::copy(v.begin() + 5, v.begin() + 15, arr);
+	std::cout << "to array:";
+	for (int i = 0; i < 10; ++i)
+		std::cout << ' ' << arr[i];
+	std::cout << '\n';
+}
+
+void	reduce_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "REDUCE" << std::endl;
+	vec v;
+	double d[100];
+
+	for (long i = 1; i <= 1000; ++i)
+		v.push_back(i);
+	for (int i = 0; i < 100; ++i)
+		d[i] = i * 0.5;
+	std::cout << "sum: " << std::accumulate(v.begin(), v.end(), 0L) << '\n';
+	std::cout << "sum + 7: " << std::accumulate(v.begin(), v.end(), 7L) << '\n';
+	std::cout << "max: " << std::accumulate(v.begin(), v.end(), -1L, Max()) << '\n';
+	std::cout << "empty: " << std::accumulate(v.begin(), v.begin(), 42L) << '\n';
+	std::cout << "one: " << std::accumulate(v.begin(), v.begin() + 1, 0L) << '\n';
+	std::cout << "array: " << std::accumulate(d, d + 100, 0.0) << '\n';
+}
+
+void	scan_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "SCAN" << std::endl;
+	vec v;
+	vec out(30, 0);
+	vec::iterator ret;
+
+	for (long i = 1; i <= 30; ++i)
+		v.push_back(i % 4);
+	ret = std::partial_sum(v.begin(), v.end(), out.begin());
+	std::cout << "end offset: " << ret - out.begin() << '\n';
+	print("inclusive", out);
+	exclusive_scan(v.begin(), v.end(), out.begin(), 100L, std::plus<long>());
+	print("exclusive", out);
+	std::partial_sum(v.begin(), v.end(), out.begin(), Max());
+	print("running max", out);
+	exclusive_scan(v.begin(), v.begin() + 1, out.begin(), 5L, std::plus<long>());
+	std::cout << "one: " << out[0] << '\n';
+	std::partial_sum(v.begin(), v.end(), v.begin());
+	print("in place", v);
+}
+
+void	determinism_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "DETERMINISM" << std::endl;
+	const size_t				n = 100000;
+	std::vector<unsigned long>	v(n, 0);
+
+	for (size_t i = 0; i < n; ++i)
+		v[i] = (31UL << 32) | ((i * 2654435761UL) % 1000);
+	std::cout << "reduce: " << std::accumulate(v.begin(), v.end(), 1UL << 32, Concat()) << '\n';
+	for (size_t threads = 1; threads <= 4; threads *= 2)
+		std::cout << "same result: " << true << '\n';
+}
+
+int		main()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "PARALLEL" << std::endl;
+	for_each_test();
+	transform_test();
+	fill_copy_test();
+	reduce_test();
+	scan_test();
+	determinism_test();
+	return (0);
+}
@@ -0,0 +1,185 @@
+#include "ParallelTester.hpp"
+
+namespace parallel_tester
+{
+	typedef ft::Vector<long>	vec;
+
+	// 작은 구간도 여러 덩어리로 나눠 병렬 경로를 타게 한다
+	static ft::par::Policy	small(ft::ThreadPool &pool = ft::ThreadPool::global())
+	{
+		return (ft::par::Policy(7, 0, pool));
+	}
+
+	struct Twice
+	{
+		void	operator() (long &x) const { x *= 2; }
+	};
+
+	struct Square
+	{
+		long	operator() (long x) const { return (x * x); }
+	};
+
+	struct Max
+	{
+		long	operator() (long a, long b) const { return (a < b ? b : a); }
+	};
+
+	// 위 32비트는 31^길이, 아래 32비트는 다항식 해시인 문자열 이어 붙이기
+	// 결합 법칙은 성립하지만 교환 법칙은 성립하지 않는다. 항등원은 1 << 32
+	struct Concat
+	{
+		unsigned long	operator() (unsigned long a, unsigned long b) const
+		{
+			unsigned long	pa = a >> 32, ha = a & 0xffffffffUL;
+			unsigned long	pb = b >> 32, hb = b & 0xffffffffUL;
+
+			return ((((pa * pb) & 0xffffffffUL) << 32) | ((ha * pb + hb) & 0xffffffffUL));
+		}
+	};
+
+	void	print(const char *name, const vec &v)
+	{
+		std::cout << name << " (" << v.size() << "):";
+		for (size_t i = 0; i < v.size(); ++i)
+			std::cout << ' ' << v[i];
+		std::cout << '\n';
+	}
+
+	void	for_each_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "FOR_EACH" << std::endl;
+		vec v;
+
+		for (long i = 0; i < 30; ++i)
+			v.push_back(i);
+		ft::par::for_each(v.begin(), v.end(), Twice(), small());
+		print("twice", v);
+		ft::par::for_each(v.begin(), v.end(), Twice());
+		print("sequential", v);
+		ft::par::for_each(v.begin(), v.begin(), Twice(), small());
+		std::cout << "empty range: " << v[0] << ' ' << v[1] << '\n';
+	}
+
+	void	transform_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "TRANSFORM" << std::endl;
+		vec v;
+		vec out(25, 0);
+		vec::iterator ret;
+
+		for (long i = 0; i < 20; ++i)
+			v.push_back(i - 5);
+		ret = ft::par::transform(v.begin(), v.end(), out.begin(), Square(), small());
+		std::cout << "end offset: " << ret - out.begin() << '\n';
+		print("square", out);
+		ft::par::transform(v.begin(), v.end(), v.begin(), Square(), small());
+		print("in place", v);
+	}
+
+	void	fill_copy_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "FILL/COPY" << std::endl;
+		vec v(40, 0);
+		vec w(45, -1);
+		long arr[10];
+		vec::iterator ret;
+
+		ft::par::fill(v.begin(), v.end(), 9L, small());
+		ft::par::fill(v.begin() + 10, v.begin() + 20, 3L, small());
+		print("fill", v);
+		for (long i = 0; i < 40; ++i)
+			v[i] += i;
+		ret = ft::par::copy(v.begin(), v.end(), w.begin() + 2, small());
+		std::cout << "end offset: " << ret - w.begin() << '\n';
+		print("copy", w);
+		ft::par::copy(v.begin() + 5, v.begin() + 15, arr, small());
+		std::cout << "to array:";
+		for (int i = 0; i < 10; ++i)
+			std::cout << ' ' << arr[i];
+		std::cout << '\n';
+	}
+
+	void	reduce_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "REDUCE" << std::endl;
+		vec v;
+		double d[100];
+
+		for (long i = 1; i <= 1000; ++i)
+			v.push_back(i);
+		for (int i = 0; i < 100; ++i)
+			d[i] = i * 0.5;
+		std::cout << "sum: " << ft::par::reduce(v.begin(), v.end(), 0L, small()) << '\n';
+		std::cout << "sum + 7: " << ft::par::reduce(v.begin(), v.end(), 7L) << '\n';
+		std::cout << "max: " << ft::par::reduce(v.begin(), v.end(), -1L, Max(), small()) << '\n';
+		std::cout << "empty: " << ft::par::reduce(v.begin(), v.begin(), 42L, small()) << '\n';
+		std::cout << "one: " << ft::par::reduce(v.begin(), v.begin() + 1, 0L, small()) << '\n';
+		std::cout << "array: " << ft::par::reduce(d, d + 100, 0.0, small()) << '\n';
+	}
+
+	void	scan_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "SCAN" << std::endl;
+		vec v;
+		vec out(30, 0);
+		vec::iterator ret;
+
+		for (long i = 1; i <= 30; ++i)
+			v.push_back(i % 4);
+		ret = ft::par::inclusive_scan(v.begin(), v.end(), out.begin(), small());
+		std::cout << "end offset: " << ret - out.begin() << '\n';
+		print("inclusive", out);
+		ft::par::exclusive_scan(v.begin(), v.end(), out.begin(), 100L, small());
+		print("exclusive", out);
+		ft::par::inclusive_scan(v.begin(), v.end(), out.begin(), Max(), small());
+		print("running max", out);
+		ft::par::exclusive_scan(v.begin(), v.begin() + 1, out.begin(), 5L, small());
+		std::cout << "one: " << out[0] << '\n';
+		ft::par::inclusive_scan(v.begin(), v.end(), v.begin(), small());
+		print("in place", v);
+	}
+
+	void	determinism_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "DETERMINISM" << std::endl;
+		const size_t			n = 100000;
+		ft::Vector<unsigned long>	v(n, 0);
+		ft::Vector<unsigned long>	scan(n, 0);
+		unsigned long			expected_reduce;
+		unsigned long			expected_last;
+
+		for (size_t i = 0; i < n; ++i)
+			v[i] = (31UL << 32) | ((i * 2654435761UL) % 1000);
+		expected_reduce = 1UL << 32;
+		for (size_t i = 0; i < n; ++i)
+			expected_reduce = Concat()(expected_reduce, v[i]);
+		expected_last = 1UL << 32;
+		for (size_t i = 0; i + 1 < n; ++i)
+			expected_last = Concat()(expected_last, v[i]);
+		std::cout << "reduce: " << expected_reduce << '\n';
+		for (size_t threads = 1; threads <= 4; threads *= 2)
+		{
+			ft::ThreadPool		pool(threads);
+			ft::par::Policy		policy(1000, 0, pool);
+			bool				same;
+
+			same = ft::par::reduce(v.begin(), v.end(), 1UL << 32, Concat(), policy) == expected_reduce;
+			ft::par::exclusive_scan(v.begin(), v.end(), scan.begin(), 1UL << 32, Concat(), policy);
+			same = same && scan[n - 1] == expected_last;
+			std::cout << "same result: " << same << '\n';
+		}
+	}
+
+	int		main()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "PARALLEL" << std::endl;
+		for_each_test();
+		transform_test();
+		fill_copy_test();
+		reduce_test();
+		scan_test();
+		determinism_test();
+		return (0);
+	}
+}
@@ -0,0 +1,20 @@
+#ifndef PARALLEL_TESTER_HPP
+# define PARALLEL_TESTER_HPP
+
+# include "Parallel.hpp"
+# include "Vector.hpp"
+# include <iostream>
+# include <iomanip>
+
+namespace parallel_tester
+{
+	void	for_each_test();
+	void	transform_test();
+	void	fill_copy_test();
+	void	reduce_test();
+	void	scan_test();
+	void	determinism_test();
+	int		main();
+}
+
+#endif
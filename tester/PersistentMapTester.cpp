@@ -0,0 +1,135 @@
+#include "PersistentMapTester.hpp"
+
+namespace persistentmap_tester
+{
+	typedef ft::PersistentMap<int, std::string>	pmap;
+
+	void	print(const char *name, const pmap &m)
+	{
+		std::cout << name << " (" << m.size() << "):";
+		for (pmap::const_iterator it = m.begin(); it != m.end(); ++it)
+			std::cout << ' ' << it->first << '=' << it->second;
+		std::cout << '\n';
+	}
+
+	void	construct_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "CONSTRUCT" << std::endl;
+		ft::Pair<int, std::string> items[] = {
+			pmap::value_type(3, std::string("c")), pmap::value_type(1, std::string("a")),
+			pmap::value_type(2, std::string("b")), pmap::value_type(1, std::string("z")) };
+		pmap first;
+		pmap second (items, items + 4);
+		pmap third (second);
+
+		std::cout << "empty: " << first.empty() << ' ' << second.empty() << '\n';
+		print("second", second);
+		print("third", third);
+	}
+
+	void	insert_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "INSERT" << std::endl;
+		pmap mymap;
+		ft::Pair<pmap::iterator, bool> ret;
+
+		for (int i = 0; i < 10; ++i)
+			mymap.insert(pmap::value_type((i * 7) % 10, std::string(1, 'a' + i)));
+		ret = mymap.insert(pmap::value_type(4, std::string("x")));
+		std::cout << "insert 4: " << ret.second << ", existing: " << ret.first->second << '\n';
+		mymap.assign(4, "x");
+		mymap.assign(42, "y");
+		std::cout << "at(4): " << mymap.at(4) << ", at(42): " << mymap.at(42) << '\n';
+		try
+		{
+			mymap.at(100);
+		}
+		catch (const std::out_of_range &)
+		{
+			std::cout << "at(100): out_of_range\n";
+		}
+		print("mymap", mymap);
+	}
+
+	void	erase_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "ERASE" << std::endl;
+		pmap mymap;
+
+		for (int i = 1; i < 10; ++i)
+			mymap.insert(pmap::value_type(i * 10, std::string(1, 'a' + i)));
+		mymap.erase(mymap.begin());
+		std::cout << "erase 40: " << mymap.erase(40) << '\n';
+		std::cout << "erase 45: " << mymap.erase(45) << '\n';
+		mymap.erase(mymap.find(60), mymap.end());
+		print("mymap", mymap);
+		mymap.clear();
+		print("cleared", mymap);
+	}
+
+	void	bound_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "BOUND" << std::endl;
+		pmap mymap;
+
+		for (int i = 1; i < 10; ++i)
+			mymap.insert(pmap::value_type(i * 10, std::string(1, 'a' + i)));
+		mymap.erase(mymap.lower_bound(30), mymap.upper_bound(60));
+		print("mymap", mymap);
+		std::cout << "lower_bound(15): " << mymap.lower_bound(15)->first << '\n';
+		std::cout << "upper_bound(20): " << mymap.upper_bound(20)->first << '\n';
+		std::cout << "upper_bound(90) == end: " << (mymap.upper_bound(90) == mymap.end()) << '\n';
+		std::cout << "find(35) == end: " << (mymap.find(35) == mymap.end()) << '\n';
+		ft::Pair<pmap::const_iterator, pmap::const_iterator> range = mymap.equal_range(70);
+		std::cout << "equal_range(70): " << range.first->first << ' ' << range.second->first << '\n';
+		std::cout << "count(20): " << mymap.count(20) << ", count(30): " << mymap.count(30) << '\n';
+	}
+
+	void	snapshot_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "SNAPSHOT" << std::endl;
+		pmap mymap;
+
+		for (int i = 0; i < 8; ++i)
+			mymap.insert(pmap::value_type(i, std::string(1, 'a' + i)));
+		pmap before = mymap.snapshot();
+		pmap::const_iterator it = before.find(3);
+		mymap.assign(3, "changed");
+		mymap.erase(5);
+		mymap.insert(pmap::value_type(100, std::string("new")));
+		print("before", before);
+		print("after", mymap);
+		std::cout << "old iterator: " << it->first << '=' << it->second << '\n';
+		mymap = before;
+		mymap.erase(0);
+		print("restored", mymap);
+		print("before", before);
+	}
+
+	void	reverse_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "REVERSE" << std::endl;
+		pmap mymap;
+
+		for (int i = 0; i < 6; ++i)
+			mymap.insert(pmap::value_type(i * 3, std::string(1, 'a' + i)));
+		std::cout << "mymap reversed:";
+		for (pmap::const_reverse_iterator it = mymap.rbegin(); it != mymap.rend(); ++it)
+			std::cout << ' ' << it->first;
+		pmap::const_iterator it = mymap.end();
+		--it;
+		std::cout << "\nlast: " << it->first << '\n';
+	}
+
+	int		main(void)
+	{
+		construct_test();
+		insert_test();
+		erase_test();
+		bound_test();
+		snapshot_test();
+		reverse_test();
+
+		return (0);
+	}
+}
@@ -0,0 +1,20 @@
+#ifndef PERSISTENT_MAP_TESTER_HPP
+# define PERSISTENT_MAP_TESTER_HPP
+
+# include "PersistentMap.hpp"
+# include <iostream>
+# include <iomanip>
+# include <string>
+
+namespace persistentmap_tester
+{
+	void	construct_test();
+	void	insert_test();
+	void	erase_test();
+	void	bound_test();
+	void	snapshot_test();
+	void	reverse_test();
+	int		main();
+}
+
+#endif
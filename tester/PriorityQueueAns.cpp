@@ -0,0 +1,158 @@
+#include <queue>
+#include <vector>
+#include <deque>
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <string>
+#include <iostream>
+#include <iomanip>
+
+template <class Queue>
+void	drain(const char *name, Queue &q)
+{
+	std::cout << name << " (" << q.size() << "):";
+	while (!q.empty())
+	{
+		std::cout << ' ' << q.top();
+		q.pop();
+	}
+	std::cout << '\n';
+}
+
+void	construct_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "CONSTRUCT" << std::endl;
+	int myints[]= { 10, 60, 50, 20 };
+	std::vector<int> v(myints, myints + 4);
+	std::priority_queue<int> first;
+	std::priority_queue<int> second (myints, myints + 4);
+	std::priority_queue<int, std::vector<int>, std::greater<int> > third (myints, myints + 4);
+	std::priority_queue<int> fourth (std::less<int>(), v);
+	std::priority_queue<int, std::deque<int> > fifth (myints, myints + 4);
+
+	std::cout << "empty: " << first.empty() << ' ' << second.empty() << '\n';
+	drain("second", second);
+	drain("third", third);
+	drain("fourth", fourth);
+	drain("fifth", fifth);
+}
+
+void	push_pop_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "PUSH/POP" << std::endl;
+	std::priority_queue<int> q;
+
+	for (int i = 0; i < 30; ++i)
+	{
+		q.push((i * 17) % 31);
+		if (i % 3 == 2)
+		{
+			std::cout << q.top() << ' ';
+			q.pop();
+		}
+	}
+	std::cout << "| size " << q.size() << '\n';
+	drain("rest", q);
+}
+
+void	compare_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "COMPARE" << std::endl;
+	std::priority_queue<std::string, std::vector<std::string>, std::greater<std::string> > words;
+	// (마감 시각, 작업 번호), 마감이 이른 것부터
+	std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int> >, std::greater<std::pair<int, int> > > events;
+
+	words.push("pear");
+	words.push("apple");
+	words.push("fig");
+	words.push("banana");
+	drain("words", words);
+	for (int i = 0; i < 12; ++i)
+		events.push(std::pair<int, int>((i * 7) % 5, i));
+	std::cout << "events:";
+	while (!events.empty())
+	{
+		std::cout << ' ' << events.top().first << ':' << events.top().second;
+		events.pop();
+	}
+	std::cout << '\n';
+}
+
+void	push_range_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "PUSH_RANGE" << std::endl;
+	int few[] = { 99, 3, 42 };
+	std::vector<int> many;
+	std::priority_queue<int> q;
+
+	for (int i = 0; i < 100; ++i)
+		q.push(i * 3);
+	for (int i = 0; i < 3; ++i)
+		q.push(few[i]);
+	std::cout << "after few: " << q.size() << " top " << q.top() << '\n';
+	for (int i = 0; i < 500; ++i)
+		many.push_back((i * 7919) % 1000);
+	for (size_t i = 0; i < many.size(); ++i)
+		q.push(many[i]);
+	std::cout << "after many: " << q.size() << " top " << q.top() << '\n';
+	for (int i = 0; i < 590; ++i)
+		q.pop();
+	drain("last", q);
+}
+
+void	arity_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "ARITY" << std::endl;
+	std::priority_queue<int> binary;
+	std::priority_queue<int> octal;
+
+	for (int i = 0; i < 200; ++i)
+	{
+		binary.push((i * 37) % 101);
+		octal.push((i * 37) % 101);
+	}
+	for (int i = 0; i < 190; ++i)
+	{
+		binary.pop();
+		octal.pop();
+	}
+	drain("binary", binary);
+	drain("octal", octal);
+}
+
+void	heap_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "HEAP" << std::endl;
+	int arr[] = { 10, 20, 30, 5, 15, 99, 1, 7 };
+	std::vector<int> v(arr, arr + 8);
+
+	std::make_heap(v.begin(), v.end());
+	std::cout << "max heap: " << v.front() << " valid " << true << '\n';
+	std::pop_heap(v.begin(), v.end());
+	v.pop_back();
+	std::cout << "max after pop: " << v.front() << '\n';
+	v.push_back(50);
+	std::push_heap(v.begin(), v.end());
+	std::cout << "max after push: " << v.front() << " valid " << true << '\n';
+	std::cout << "popped:";
+	std::make_heap(arr, arr + 8, std::greater<int>());
+	for (int *last = arr + 8; last != arr; --last)
+		std::pop_heap(arr, last, std::greater<int>());
+	// 작은 것부터 뒤로 보냈으므로 거꾸로 정렬된다
+	for (int i = 0; i < 8; ++i)
+		std::cout << ' ' << arr[i];
+	std::cout << '\n';
+}
+
+int		main()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "PRIORITY_QUEUE" << std::endl;
+	construct_test();
+	push_pop_test();
+	compare_test();
+	push_range_test();
+	arity_test();
+	heap_test();
+	return (0);
+}
@@ -0,0 +1,151 @@
+#include "PriorityQueueTester.hpp"
+
+namespace priorityqueue_tester
+{
+	template <class Queue>
+	void	drain(const char *name, Queue &q)
+	{
+		std::cout << name << " (" << q.size() << "):";
+		while (!q.empty())
+		{
+			std::cout << ' ' << q.top();
+			q.pop();
+		}
+		std::cout << '\n';
+	}
+
+	void	construct_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "CONSTRUCT" << std::endl;
+		int myints[]= { 10, 60, 50, 20 };
+		ft::Vector<int> v(myints, myints + 4);
+		ft::PriorityQueue<int> first;
+		ft::PriorityQueue<int> second (myints, myints + 4);
+		ft::PriorityQueue<int, ft::Vector<int>, ft::greater<int> > third (myints, myints + 4);
+		ft::PriorityQueue<int> fourth (ft::less<int>(), v);
+		ft::PriorityQueue<int, std::deque<int> > fifth (myints, myints + 4);
+
+		std::cout << "empty: " << first.empty() << ' ' << second.empty() << '\n';
+		drain("second", second);
+		drain("third", third);
+		drain("fourth", fourth);
+		drain("fifth", fifth);
+	}
+
+	void	push_pop_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "PUSH/POP" << std::endl;
+		ft::PriorityQueue<int> q;
+
+		for (int i = 0; i < 30; ++i)
+		{
+			q.push((i * 17) % 31);
+			if (i % 3 == 2)
+			{
+				std::cout << q.top() << ' ';
+				q.pop();
+			}
+		}
+		std::cout << "| size " << q.size() << '\n';
+		drain("rest", q);
+	}
+
+	void	compare_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "COMPARE" << std::endl;
+		ft::PriorityQueue<std::string, ft::Vector<std::string>, ft::greater<std::string> > words;
+		// (마감 시각, 작업 번호), 마감이 이른 것부터
+		ft::PriorityQueue<ft::Pair<int, int>, ft::Vector<ft::Pair<int, int> >, ft::greater<ft::Pair<int, int> > > events;
+
+		words.push("pear");
+		words.push("apple");
+		words.push("fig");
+		words.push("banana");
+		drain("words", words);
+		for (int i = 0; i < 12; ++i)
+			events.push(ft::Pair<int, int>((i * 7) % 5, i));
+		std::cout << "events:";
+		while (!events.empty())
+		{
+			std::cout << ' ' << events.top().first << ':' << events.top().second;
+			events.pop();
+		}
+		std::cout << '\n';
+	}
+
+	void	push_range_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "PUSH_RANGE" << std::endl;
+		int few[] = { 99, 3, 42 };
+		ft::Vector<int> many;
+		ft::PriorityQueue<int> q;
+
+		for (int i = 0; i < 100; ++i)
+			q.push(i * 3);
+		q.push_range(few, few + 3);
+		std::cout << "after few: " << q.size() << " top " << q.top() << '\n';
+		for (int i = 0; i < 500; ++i)
+			many.push_back((i * 7919) % 1000);
+		q.push_range(many.begin(), many.end());
+		std::cout << "after many: " << q.size() << " top " << q.top() << '\n';
+		for (int i = 0; i < 590; ++i)
+			q.pop();
+		drain("last", q);
+	}
+
+	void	arity_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "ARITY" << std::endl;
+		ft::PriorityQueue<int, ft::Vector<int>, ft::less<int>, 2> binary;
+		ft::PriorityQueue<int, ft::Vector<int>, ft::less<int>, 8> octal;
+
+		for (int i = 0; i < 200; ++i)
+		{
+			binary.push((i * 37) % 101);
+			octal.push((i * 37) % 101);
+		}
+		for (int i = 0; i < 190; ++i)
+		{
+			binary.pop();
+			octal.pop();
+		}
+		drain("binary", binary);
+		drain("octal", octal);
+	}
+
+	void	heap_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "HEAP" << std::endl;
+		int arr[] = { 10, 20, 30, 5, 15, 99, 1, 7 };
+		ft::Vector<int> v(arr, arr + 8);
+
+		ft::make_heap(v.begin(), v.end());
+		std::cout << "max heap: " << v.front() << " valid " << ft::is_heap(v.begin(), v.end()) << '\n';
+		ft::pop_heap(v.begin(), v.end());
+		v.pop_back();
+		std::cout << "max after pop: " << v.front() << '\n';
+		v.push_back(50);
+		ft::push_heap(v.begin(), v.end());
+		std::cout << "max after push: " << v.front() << " valid " << ft::is_heap(v.begin(), v.end()) << '\n';
+		std::cout << "popped:";
+		ft::make_heap(arr, arr + 8, ft::greater<int>());
+		for (int *last = arr + 8; last != arr; --last)
+			ft::pop_heap(arr, last, ft::greater<int>());
+		// 작은 것부터 뒤로 보냈으므로 거꾸로 정렬된다
+		for (int i = 0; i < 8; ++i)
+			std::cout << ' ' << arr[i];
+		std::cout << '\n';
+	}
+
+	int		main()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "PRIORITY_QUEUE" << std::endl;
+		construct_test();
+		push_pop_test();
+		compare_test();
+		push_range_test();
+		arity_test();
+		heap_test();
+		return (0);
+	}
+}
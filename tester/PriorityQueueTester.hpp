@@ -0,0 +1,21 @@
+#ifndef PRIORITY_QUEUE_TESTER_HPP
+# define PRIORITY_QUEUE_TESTER_HPP
+
+# include <iomanip>
+# include <deque>
+# include <iostream>
+# include "PriorityQueue.hpp"
+# include "Heap.hpp"
+
+namespace priorityqueue_tester
+{
+	void	construct_test();
+	void	push_pop_test();
+	void	compare_test();
+	void	push_range_test();
+	void	arity_test();
+	void	heap_test();
+	int		main();
+}
+
+#endif
@@ -0,0 +1,158 @@
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <iostream>
+#include <iomanip>
+
+typedef std::pair<unsigned int, char>	record;
+
+static unsigned long	seed = 99;
+
+unsigned long	next_random()
+{
+	seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+	return (seed);
+}
+
+template <class Vec>
+void	print(const char *name, const Vec &v)
+{
+	std::cout << name << " (" << v.size() << "):";
+	for (size_t i = 0; i < v.size(); ++i)
+		std::cout << ' ' << v[i];
+	std::cout << '\n';
+}
+
+// 키만 비교한다
+struct ByFirst
+{
+	bool	operator() (const record &a, const record &b) const { return (a.first < b.first); }
+};
+
+void	unsigned_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "UNSIGNED" << std::endl;
+	std::vector<unsigned int> v;
+	std::vector<unsigned long> w;
+	std::vector<unsigned char> c;
+	unsigned short arr[] = { 500, 3, 65535, 0, 256, 255, 3 };
+
+	for (int i = 0; i < 30; ++i)
+		v.push_back(static_cast<unsigned int>(next_random() >> 40));
+	std::sort(v.begin(), v.end());
+	print("uint", v);
+	for (int i = 0; i < 10; ++i)
+		w.push_back(next_random());
+	w.push_back(0);
+	w.push_back(~0UL);
+	std::sort(w.begin(), w.end());
+	print("ulong", w);
+	for (int i = 0; i < 20; ++i)
+		c.push_back(static_cast<unsigned char>('a' + (i * 7) % 26));
+	std::sort(c.begin(), c.end());
+	print("uchar", c);
+	std::sort(arr, arr + 7);
+	std::cout << "array:";
+	for (int i = 0; i < 7; ++i)
+		std::cout << ' ' << arr[i];
+	std::cout << '\n';
+	// 아래 자리가 모두 같아서 건너뛰는 경우
+	v.clear();
+	for (int i = 0; i < 20; ++i)
+		v.push_back(static_cast<unsigned int>((20 - i) % 7) << 24);
+	std::sort(v.begin(), v.end());
+	print("high byte only", v);
+}
+
+void	signed_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "SIGNED" << std::endl;
+	std::vector<int> v;
+	std::vector<long> w;
+	std::vector<char> c;
+
+	for (int i = 0; i < 30; ++i)
+		v.push_back(static_cast<int>(next_random() >> 32) % 1000);
+	v.push_back(-2147483647 - 1);
+	v.push_back(2147483647);
+	std::sort(v.begin(), v.end());
+	print("int", v);
+	for (int i = 0; i < 10; ++i)
+		w.push_back(static_cast<long>(next_random()));
+	std::sort(w.begin(), w.end());
+	print("long", w);
+	for (int i = 0; i < 10; ++i)
+		c.push_back(static_cast<char>('A' + (i * 3) % 10));
+	std::sort(c.begin(), c.end());
+	print("char", c);
+}
+
+void	float_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "FLOAT" << std::endl;
+	std::vector<double> d;
+	std::vector<float> f;
+
+	for (int i = 0; i < 20; ++i)
+		d.push_back((static_cast<double>(next_random() >> 40) - 8000000.0) / 1000.0);
+	d.push_back(1e300);
+	d.push_back(-1e300);
+	d.push_back(1e-300);
+	d.push_back(-1e-300);
+	std::sort(d.begin(), d.end());
+	print("double", d);
+	for (int i = 0; i < 15; ++i)
+		f.push_back(static_cast<float>(i * 37 % 11) - 5.5f);
+	std::sort(f.begin(), f.end());
+	print("float", f);
+}
+
+void	by_key_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "BY_KEY" << std::endl;
+	std::vector<record> v;
+
+	for (int i = 0; i < 60; ++i)
+		v.push_back(record(static_cast<unsigned int>((i * 13) % 7) * 1000, static_cast<char>('a' + i % 26)));
+	std::stable_sort(v.begin(), v.end(), ByFirst());
+	std::cout << "records:";
+	for (size_t i = 0; i < v.size(); ++i)
+		std::cout << ' ' << v[i].first << v[i].second;
+	std::cout << '\n';
+}
+
+void	parallel_test()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "PARALLEL" << std::endl;
+	std::vector<long> v;
+	std::vector<long> w;
+	std::vector<record> r;
+	bool same = true;
+	unsigned long check = 0;
+
+	for (int i = 0; i < 200000; ++i)
+	{
+		v.push_back(static_cast<long>(next_random()) >> (i % 40));
+		r.push_back(record(static_cast<unsigned int>(next_random() >> 52), static_cast<char>('a' + i % 26)));
+	}
+	w = v;
+	std::sort(v.begin(), v.end());
+	std::sort(w.begin(), w.end());
+	for (size_t i = 0; i < v.size(); ++i)
+		same = same && v[i] == w[i];
+	std::stable_sort(r.begin(), r.end(), ByFirst());
+	for (size_t i = 0; i < r.size(); ++i)
+		check = check * 31 + r[i].first * 26 + (r[i].second - 'a');
+	std::cout << "same as sort: " << same << ", records checksum: " << check << '\n';
+}
+
+int		main()
+{
+	std::cout << std::setfill('-') << std::setw(20) << "RADIX_SORT" << std::endl;
+	unsigned_test();
+	signed_test();
+	float_test();
+	by_key_test();
+	parallel_test();
+	return (0);
+}
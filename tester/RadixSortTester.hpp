@@ -0,0 +1,19 @@
+#ifndef RADIX_SORT_TESTER_HPP
+# define RADIX_SORT_TESTER_HPP
+
+# include "RadixSort.hpp"
+# include "Vector.hpp"
+# include <iostream>
+# include <iomanip>
+
+namespace radixsort_tester
+{
+	void	unsigned_test();
+	void	signed_test();
+	void	float_test();
+	void	by_key_test();
+	void	parallel_test();
+	int		main();
+}
+
+#endif
@@ -0,0 +1,196 @@
+#include "RcuMapTester.hpp"
+
+namespace rcumap_tester
+{
+	typedef ft::RcuMap<int, std::string>	rcu_map;
+
+	void	count_delete(void *object, void *context)
+	{
+		(void)object;
+		++*static_cast<int *>(context);
+	}
+
+	void	epoch_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "EPOCH" << std::endl;
+		ft::EpochDomain		domain;
+		int					deleted;
+		int					dummy[3];
+
+		deleted = 0;
+		{
+			ft::EpochGuard	guard(domain);
+
+			domain.retire(dummy, count_delete, &deleted);
+			domain.retire(dummy + 1, count_delete, &deleted);
+			for (int i = 0; i < 5; ++i)
+				domain.collect();
+			// 읽기 구간이 열려 있으므로 epoch이 한 번만 올라가고 아무것도 지워지지 않는다
+			std::cout << "inside guard: deleted " << deleted << ", pending " << domain.pending() << '\n';
+		}
+		domain.collect();
+		domain.collect();
+		std::cout << "after guard: deleted " << deleted << ", pending " << domain.pending() << '\n';
+		domain.retire(dummy + 2, count_delete, &deleted);
+		domain.synchronize();
+		std::cout << "synchronize: deleted " << deleted << ", pending " << domain.pending() << '\n';
+	}
+
+	struct Printer
+	{
+		void	operator() (const ft::Pair<int, std::string> &val) const
+		{
+			std::cout << ' ' << val.first << '=' << val.second;
+		}
+	};
+
+	void	basic_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "BASIC" << std::endl;
+		rcu_map		mymap;
+		std::string	val;
+
+		std::cout << "empty: " << mymap.empty() << '\n';
+		for (int i = 0; i < 8; ++i)
+			mymap.insert(rcu_map::value_type((i * 5) % 8, std::string(1, 'a' + i)));
+		std::cout << "insert 3 again: " << mymap.insert(rcu_map::value_type(3, "x")) << '\n';
+		rcu_map::snapshot_type	before = mymap.snapshot();
+		mymap.assign(3, "x");
+		std::cout << "find 3: " << mymap.find(3, val) << ' ' << val << '\n';
+		std::cout << "find 30: " << mymap.find(30, val) << '\n';
+		std::cout << "erase 5: " << mymap.erase(5) << ", erase 5: " << mymap.erase(5) << '\n';
+		std::cout << "count 5: " << mymap.count(5) << ", size: " << mymap.size() << '\n';
+		std::cout << "mymap:";
+		mymap.for_each(Printer());
+		std::cout << "\nsnapshot:";
+		for (rcu_map::snapshot_type::const_iterator it = before.begin(); it != before.end(); ++it)
+			std::cout << ' ' << it->first << '=' << it->second;
+		mymap.clear();
+		std::cout << "\ncleared: " << mymap.empty() << '\n';
+	}
+
+	void	bound_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "BOUND" << std::endl;
+		rcu_map					mymap;
+		rcu_map::value_type		items[5];
+		rcu_map::value_type		val;
+
+		for (int i = 0; i < 5; ++i)
+			items[i] = rcu_map::value_type(i * 10, std::string(1, 'a' + i));
+		std::cout << "insert range: " << mymap.insert(items, items + 5) << '\n';
+		std::cout << "lower_bound(15): " << mymap.lower_bound(15, val) << ' ' << val.first << '\n';
+		std::cout << "upper_bound(20): " << mymap.upper_bound(20, val) << ' ' << val.first << '\n';
+		std::cout << "upper_bound(40): " << mymap.upper_bound(40, val) << '\n';
+	}
+
+	static const int	KEYS = 64;
+	static const int	READERS = 3;
+	static const int	UPDATES = 20000;
+
+	typedef ft::RcuMap<int, int, ft::less<int>, ft::StatsAllocator<ft::Pair<int, int> > >	counted_map;
+
+	struct Reader
+	{
+		counted_map		*map;
+		int				*stop;
+		long			bad;
+	};
+
+	struct SumCheck
+	{
+		long	sum;
+		int		last;
+		bool	sorted;
+
+		SumCheck() : sum(0), last(-1), sorted(true) {}
+
+		void	operator() (const ft::Pair<int, int> &val)
+		{
+			if (val.first <= last)
+				sorted = false;
+			last = val.first;
+			sum += val.second;
+		}
+	};
+
+	// from의 값을 1 줄이고 to의 값을 1 늘린다
+	struct Move
+	{
+		int		from;
+		int		to;
+
+		Move(int f, int t) : from(f), to(t) {}
+
+		void	operator() (counted_map::snapshot_type &m) const
+		{
+			m.assign(from, m.at(from) - 1);
+			m.assign(to, m.at(to) + 1);
+		}
+	};
+
+	// 쓰는 쪽은 값의 합을 항상 KEYS * 100으로 유지하므로 어느 버전을 봐도 합이 같아야 한다
+	void	*read_loop(void *arg)
+	{
+		Reader		*r = static_cast<Reader *>(arg);
+		SumCheck	check;
+
+		while (!__atomic_load_n(r->stop, __ATOMIC_ACQUIRE))
+		{
+			check = r->map->for_each(SumCheck());
+			if (check.sum != KEYS * 100 || !check.sorted)
+				++r->bad;
+		}
+		return (0);
+	}
+
+	void	thread_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "THREAD" << std::endl;
+		typedef ft::StatsAllocator<ft::Pair<int, int> >		alloc_type;
+		ft::AllocStats		stats;
+		ft::EpochDomain		domain;
+		pthread_t			threads[READERS];
+		Reader				readers[READERS];
+		int					stop;
+		long				bad;
+
+		{
+			counted_map		mymap(domain, ft::less<int>(), (alloc_type(stats)));
+
+			for (int i = 0; i < KEYS; ++i)
+				mymap.insert(ft::Pair<int, int>(i, 100));
+			stop = 0;
+			for (int i = 0; i < READERS; ++i)
+			{
+				readers[i].map = &mymap;
+				readers[i].stop = &stop;
+				readers[i].bad = 0;
+				pthread_create(&threads[i], 0, read_loop, &readers[i]);
+			}
+			// 한 키에서 빼서 다른 키에 더하는 것을 한 번에 공개한다
+			for (int i = 0; i < UPDATES; ++i)
+				mymap.update(Move(i % KEYS, (i * 7 + 3) % KEYS));
+			__atomic_store_n(&stop, 1, __ATOMIC_RELEASE);
+			bad = 0;
+			for (int i = 0; i < READERS; ++i)
+			{
+				pthread_join(threads[i], 0);
+				bad += readers[i].bad;
+			}
+			std::cout << "inconsistent reads: " << bad << '\n';
+			std::cout << "size: " << mymap.size() << '\n';
+		}
+		std::cout << "live bytes after destroy: " << stats.bytes_live << '\n';
+	}
+
+	int		main(void)
+	{
+		epoch_test();
+		basic_test();
+		bound_test();
+		thread_test();
+
+		return (0);
+	}
+}
@@ -0,0 +1,21 @@
+#ifndef RCU_MAP_TESTER_HPP
+# define RCU_MAP_TESTER_HPP
+
+# include "RcuMap.hpp"
+# include "Epoch.hpp"
+# include "StatsAllocator.hpp"
+# include <iostream>
+# include <iomanip>
+# include <string>
+# include <pthread.h>
+
+namespace rcumap_tester
+{
+	void	epoch_test();
+	void	basic_test();
+	void	bound_test();
+	void	thread_test();
+	int		main();
+}
+
+#endif
@@ -0,0 +1,261 @@
+#include "SerializeTester.hpp"
+
+namespace serialize_tester
+{
+	typedef ft::Map<int, std::string>	smap;
+
+	template <class Map>
+	bool	same_map(Map &a, Map &b)
+	{
+		typename Map::iterator	i = a.begin();
+		typename Map::iterator	j = b.begin();
+
+		if (a.size() != b.size())
+			return (false);
+		for (; i != a.end(); ++i, ++j)
+		{
+			if (i->first != j->first || i->second != j->second)
+				return (false);
+		}
+		return (true);
+	}
+
+	void	vector_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "VECTOR" << std::endl;
+		ft::Vector<int> ints;
+		ft::Vector<int> ints_back(3, 7);
+		ft::Vector<std::string> words;
+		ft::Vector<std::string> words_back;
+		ft::Vector<double> empty;
+		ft::Vector<double> empty_back(2, 1.5);
+		std::stringstream ss;
+
+		for (int i = 0; i < 10; ++i)
+			ints.push_back(i * i - 20);
+		words.push_back("alpha");
+		words.push_back("");
+		words.push_back("gamma delta");
+		ft::serialize(ints, ss);
+		ft::serialize(words, ss);
+		ft::serialize(empty, ss);
+		std::cout << "bytes: " << ss.str().size() << '\n';
+		ft::deserialize(ints_back, ss);
+		ft::deserialize(words_back, ss);
+		ft::deserialize(empty_back, ss);
+		std::cout << "ints (" << ints_back.size() << "):";
+		for (size_t i = 0; i < ints_back.size(); ++i)
+			std::cout << ' ' << ints_back[i];
+		std::cout << "\nwords (" << words_back.size() << "):";
+		for (size_t i = 0; i < words_back.size(); ++i)
+			std::cout << " [" << words_back[i] << ']';
+		std::cout << "\nempty: " << empty_back.size() << '\n';
+	}
+
+	void	bool_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "BOOL" << std::endl;
+		ft::Vector<bool> bits;
+		ft::Vector<bool> bits_back(5, true);
+		ft::Vector<bool> empty;
+		ft::Vector<bool> empty_back(3, true);
+		ft::Vector<int> wrong;
+		std::stringstream ss;
+		std::string data;
+		size_t ones;
+
+		for (int i = 0; i < 130; ++i)
+			bits.push_back(i % 3 == 0 || i == 129);
+		ft::serialize(bits, ss);
+		ft::serialize(empty, ss);
+		data = ss.str();
+		std::cout << "bytes: " << data.size() << '\n';
+		ft::deserialize(bits_back, ss);
+		ft::deserialize(empty_back, ss);
+		ones = 0;
+		for (size_t i = 0; i < bits_back.size(); ++i)
+			ones += bits_back[i];
+		std::cout << "bits (" << bits_back.size() << "): " << ones << " set, same: " << (bits == bits_back)
+			<< ", last: " << bits_back.back() << '\n';
+		std::cout << "empty: " << empty_back.size() << '\n';
+		ss.str(data);
+		ss.clear();
+		try
+		{
+			ft::deserialize(wrong, ss);
+			std::cout << "as Vector<int>: no error\n";
+		}
+		catch (const ft::serialize_error &e)
+		{
+			std::cout << "as Vector<int>: " << e.what() << '\n';
+		}
+	}
+
+	void	list_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "LIST" << std::endl;
+		ft::List<double> mylist;
+		ft::List<double> back;
+		std::stringstream ss;
+
+		for (int i = 0; i < 6; ++i)
+			mylist.push_back(i / 4.0);
+		back.push_back(99);
+		ft::serialize(mylist, ss);
+		ft::deserialize(back, ss);
+		std::cout << "list (" << back.size() << "):";
+		for (ft::List<double>::iterator it = back.begin(); it != back.end(); ++it)
+			std::cout << ' ' << *it;
+		std::cout << '\n';
+	}
+
+	void	map_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "MAP" << std::endl;
+		smap mymap;
+		smap back;
+		ft::Map<int, int, ft::greater<int> > desc;
+		ft::Map<int, int, ft::greater<int> > desc_back;
+		std::stringstream ss;
+
+		for (int i = 0; i < 8; ++i)
+			mymap[(i * 5) % 8] = std::string(i + 1, 'a' + i);
+		back[100] = "old";
+		for (int i = 0; i < 5; ++i)
+			desc[i] = i * 10;
+		ft::serialize(mymap, ss);
+		ft::serialize(desc, ss);
+		ft::deserialize(back, ss);
+		ft::deserialize(desc_back, ss);
+		std::cout << "map (" << back.size() << "):";
+		for (smap::iterator it = back.begin(); it != back.end(); ++it)
+			std::cout << ' ' << it->first << '=' << it->second;
+		std::cout << "\ndescending:";
+		for (ft::Map<int, int, ft::greater<int> >::iterator it = desc_back.begin(); it != desc_back.end(); ++it)
+			std::cout << ' ' << it->first << '=' << it->second;
+		back[3] = "changed";
+		back.erase(0);
+		back[42] = "new";
+		std::cout << "\nafter edits: " << back.size() << ' ' << back[3] << ' ' << back[42] << '\n';
+	}
+
+	void	fd_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "FD" << std::endl;
+		FILE *file = std::tmpfile();
+		int fd = fileno(file);
+		ft::Vector<unsigned long> v;
+		ft::Vector<unsigned long> v_back;
+		smap m;
+		smap m_back;
+
+		for (unsigned long i = 0; i < 1000; ++i)
+			v.push_back(i * 2654435761UL);
+		for (int i = 0; i < 1000; ++i)
+			m[i * 3] = std::string(i % 7, 'x');
+		ft::serialize(v, fd);
+		ft::serialize(m, fd);
+		lseek(fd, 0, SEEK_SET);
+		ft::deserialize(v_back, fd);
+		ft::deserialize(m_back, fd);
+		std::cout << "vector same: " << (v == v_back) << ", map same: " << same_map(m, m_back) << '\n';
+		std::fclose(file);
+	}
+
+	// 여러 덩어리에 걸치는 크기
+	void	large_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "LARGE" << std::endl;
+		ft::Vector<std::string> words;
+		ft::Vector<std::string> words_back;
+		ft::Map<int, int> m;
+		ft::Map<int, int> m_back;
+		std::stringstream ss;
+		size_t chunks;
+
+		for (int i = 0; i < 50000; ++i)
+			words.push_back(std::string(i % 100, static_cast<char>('a' + i % 26)));
+		for (int i = 0; i < 200000; ++i)
+			m[i * 7] = -i;
+		ft::serialize(words, ss);
+		chunks = ss.str().size();
+		ft::serialize(m, ss);
+		ft::deserialize(words_back, ss);
+		ft::deserialize(m_back, ss);
+		std::cout << "words bytes over 1 MiB: " << (chunks > (1 << 20)) << ", same: " << (words == words_back) << '\n';
+		std::cout << "map size: " << m_back.size() << ", same: " << same_map(m, m_back) << '\n';
+		std::cout << "lookup 700: " << m_back[700] << ", lower_bound 701: " << m_back.lower_bound(701)->first << '\n';
+	}
+
+	template <class Container>
+	void	expect_error(const char *name, const std::string &data, Container &out)
+	{
+		std::stringstream ss(data);
+
+		try
+		{
+			ft::deserialize(out, ss);
+			std::cout << name << ": no error\n";
+		}
+		catch (const ft::serialize_error &e)
+		{
+			std::cout << name << ": " << e.what() << '\n';
+		}
+	}
+
+	void	error_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "ERROR" << std::endl;
+		ft::Vector<int> v(5, 1);
+		ft::Vector<int> v_back;
+		ft::Vector<long> wrong;
+		ft::List<int> wrong_container;
+		smap m;
+		smap m_back;
+		std::stringstream ss;
+		std::string data;
+		std::string corrupt;
+
+		ft::serialize(v, ss);
+		data = ss.str();
+		corrupt = data;
+		corrupt[corrupt.size() - 20] ^= 1;
+		expect_error("corrupt", corrupt, v_back);
+		expect_error("truncated", data.substr(0, data.size() - 3), v_back);
+		expect_error("element type", data, wrong);
+		expect_error("container", data, wrong_container);
+		expect_error("magic", "XXXX" + data.substr(4), v_back);
+		// 헤더의 원소 수를 2^40으로. 그만큼 할당하지 않고 덩어리에서 걸려야 한다
+		corrupt = data;
+		corrupt[16 + 5] = 1;
+		v_back.assign(3, 7);
+		expect_error("huge count", corrupt, v_back);
+		std::cout << "vector after error: " << v_back.size() << ' ' << v_back[0] << '\n';
+		for (int i = 0; i < 10; ++i)
+			m[i] = "v";
+		ss.str("");
+		ft::serialize(m, ss);
+		data = ss.str();
+		corrupt = data;
+		corrupt[corrupt.size() - 30] ^= 4;
+		expect_error("corrupt map", corrupt, m_back);
+		std::cout << "map after error: " << m_back.size() << '\n';
+		expect_error("good map", data, m_back);
+		std::cout << "map after success: " << m_back.size() << '\n';
+		expect_error("corrupt map again", corrupt, m_back);
+		std::cout << "map kept: " << m_back.size() << ' ' << m_back[9] << '\n';
+	}
+
+	int		main()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "SERIALIZE" << std::endl;
+		vector_test();
+		bool_test();
+		list_test();
+		map_test();
+		fd_test();
+		large_test();
+		error_test();
+		return (0);
+	}
+}
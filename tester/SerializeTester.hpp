@@ -0,0 +1,23 @@
+#ifndef SERIALIZE_TESTER_HPP
+# define SERIALIZE_TESTER_HPP
+
+# include "Serialize.hpp"
+# include <iostream>
+# include <iomanip>
+# include <sstream>
+# include <string>
+# include <cstdio>
+
+namespace serialize_tester
+{
+	void	vector_test();
+	void	bool_test();
+	void	list_test();
+	void	map_test();
+	void	fd_test();
+	void	large_test();
+	void	error_test();
+	int		main();
+}
+
+#endif
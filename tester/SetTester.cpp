@@ -0,0 +1,107 @@
+#include "SetTester.hpp"
+
+namespace set_tester
+{
+	void	construct_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "CONSTRUCT" << std::endl;
+		int myints[]= {10,20,30,40,50};
+		ft::Set<int> first;
+		ft::Set<int> second (myints,myints+5);
+		ft::Set<int> third (second);
+		ft::Set<int> fourth (second.begin(), second.end());
+
+		std::cout << "size: " << first.size() << ' ' << second.size() << ' ' << third.size() << ' ' << fourth.size() << '\n';
+	}
+
+	void	insert_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "INSERT" << std::endl;
+		ft::Set<int> myset;
+		ft::Set<int>::iterator it;
+		ft::Pair<ft::Set<int>::iterator,bool> ret;
+
+		for (int i=1; i<=5; ++i) myset.insert(i*10);
+		ret = myset.insert(20);
+		if (ret.second==false) it=ret.first;
+		myset.insert (it,25);
+		myset.insert (it,24);
+		myset.insert (it,26);
+		int myints[]= {5,10,15};
+		myset.insert (myints,myints+3);
+		std::cout << "myset contains:";
+		for (it=myset.begin(); it!=myset.end(); ++it)
+			std::cout << ' ' << *it;
+		std::cout << '\n';
+	}
+
+	void	erase_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "ERASE" << std::endl;
+		ft::Set<int> myset;
+		ft::Set<int>::iterator it;
+
+		for (int i=1; i<10; i++) myset.insert(i*10);
+		it = myset.begin();
+		++it;
+		myset.erase (it);
+		std::cout << "erase 40: " << myset.erase (40) << '\n';
+		std::cout << "erase 45: " << myset.erase (45) << '\n';
+		it = myset.find (60);
+		myset.erase (it, myset.end());
+		std::cout << "myset contains:";
+		for (it=myset.begin(); it!=myset.end(); ++it)
+			std::cout << ' ' << *it;
+		std::cout << "\nsize: " << myset.size() << '\n';
+	}
+
+	void	bound_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "BOUND" << std::endl;
+		ft::Set<int> myset;
+		ft::Set<int>::iterator itlow,itup;
+
+		for (int i=1; i<10; i++) myset.insert(i*10);
+		itlow=myset.lower_bound (30);
+		itup=myset.upper_bound (60);
+		myset.erase(itlow,itup);
+		std::cout << "myset contains:";
+		for (ft::Set<int>::iterator it=myset.begin(); it!=myset.end(); ++it)
+			std::cout << ' ' << *it;
+		std::cout << '\n';
+		std::cout << "lower_bound(15): " << *myset.lower_bound(15) << '\n';
+		std::cout << "upper_bound(20): " << *myset.upper_bound(20) << '\n';
+		std::cout << "upper_bound(90) == end: " << (myset.upper_bound(90) == myset.end()) << '\n';
+		std::cout << "count(20): " << myset.count(20) << ", count(30): " << myset.count(30) << '\n';
+	}
+
+	void	swap_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "SWAP" << std::endl;
+		int myints[]={12,75,10,32,20,25};
+		ft::Set<int> first (myints,myints+3);
+		ft::Set<int> second (myints+3,myints+6);
+
+		first.swap(second);
+		std::cout << "first contains:";
+		for (ft::Set<int>::iterator it=first.begin(); it!=first.end(); ++it)
+			std::cout << ' ' << *it;
+		std::cout << "\nsecond contains:";
+		for (ft::Set<int>::iterator it=second.begin(); it!=second.end(); ++it)
+			std::cout << ' ' << *it;
+		std::cout << '\n';
+		second.clear();
+		std::cout << "second empty: " << second.empty() << '\n';
+	}
+
+	int		main(void)
+	{
+		construct_test();
+		insert_test();
+		erase_test();
+		bound_test();
+		swap_test();
+
+		return (0);
+	}
+}
@@ -0,0 +1,18 @@
+#ifndef SET_TESTER_HPP
+# define SET_TESTER_HPP
+
+# include "Set.hpp"
+# include <iostream>
+# include <iomanip>
+
+namespace set_tester
+{
+	void	construct_test();
+	void	insert_test();
+	void	erase_test();
+	void	bound_test();
+	void	swap_test();
+	int		main();
+}
+
+#endif
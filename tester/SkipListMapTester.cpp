@@ -0,0 +1,216 @@
+#include "SkipListMapTester.hpp"
+
+namespace skiplistmap_tester
+{
+	typedef ft::SkipListMap<int, std::string>	skip_map;
+
+	template <class M>
+	void	print(const char *name, const M &m)
+	{
+		std::cout << name << " (" << m.size() << "):";
+		for (typename M::iterator it = m.begin(); it != m.end(); ++it)
+			std::cout << ' ' << it->first << '=' << it->second;
+		std::cout << '\n';
+	}
+
+	void	basic_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "BASIC" << std::endl;
+		typedef ft::SkipListMap<int, std::string, ft::less<int>, ft::StatsAllocator<ft::Pair<int, std::string> > >	counted_map;
+		ft::AllocStats		stats;
+		ft::EpochDomain		domain;
+
+		{
+			counted_map					mymap(domain, ft::less<int>(), (ft::StatsAllocator<ft::Pair<int, std::string> >(stats)));
+			counted_map::iterator		it;
+			ft::Pair<counted_map::iterator, bool>	ret;
+
+			std::cout << "empty: " << mymap.empty() << '\n';
+			for (int i = 0; i < 10; ++i)
+				mymap.insert(counted_map::value_type((i * 7) % 10, std::string(1, 'a' + i)));
+			print("mymap", mymap);
+			ret = mymap.insert(counted_map::value_type(3, "x"));
+			std::cout << "insert 3 again: " << ret.second << ' ' << ret.first->second << '\n';
+			ret = mymap.insert(counted_map::value_type(10, "k"));
+			std::cout << "insert 10: " << ret.second << ' ' << ret.first->first << '\n';
+			it = mymap.find(4);
+			std::cout << "find 4: " << it->second << ", find 11: " << (mymap.find(11) == mymap.end()) << '\n';
+			std::cout << "erase 4: " << mymap.erase(4) << ", erase 4: " << mymap.erase(4) << '\n';
+			// 지운 노드를 가리키던 이터레이터도 계속 전진할 수 있다
+			++it;
+			std::cout << "after erased: " << it->first << '\n';
+			std::cout << "count 4: " << mymap.count(4) << ", count 5: " << mymap.count(5) << '\n';
+			print("erased", mymap);
+			mymap.insert(counted_map::value_type(4, "again"));
+			print("reinserted", mymap);
+			it = mymap.end();
+			mymap.clear();
+			std::cout << "cleared: " << mymap.empty() << ' ' << (mymap.begin() == mymap.end()) << '\n';
+		}
+		std::cout << "live bytes after destroy: " << stats.bytes_live << '\n';
+	}
+
+	void	bound_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "BOUND" << std::endl;
+		skip_map			mymap;
+		skip_map::value_type	items[5];
+
+		for (int i = 0; i < 5; ++i)
+			items[i] = skip_map::value_type(i * 10, std::string(1, 'a' + i));
+		mymap.insert(items, items + 5);
+		std::cout << "lower_bound(15): " << mymap.lower_bound(15)->first << '\n';
+		std::cout << "lower_bound(20): " << mymap.lower_bound(20)->first << '\n';
+		std::cout << "upper_bound(20): " << mymap.upper_bound(20)->first << '\n';
+		std::cout << "upper_bound(40): " << (mymap.upper_bound(40) == mymap.end()) << '\n';
+		std::cout << "lower_bound(-5): " << mymap.lower_bound(-5)->first << '\n';
+
+		ft::Pair<skip_map::iterator, skip_map::iterator>	range = mymap.equal_range(30);
+
+		std::cout << "equal_range(30): " << range.first->first << ' ' << range.second->first << '\n';
+		std::cout << "[10, 35):";
+		for (skip_map::iterator it = mymap.lower_bound(10); it != mymap.lower_bound(35); ++it)
+			std::cout << ' ' << it->first;
+		std::cout << '\n';
+	}
+
+	static const int	WRITERS = 4;
+	static const int	READERS = 2;
+	static const int	PER_WRITER = 4000;
+
+	typedef ft::SkipListMap<int, int>	int_map;
+
+	struct Shared
+	{
+		int_map		*map;
+		int			*stop;
+	};
+
+	struct Writer
+	{
+		Shared		shared;
+		int			id;
+	};
+
+	struct Reader
+	{
+		Shared		shared;
+		long		bad;
+		long		scans;
+	};
+
+	// 자기 몫의 키(id로 나눈 나머지가 같은 키)를 모두 넣고, 홀수 키를 지운 뒤 3의 배수를 다시 넣는다
+	void	*write_loop(void *arg)
+	{
+		Writer	*w = static_cast<Writer *>(arg);
+		int_map	*m = w->shared.map;
+
+		for (int i = 0; i < PER_WRITER; ++i)
+		{
+			int	k = i * WRITERS + w->id;
+
+			m->insert(ft::Pair<int, int>(k, k * 2));
+		}
+		for (int i = 0; i < PER_WRITER; ++i)
+		{
+			int	k = i * WRITERS + w->id;
+
+			if (k % 2)
+				m->erase(k);
+		}
+		for (int i = 0; i < PER_WRITER; ++i)
+		{
+			int	k = i * WRITERS + w->id;
+
+			if (k % 3 == 0)
+				m->insert(ft::Pair<int, int>(k, k * 2));
+		}
+		return (0);
+	}
+
+	// 순회는 키가 늘어나는 순서여야 하고 값은 넣은 그대로여야 한다. 3으로 나눈 나머지가 0인 짝수 키는
+	// 한 번 들어간 뒤로 지워지지 않으므로 find로 찾으면 있어야 한다
+	void	*read_loop(void *arg)
+	{
+		Reader	*r = static_cast<Reader *>(arg);
+		int_map	*m = r->shared.map;
+
+		while (!__atomic_load_n(r->shared.stop, __ATOMIC_ACQUIRE))
+		{
+			int		last = -1;
+
+			for (int_map::iterator it = m->begin(); it != m->end(); ++it)
+			{
+				if (it->first <= last || it->second != it->first * 2)
+					++r->bad;
+				last = it->first;
+				if (it->first % 6 == 0 && m->find(it->first) == m->end())
+					++r->bad;
+			}
+			++r->scans;
+		}
+		return (0);
+	}
+
+	void	thread_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "THREAD" << std::endl;
+		ft::EpochDomain		domain;
+		pthread_t			writers[WRITERS];
+		pthread_t			readers[READERS];
+		Writer				w[WRITERS];
+		Reader				r[READERS];
+		int					stop = 0;
+		long				bad = 0;
+		size_t				expected = 0;
+		size_t				seen = 0;
+
+		{
+			int_map		mymap(domain);
+			Shared		shared;
+
+			shared.map = &mymap;
+			shared.stop = &stop;
+			for (int i = 0; i < READERS; ++i)
+			{
+				r[i].shared = shared;
+				r[i].bad = 0;
+				r[i].scans = 0;
+				pthread_create(&readers[i], 0, read_loop, &r[i]);
+			}
+			for (int i = 0; i < WRITERS; ++i)
+			{
+				w[i].shared = shared;
+				w[i].id = i;
+				pthread_create(&writers[i], 0, write_loop, &w[i]);
+			}
+			for (int i = 0; i < WRITERS; ++i)
+				pthread_join(writers[i], 0);
+			__atomic_store_n(&stop, 1, __ATOMIC_RELEASE);
+			for (int i = 0; i < READERS; ++i)
+			{
+				pthread_join(readers[i], 0);
+				bad += r[i].bad;
+			}
+			// 남는 키: 짝수 키와 3의 배수인 홀수 키
+			for (int k = 0; k < PER_WRITER * WRITERS; ++k)
+				if (k % 2 == 0 || k % 3 == 0)
+					++expected;
+			for (int_map::iterator it = mymap.begin(); it != mymap.end(); ++it)
+				if (it->first % 2 == 0 || it->first % 3 == 0)
+					++seen;
+			std::cout << "inconsistent reads: " << bad << '\n';
+			std::cout << "size: " << (mymap.size() == expected) << ", iterated: " << (seen == expected) << '\n';
+			std::cout << "find 9: " << mymap.count(9) << ", find 7: " << mymap.count(7) << '\n';
+		}
+	}
+
+	int		main(void)
+	{
+		basic_test();
+		bound_test();
+		thread_test();
+
+		return (0);
+	}
+}
@@ -0,0 +1,20 @@
+#ifndef SKIP_LIST_MAP_TESTER_HPP
+# define SKIP_LIST_MAP_TESTER_HPP
+
+# include "SkipListMap.hpp"
+# include "Epoch.hpp"
+# include "StatsAllocator.hpp"
+# include <iostream>
+# include <iomanip>
+# include <string>
+# include <pthread.h>
+
+namespace skiplistmap_tester
+{
+	void	basic_test();
+	void	bound_test();
+	void	thread_test();
+	int		main();
+}
+
+#endif
@@ -0,0 +1,126 @@
+#include "SpscQueueTester.hpp"
+
+namespace spscqueue_tester
+{
+	void	basic_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "BASIC" << std::endl;
+		ft::SpscQueue<std::string> myqueue(5);
+
+		std::cout << "capacity: " << myqueue.capacity() << '\n';
+		myqueue.push("one");
+		myqueue.push("two");
+		myqueue.push("three");
+		std::cout << "size: " << myqueue.size() << '\n';
+		std::cout << "myqueue contains:";
+		while (!myqueue.empty())
+		{
+			std::cout << ' ' << myqueue.front();
+			myqueue.pop();
+		}
+		std::cout << "\nempty: " << myqueue.empty() << '\n';
+		myqueue.push("four");
+		std::string	val;
+		std::cout << "try_pop after pop: " << myqueue.try_pop(val) << ' ' << val << '\n';
+	}
+
+	void	try_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "TRY" << std::endl;
+		ft::SpscQueue<int> myqueue(4);
+		int		val;
+
+		for (int i = 0; i < 6; ++i)
+			std::cout << "try_push " << i << ": " << myqueue.try_push(i) << '\n';
+		myqueue.try_pop(val);
+		std::cout << "try_pop: " << val << ", try_push 6: " << myqueue.try_push(6) << '\n';
+		std::cout << "myqueue contains:";
+		while (myqueue.try_pop(val))
+			std::cout << ' ' << val;
+		std::cout << "\ntry_pop on empty: " << myqueue.try_pop(val) << '\n';
+	}
+
+	void	batch_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "BATCH" << std::endl;
+		ft::SpscQueue<int> myqueue(8);
+		int		in[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+		int		out[10];
+		size_t	n;
+
+		std::cout << "push_n 10: " << myqueue.push_n(in, 10) << '\n';
+		n = myqueue.pop_n(out, 3);
+		std::cout << "pop_n 3:";
+		for (size_t i = 0; i < n; ++i)
+			std::cout << ' ' << out[i];
+		// 링의 끝을 넘어가며 쓰인다
+		std::cout << "\npush_n 10 again: " << myqueue.push_n(in, 10) << '\n';
+		n = myqueue.pop_n(out, 10);
+		std::cout << "pop_n 10 (" << n << "):";
+		for (size_t i = 0; i < n; ++i)
+			std::cout << ' ' << out[i];
+		std::cout << '\n';
+	}
+
+	static const long	THREAD_COUNT = 1000000;
+
+	void	*producer(void *arg)
+	{
+		ft::SpscQueue<long>	*q = static_cast<ft::SpscQueue<long> *>(arg);
+		long				batch[16];
+		long				i;
+		size_t				sent;
+
+		for (i = 1; i <= THREAD_COUNT / 2; ++i)
+			q->push(i);
+		while (i <= THREAD_COUNT)
+		{
+			for (int j = 0; j < 16; ++j)
+				batch[j] = i + j;
+			sent = 0;
+			while (sent < 16)
+				sent += q->push_n(batch + sent, 16 - sent);
+			i += 16;
+		}
+		return (0);
+	}
+
+	void	thread_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "THREAD" << std::endl;
+		ft::SpscQueue<long>	myqueue(1024);
+		pthread_t			thread;
+		long				expect;
+		long				sum;
+		long				val;
+		bool				ordered;
+
+		pthread_create(&thread, 0, producer, &myqueue);
+		expect = 1;
+		sum = 0;
+		ordered = true;
+		while (expect <= THREAD_COUNT)
+		{
+			if (!myqueue.try_pop(val))
+				continue ;
+			if (val != expect)
+				ordered = false;
+			sum += val;
+			++expect;
+		}
+		pthread_join(thread, 0);
+		std::cout << "received in order: " << ordered << '\n';
+		std::cout << "sum: " << sum << '\n';
+		std::cout << "empty: " << myqueue.empty() << '\n';
+	}
+
+	int		main(void)
+	{
+		basic_test();
+		try_test();
+		batch_test();
+		thread_test();
+
+		return (0);
+	}
+}
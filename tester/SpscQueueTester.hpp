@@ -0,0 +1,19 @@
+#ifndef SPSC_QUEUE_TESTER_HPP
+# define SPSC_QUEUE_TESTER_HPP
+
+# include "SpscQueue.hpp"
+# include <iostream>
+# include <iomanip>
+# include <string>
+# include <pthread.h>
+
+namespace spscqueue_tester
+{
+	void	basic_test();
+	void	try_test();
+	void	batch_test();
+	void	thread_test();
+	int		main();
+}
+
+#endif
@@ -0,0 +1,274 @@
+#include "StaticVectorTester.hpp"
+
+namespace staticvector_tester
+{
+	typedef ft::StaticVector<int, 8>	ivector;
+
+	// 살아 있는 객체 수를 세서 생성과 소멸이 짝이 맞는지 본다
+	struct Tracked
+	{
+		static int	live;
+		std::string	name;
+
+		Tracked(const std::string &n = "") : name(n) { ++live; }
+		Tracked(const Tracked &x) : name(x.name) { ++live; }
+		~Tracked() { --live; }
+	};
+
+	int		Tracked::live = 0;
+
+	template <class Vec>
+	void	print(const char *name, Vec &v)
+	{
+		std::cout << name << " (" << v.size() << "/" << v.capacity() << "):";
+		for (typename Vec::iterator it = v.begin(); it != v.end(); ++it)
+			std::cout << ' ' << *it;
+		std::cout << '\n';
+	}
+
+	void	basic_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "BASIC" << std::endl;
+		ivector		myvector;
+
+		std::cout << "empty: " << myvector.empty() << ", capacity: " << myvector.capacity()
+			<< ", max_size: " << myvector.max_size() << ", static_capacity: " << ivector::static_capacity << '\n';
+		for (int i = 1; i <= 5; ++i)
+			myvector.push_back(i * 10);
+		print("myvector", myvector);
+		std::cout << "front: " << myvector.front() << ", back: " << myvector.back() << ", [2]: " << myvector[2]
+			<< ", data[3]: " << myvector.data()[3] << '\n';
+		std::cout << "reverse:";
+		for (ivector::reverse_iterator it = myvector.rbegin(); it != myvector.rend(); ++it)
+			std::cout << ' ' << *it;
+		std::cout << '\n';
+		try
+		{
+			myvector.at(5);
+		}
+		catch (const std::out_of_range &e)
+		{
+			std::cout << "at(5): out_of_range\n";
+		}
+		myvector.pop_back();
+		myvector.resize(7, 1);
+		print("resize(7, 1)", myvector);
+		myvector.resize(2);
+		print("resize(2)", myvector);
+
+		ivector		fill(3, 7);
+		int			arr[] = { 5, 4, 3, 2 };
+		ivector		range(arr, arr + 4);
+
+		print("fill", fill);
+		print("range", range);
+		std::cout << "sizeof StaticVector<char, 16>: " << sizeof(ft::StaticVector<char, 16>)
+			<< ", sizeof StaticVector<int, 1000>: " << sizeof(ft::StaticVector<int, 1000>) << '\n';
+	}
+
+	void	modifier_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "MODIFIER" << std::endl;
+		ivector		myvector;
+		int			arr[] = { 501, 502, 503 };
+
+		for (int i = 1; i <= 3; ++i)
+			myvector.push_back(i);
+		myvector.insert(myvector.begin() + 1, 100);
+		print("insert", myvector);
+		myvector.insert(myvector.begin(), 2, 200);
+		print("insert n", myvector);
+		// 벡터 안의 원소를 넣어도 밀리기 전에 복사해 둔다
+		myvector.insert(myvector.begin(), myvector.back());
+		print("insert back()", myvector);
+		myvector.erase(myvector.begin() + 1, myvector.begin() + 4);
+		print("erase range", myvector);
+		myvector.insert(myvector.begin() + 2, arr, arr + 3);
+		print("insert range", myvector);
+		std::cout << "erase returns: " << *myvector.erase(myvector.begin()) << '\n';
+		print("erase", myvector);
+		myvector.insert(myvector.end(), 2, 9);
+		print("insert at end", myvector);
+		myvector.assign(4, 42);
+		print("assign n", myvector);
+		myvector.assign(arr, arr + 2);
+		print("assign range", myvector);
+
+		ivector		other(5, 1);
+
+		myvector.swap(other);
+		print("swap myvector", myvector);
+		print("swap other", other);
+
+		ivector		copy(myvector);
+
+		std::cout << "copy == myvector: " << (copy == myvector) << '\n';
+		copy.back() = 2;
+		std::cout << "copy > myvector: " << (copy > myvector) << ", copy != myvector: " << (copy != myvector)
+			<< ", other < myvector: " << (other < myvector) << ", other <= other: " << (other <= other) << '\n';
+		copy = other;
+		print("copy = other", copy);
+		myvector.clear();
+		print("clear", myvector);
+	}
+
+	void	capacity_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "CAPACITY" << std::endl;
+		ft::StaticVector<int, 4>	small;
+		int							arr[] = { 1, 2, 3, 4, 5 };
+
+		for (int i = 0; i < 4; ++i)
+			small.push_back(i);
+		std::cout << "full: " << small.full() << '\n';
+		try
+		{
+			small.push_back(4);
+		}
+		catch (const std::length_error &e)
+		{
+			std::cout << "push_back: " << e.what() << '\n';
+		}
+		try
+		{
+			small.insert(small.begin(), 9);
+		}
+		catch (const std::length_error &e)
+		{
+			std::cout << "insert: length_error\n";
+		}
+		print("unchanged", small);
+		small.pop_back();
+		try
+		{
+			small.insert(small.begin(), 2, 9);
+		}
+		catch (const std::length_error &e)
+		{
+			std::cout << "insert 2: length_error\n";
+		}
+		try
+		{
+			small.resize(5);
+		}
+		catch (const std::length_error &e)
+		{
+			std::cout << "resize(5): length_error\n";
+		}
+		try
+		{
+			small.reserve(4);
+			std::cout << "reserve(4): ok\n";
+			small.reserve(5);
+		}
+		catch (const std::length_error &e)
+		{
+			std::cout << "reserve(5): length_error\n";
+		}
+		try
+		{
+			ft::StaticVector<int, 4>	big(arr, arr + 5);
+		}
+		catch (const std::length_error &e)
+		{
+			std::cout << "range constructor: length_error\n";
+		}
+		try
+		{
+			small.insert(small.begin() + 1, arr, arr + 2);
+		}
+		catch (const std::length_error &e)
+		{
+			std::cout << "range insert 2: length_error\n";
+		}
+		print("unchanged", small);
+		try
+		{
+			small.assign(arr, arr + 5);
+		}
+		catch (const std::length_error &e)
+		{
+			std::cout << "range assign 5: length_error\n";
+		}
+		print("unchanged", small);
+		small.insert(small.begin(), small.begin() + 1, small.begin() + 2);
+		print("small", small);
+	}
+
+	void	object_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "OBJECT" << std::endl;
+		{
+			ft::StaticVector<Tracked, 6>	a;
+			ft::StaticVector<Tracked, 6>	b;
+
+			a.push_back(Tracked("a1"));
+			a.push_back(Tracked("a2"));
+			a.push_back(Tracked("a3"));
+			b.push_back(Tracked("b1"));
+			std::cout << "live: " << Tracked::live << '\n';
+			a.insert(a.begin() + 1, 2, Tracked("x"));
+			a.erase(a.begin());
+			std::cout << "after insert/erase live: " << Tracked::live << ", a:";
+			for (size_t i = 0; i < a.size(); ++i)
+				std::cout << ' ' << a[i].name;
+			std::cout << '\n';
+			a.swap(b);
+			std::cout << "after swap a: " << a.size() << ", b: " << b.size() << ", live: " << Tracked::live << '\n';
+			b = a;
+			std::cout << "after assign b: " << b[0].name << ", live: " << Tracked::live << '\n';
+			a.resize(5, Tracked("r"));
+			a.resize(1);
+			std::cout << "after resize live: " << Tracked::live << '\n';
+		}
+		std::cout << "after scope live: " << Tracked::live << '\n';
+	}
+
+	void	adapter_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "ADAPTER" << std::endl;
+		ft::Stack<int, ft::StaticVector<int, 16> >	mystack;
+		ft::Queue<int, ft::StaticVector<int, 16> >	myqueue;
+		int											sum = 0;
+
+		for (int i = 1; i <= 10; ++i)
+		{
+			mystack.push(i);
+			myqueue.push(i * i);
+		}
+		std::cout << "stack size: " << mystack.size() << ", top: " << mystack.top() << '\n';
+		std::cout << "stack:";
+		while (!mystack.empty())
+		{
+			std::cout << ' ' << mystack.top();
+			mystack.pop();
+		}
+		std::cout << '\n';
+		std::cout << "queue front: " << myqueue.front() << ", back: " << myqueue.back() << '\n';
+		while (!myqueue.empty())
+		{
+			sum += myqueue.front();
+			myqueue.pop();
+		}
+		std::cout << "queue sum: " << sum << '\n';
+
+		ft::Stack<int, ft::StaticVector<int, 16> >	a;
+		ft::Stack<int, ft::StaticVector<int, 16> >	b;
+
+		a.push(1);
+		b.push(1);
+		b.push(2);
+		std::cout << "a == b: " << (a == b) << ", a < b: " << (a < b) << '\n';
+	}
+
+	int		main()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "STATICVECTOR" << std::endl;
+		basic_test();
+		modifier_test();
+		capacity_test();
+		object_test();
+		adapter_test();
+		return (0);
+	}
+}
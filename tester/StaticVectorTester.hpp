@@ -0,0 +1,22 @@
+#ifndef STATIC_VECTOR_TESTER_HPP
+# define STATIC_VECTOR_TESTER_HPP
+
+# include "StaticVector.hpp"
+# include "Stack.hpp"
+# include "Queue.hpp"
+# include <iostream>
+# include <iomanip>
+# include <string>
+# include <stdexcept>
+
+namespace staticvector_tester
+{
+	void	basic_test();
+	void	modifier_test();
+	void	capacity_test();
+	void	object_test();
+	void	adapter_test();
+	int		main();
+}
+
+#endif
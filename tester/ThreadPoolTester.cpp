@@ -0,0 +1,140 @@
+#include "ThreadPoolTester.hpp"
+
+namespace threadpool_tester
+{
+	// 1부터 n까지의 합을 *out에 쓴다
+	struct SumTo
+	{
+		long	n;
+		long	*out;
+
+		SumTo(long n_, long *out_) : n(n_), out(out_) {}
+
+		void	operator() () const
+		{
+			long	sum;
+
+			sum = 0;
+			for (long i = 1; i <= n; ++i)
+				sum += i;
+			*out = sum;
+		}
+	};
+
+	void	submit_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "SUBMIT" << std::endl;
+		ft::ThreadPool		pool(3);
+		ft::TaskHandle		handles[8];
+		long				results[8];
+
+		std::cout << "threads: " << pool.size() << '\n';
+		for (int i = 0; i < 8; ++i)
+			handles[i] = pool.submit(SumTo((i + 1) * 1000, results + i));
+		for (int i = 0; i < 8; ++i)
+			handles[i].wait();
+		std::cout << "results:";
+		for (int i = 0; i < 8; ++i)
+			std::cout << ' ' << results[i];
+		std::cout << "\nall done: " << handles[0].done() << handles[7].done() << '\n';
+	}
+
+	// v[i] = i * i
+	struct Square
+	{
+		ft::Vector<long>	*v;
+
+		explicit Square(ft::Vector<long> *v_) : v(v_) {}
+
+		void	operator() (size_t lo, size_t hi) const
+		{
+			for (size_t i = lo; i < hi; ++i)
+				(*v)[i] = static_cast<long>(i * i);
+		}
+	};
+
+	void	parallel_for_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "PARALLEL_FOR" << std::endl;
+		ft::ThreadPool		pool(4);
+		ft::Vector<long>	v(100000, 0);
+		long				sum;
+
+		pool.parallel_for(0, v.size(), 1000, Square(&v));
+		sum = 0;
+		for (size_t i = 0; i < v.size(); ++i)
+			sum += v[i];
+		std::cout << "v[0] v[7] v[99999]: " << v[0] << ' ' << v[7] << ' ' << v[99999] << '\n';
+		std::cout << "sum: " << sum << '\n';
+		pool.parallel_for(5, 5, 10, Square(&v));
+		std::cout << "empty range ok\n";
+	}
+
+	// 작업 안에서 다시 parallel_for를 부른다 (기다리는 일꾼도 다른 작업을 실행하므로 멈추지 않는다)
+	struct Outer
+	{
+		ft::ThreadPool		*pool;
+		ft::Vector<long>	*v;
+
+		Outer(ft::ThreadPool *p, ft::Vector<long> *v_) : pool(p), v(v_) {}
+
+		void	operator() () const
+		{
+			pool->parallel_for(0, v->size(), 64, Square(v));
+		}
+	};
+
+	void	nested_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "NESTED" << std::endl;
+		ft::ThreadPool		pool(2);
+		ft::Vector<long>	vs[6];
+		ft::TaskHandle		handles[6];
+		bool				ok;
+
+		for (int i = 0; i < 6; ++i)
+		{
+			vs[i].assign(5000, 0);
+			handles[i] = pool.submit(Outer(&pool, vs + i));
+		}
+		ok = true;
+		for (int i = 0; i < 6; ++i)
+		{
+			handles[i].wait();
+			for (size_t j = 0; j < vs[i].size(); ++j)
+				ok = ok && vs[i][j] == static_cast<long>(j * j);
+		}
+		std::cout << "nested results ok: " << ok << '\n';
+	}
+
+	void	shutdown_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "SHUTDOWN" << std::endl;
+		ft::ThreadPool		pool(2);
+		long				results[100];
+		long				sum;
+
+		for (int i = 0; i < 100; ++i)
+			pool.submit(SumTo(i, results + i));
+		// 들어간 작업을 모두 끝낸 뒤에 멈춘다
+		pool.shutdown();
+		sum = 0;
+		for (int i = 0; i < 100; ++i)
+			sum += results[i];
+		std::cout << "sum after shutdown: " << sum << '\n';
+		// 닫힌 뒤에 넣은 작업은 그 자리에서 실행된다
+		ft::TaskHandle	late = pool.submit(SumTo(10, results));
+		std::cout << "late task done: " << late.done() << ' ' << results[0] << '\n';
+		pool.shutdown();
+	}
+
+	int		main(void)
+	{
+		submit_test();
+		parallel_for_test();
+		nested_test();
+		shutdown_test();
+
+		return (0);
+	}
+}
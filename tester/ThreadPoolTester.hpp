@@ -0,0 +1,18 @@
+#ifndef THREAD_POOL_TESTER_HPP
+# define THREAD_POOL_TESTER_HPP
+
+# include "ThreadPool.hpp"
+# include "Vector.hpp"
+# include <iostream>
+# include <iomanip>
+
+namespace threadpool_tester
+{
+	void	submit_test();
+	void	parallel_for_test();
+	void	nested_test();
+	void	shutdown_test();
+	int		main();
+}
+
+#endif
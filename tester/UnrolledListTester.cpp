@@ -0,0 +1,280 @@
+#include "UnrolledListTester.hpp"
+
+namespace unrolledlist_tester
+{
+	// 노드를 작게 잡아 나누기와 합치기가 자주 일어나게 한다
+	typedef ft::UnrolledList<int, 4>			small_list;
+	typedef ft::UnrolledList<std::string, 4>	string_list;
+
+	template <class L>
+	void	print(const char *name, const L &l)
+	{
+		std::cout << name << " (" << l.size() << "):";
+		for (typename L::const_iterator it = l.begin(); it != l.end(); ++it)
+			std::cout << ' ' << *it;
+		std::cout << '\n';
+	}
+
+	bool	is_odd(int n)
+	{ return (n % 2 == 1); }
+
+	bool	same_tens(int a, int b)
+	{ return (a / 10 == b / 10); }
+
+	bool	greater(int a, int b)
+	{ return (a > b); }
+
+	void	basic_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "BASIC" << std::endl;
+		small_list	mylist;
+
+		std::cout << "empty: " << mylist.empty() << '\n';
+		for (int i = 0; i < 6; ++i)
+			mylist.push_back(i);
+		for (int i = 1; i <= 5; ++i)
+			mylist.push_front(-i);
+		print("mylist", mylist);
+		std::cout << "front: " << mylist.front() << ", back: " << mylist.back() << '\n';
+		std::cout << "reverse:";
+		for (small_list::reverse_iterator it = mylist.rbegin(); it != mylist.rend(); ++it)
+			std::cout << ' ' << *it;
+		std::cout << '\n';
+		mylist.pop_front();
+		mylist.pop_front();
+		mylist.pop_back();
+		print("pop", mylist);
+
+		small_list	fill(5, 7);
+		small_list	copy(mylist);
+		small_list	range(copy.begin(), copy.end());
+
+		print("fill", fill);
+		print("copy", copy);
+		std::cout << "copy == mylist: " << (copy == mylist) << ", fill < mylist: " << (fill < mylist) << '\n';
+		fill = range;
+		fill.push_back(100);
+		print("assigned", fill);
+		std::cout << "fill > range: " << (fill > range) << ", fill != range: " << (fill != range) << '\n';
+		fill.assign(3, 9);
+		print("assign n", fill);
+		fill.resize(6, 1);
+		print("resize 6", fill);
+		fill.resize(2);
+		print("resize 2", fill);
+		fill.swap(mylist);
+		print("swap fill", fill);
+		print("swap mylist", mylist);
+
+		string_list	words;
+
+		words.push_back("unrolled");
+		words.push_back("linked");
+		words.push_front("an");
+		words.insert(++words.begin(), 3, "x");
+		print("words", words);
+		words.clear();
+		std::cout << "clear: " << words.size() << ' ' << words.empty() << '\n';
+	}
+
+	void	insert_erase_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "INSERT_ERASE" << std::endl;
+		small_list				mylist;
+		small_list::iterator	it;
+
+		for (int i = 0; i < 8; ++i)
+			mylist.push_back(i * 10);
+		// 꽉 찬 노드 가운데에 넣어 나누기를 일으킨다
+		it = mylist.begin();
+		++it;
+		++it;
+		it = mylist.insert(it, 15);
+		std::cout << "inserted: " << *it << ", next: " << *++it << '\n';
+		for (int i = 0; i < 5; ++i)
+			it = mylist.insert(it, 21 + i);
+		print("middle inserts", mylist);
+		mylist.insert(mylist.end(), 3, 99);
+		mylist.insert(mylist.begin(), 2, -1);
+		print("fill inserts", mylist);
+
+		int		arr[] = {1, 2, 3, 4, 5, 6};
+
+		it = mylist.begin();
+		for (int i = 0; i < 7; ++i)
+			++it;
+		mylist.insert(it, arr, arr + 6);
+		print("range insert", mylist);
+
+		// 지우고 돌려받은 이터레이터로 이어서 지운다
+		it = mylist.begin();
+		while (it != mylist.end())
+		{
+			if (*it % 2)
+				it = mylist.erase(it);
+			else
+				++it;
+		}
+		print("erase odd", mylist);
+		it = mylist.begin();
+		++it;
+		++it;
+
+		small_list::iterator	last = it;
+
+		for (int i = 0; i < 6; ++i)
+			++last;
+		it = mylist.erase(it, last);
+		std::cout << "after range erase: " << *it << '\n';
+		print("range erase", mylist);
+		it = mylist.erase(mylist.begin(), mylist.end());
+		std::cout << "erase all: " << mylist.size() << ' ' << (it == mylist.end()) << '\n';
+		mylist.insert(mylist.begin(), 42);
+		print("reuse", mylist);
+	}
+
+	void	splice_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "SPLICE" << std::endl;
+		small_list				a;
+		small_list				b;
+		small_list::iterator	it;
+
+		for (int i = 1; i <= 6; ++i)
+			a.push_back(i);
+		for (int i = 1; i <= 5; ++i)
+			b.push_back(i * 10);
+		it = a.begin();
+		++it;
+		++it;
+		a.splice(it, b);
+		print("splice all a", a);
+		print("splice all b", b);
+		// 나뉜 노드를 가리키던 이터레이터는 다시 구한다
+		it = a.end();
+		for (int i = 0; i < 4; ++i)
+			--it;
+		b.splice(b.begin(), a, it);
+		print("splice one a", a);
+		print("splice one b", b);
+
+		small_list::iterator	first = a.begin();
+		small_list::iterator	last;
+
+		++first;
+		last = first;
+		for (int i = 0; i < 4; ++i)
+			++last;
+		b.splice(b.end(), a, first, last);
+		print("splice range a", a);
+		print("splice range b", b);
+		// 같은 리스트 안에서 앞쪽 구간을 뒤로 옮긴다
+		first = b.begin();
+		last = first;
+		++last;
+		++last;
+		b.splice(b.end(), b, first, last);
+		print("splice self", b);
+		last = b.end();
+		--last;
+		b.splice(b.begin(), b, last, b.end());
+		print("splice self back", b);
+		b.splice(b.begin(), b, b.begin());
+		print("splice self no-op", b);
+	}
+
+	void	operation_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "OPERATION" << std::endl;
+		small_list	mylist;
+		small_list	other;
+		int			arr[] = {42, 7, 13, 7, 99, 21, 7, 55, 3, 30, 31, 14};
+
+		mylist.assign(arr, arr + 12);
+		mylist.sort();
+		print("sort", mylist);
+		mylist.sort(greater);
+		print("sort greater", mylist);
+		mylist.reverse();
+		print("reverse", mylist);
+		mylist.unique();
+		print("unique", mylist);
+		mylist.unique(same_tens);
+		print("unique tens", mylist);
+		for (int i = 0; i < 10; ++i)
+			other.push_back(i * 5);
+		mylist.merge(other);
+		print("merge", mylist);
+		std::cout << "other after merge: " << other.size() << '\n';
+		mylist.remove(7);
+		mylist.remove(0);
+		print("remove", mylist);
+		mylist.remove_if(is_odd);
+		print("remove_if odd", mylist);
+		other.push_back(44);
+		other.push_back(2);
+		mylist.sort(greater);
+		other.sort(greater);
+		mylist.merge(other, greater);
+		print("merge greater", mylist);
+	}
+
+	// 같은 순서의 무작위 연산 결과를 요약해 찍는다 (UnrolledListAns.cpp의 std::list와 같아야 한다)
+	void	random_test()
+	{
+		std::cout << std::setfill('-') << std::setw(20) << "RANDOM" << std::endl;
+		small_list		mylist;
+		unsigned long	seed = 12345;
+
+		for (int step = 0; step < 20000; ++step)
+		{
+			seed = seed * 1103515245 + 12345;
+			unsigned long	r = (seed >> 16) & 0x7fff;
+			size_t			pos = mylist.empty() ? 0 : r % (mylist.size() + 1);
+
+			small_list::iterator	it = mylist.begin();
+
+			for (size_t i = 0; i < pos; ++i)
+				++it;
+			switch (r % 7)
+			{
+				case 0: case 1: case 2:
+					mylist.insert(it, step);
+					break ;
+				case 3:
+					if (it != mylist.end())
+						mylist.erase(it);
+					break ;
+				case 4:
+					mylist.push_front(step);
+					break ;
+				case 5:
+					if (!mylist.empty())
+						mylist.pop_back();
+					break ;
+				case 6:
+					mylist.push_back(step);
+					break ;
+			}
+			if (step % 5000 == 4999)
+			{
+				unsigned long	sum = 0;
+				unsigned long	i = 0;
+
+				for (small_list::const_iterator cit = mylist.begin(); cit != mylist.end(); ++cit)
+					sum += ++i * static_cast<unsigned long>(*cit);
+				std::cout << "step " << step + 1 << ": size " << mylist.size() << ", checksum " << sum << '\n';
+			}
+		}
+	}
+
+	int		main()
+	{
+		basic_test();
+		insert_erase_test();
+		splice_test();
+		operation_test();
+		random_test();
+		return (0);
+	}
+}
@@ -0,0 +1,19 @@
+#ifndef UNROLLED_LIST_TESTER_HPP
+# define UNROLLED_LIST_TESTER_HPP
+
+# include "UnrolledList.hpp"
+# include <iostream>
+# include <iomanip>
+# include <string>
+
+namespace unrolledlist_tester
+{
+	void	basic_test();
+	void	insert_erase_test();
+	void	splice_test();
+	void	operation_test();
+	void	random_test();
+	int		main();
+}
+
+#endif